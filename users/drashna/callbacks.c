@@ -13,6 +13,9 @@
 #ifdef QUANTUM_PAINTER_ENABLE
 #    include "display/painter/painter.h"
 #endif
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_TRANSACTION_IDS_USER)
+#    include "split/transport_stats.h"
+#endif
 
 #ifdef CUSTOM_DYNAMIC_MACROS_ENABLE
 #    include "keyrecords/custom_dynamic_macros.h"
@@ -366,6 +369,9 @@ void                       matrix_slave_scan_user(void) {
  */
 __attribute__((weak)) void housekeeping_task_keymap(void) {}
 void                       housekeeping_task_user(void) {
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_TRANSACTION_IDS_USER)
+    uint32_t housekeeping_start = timer_read_precise();
+#endif
     if (is_keyboard_master()) {
 #ifdef AUDIO_ENABLE
         user_state.audio_enable        = is_audio_on();
@@ -430,4 +436,7 @@ void                       housekeeping_task_user(void) {
     housekeeping_task_layer_map();
 #endif
     housekeeping_task_keymap();
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_TRANSACTION_IDS_USER)
+    transport_sync_record_housekeeping_time(timer_elapsed_precise_us(housekeeping_start));
+#endif
 }
@@ -12,6 +12,13 @@
 #        define OLED_UPDATE_INTERVAL 15
 #    endif
 #endif
+#ifndef OLED_RENDER_BUDGET_US
+#    ifdef OLED_DISPLAY_128X128
+#        define OLED_RENDER_BUDGET_US 1000
+#    else
+#        define OLED_RENDER_BUDGET_US 0 // render the whole layout every pass
+#    endif
+#endif
 #define OLED_DISABLE_TIMEOUT
 #ifdef OLED_FONT_H
 #    undef OLED_FONT_H
@@ -0,0 +1,175 @@
+#!/usr/bin/env python3
+# Copyright 2024 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+# SPDX-License-Identifier: GPL-3.0-or-later
+"""Converts the raw OLED animations in oled_assets.h into tiled sprites, for oled_sprite_draw().
+
+Every frame is cut into 8x8 pixel tiles (8 bytes of a page), and each unique tile is stored once in a palette that is
+shared between all of the sprites. A frame is then just a map of tile indices. When drawing, only the tiles
+that differ from the last frame drawn at that position are written to the OLED buffer.
+
+Usage: encode_sprites.py oled_assets.h oled_sprites.h
+"""
+import re
+import sys
+from pathlib import Path
+
+TILE_SIZE = 8
+MAX_TILES = 0xFFFF  # 0xFFFF is reserved for "nothing drawn yet" in the sprite caches
+
+# array name in oled_assets.h, sprite name, width in pixels, height in pages, and names for the frame dimensions when
+# the frames are nested (emitted as counts, and a macro to turn the nested index into a frame number)
+SPRITES = [
+    ('pet_animiations', 'pet', 32, 4, ('pets', 'animations', 'animation_frames')),
+    ('mario_animation', 'mario', 16, 4, None),
+    ('train_animation', 'train', 128, 4, None),
+    ('tri_layer_image', 'tri_layer', 24, 3, None),
+]
+
+
+def parse_initializer(text, name):
+    """Parses the initializer of an array into nested lists"""
+    match = re.search(rf'\b{name}\s*((?:\[[^\]]*\]\s*)+)(?:PROGMEM\s*)?=\s*\{{', text)
+    if not match:
+        raise ValueError(f'{name}: array not found')
+    tokens = re.findall(r'\{|\}|0[xX][0-9a-fA-F]+|\d+', re.sub(r'//[^\n]*|/\*.*?\*/', '', text[match.end() - 1:], flags=re.S))
+    stack = [[]]
+    for token in tokens:
+        if token == '{':
+            stack.append([])
+        elif token == '}':
+            value = stack.pop()
+            stack[-1].append(value)
+            if len(stack) == 1:
+                return stack[0][0]
+        else:
+            stack[-1].append(int(token, 0))
+    raise ValueError(f'{name}: unterminated initializer')
+
+
+def array_dimensions(text, name):
+    match = re.search(rf'\b{name}\s*((?:\[[^\]]*\]\s*)+)', text)
+    dims = re.findall(r'\[([^\]]*)\]', match.group(1))
+    defines = dict(re.findall(r'#\s*define\s+(\w+)\s+(.+)', text))
+
+    def evaluate(expression):
+        for _ in range(4):
+            expression = re.sub(r'\b([A-Za-z_]\w*)\b', lambda m: defines.get(m.group(1), m.group(1)), expression)
+        return int(eval(expression, {'__builtins__': {}})) if expression.strip() else None
+
+    return [evaluate(dim) for dim in dims]
+
+
+def flatten_frames(value, dims, frame_depth):
+    """Flattens the outer dimensions into a list of frames, padding missing entries with zeros"""
+    if frame_depth == 0:
+        return [value]
+    frames = []
+    count = dims[0] if dims[0] is not None else len(value)
+    for index in range(count):
+        entry = value[index] if index < len(value) else []
+        frames += flatten_frames(entry, dims[1:], frame_depth - 1)
+    return frames
+
+
+def frame_bytes(frame, width, pages):
+    """Turns a frame (a list of page rows, or one linear buffer) into page major bytes"""
+    if frame and isinstance(frame[0], list):
+        rows = [(row + [0] * width)[:width] for row in frame]
+        rows += [[0] * width] * (pages - len(rows))
+        return [byte for row in rows[:pages] for byte in row]
+    return (frame + [0] * (width * pages))[:width * pages]
+
+
+def main(argv):
+    if len(argv) != 3:
+        print(__doc__.strip().splitlines()[-1])
+        return 1
+    source, output = Path(argv[1]), Path(argv[2])
+    text = source.read_text()
+
+    palette = {bytes(TILE_SIZE): 0}
+    sprites = []
+    raw_size = 0
+    for array, name, width, pages, dim_names in SPRITES:
+        dims = array_dimensions(text, array)
+        value = parse_initializer(text, array)
+        # a frame is either [pages][width] or one linear [width * pages] buffer, with or without a null terminator
+        if dims[-1] in (width * pages, width * pages + 1):
+            frame_depth = len(dims) - 1
+        elif dims[-1] in (width, width + 1) and dims[-2] == pages:
+            frame_depth = len(dims) - 2
+        else:
+            raise ValueError(f'{array}: {dims} is not {width}x{pages * 8} frames')
+        if dim_names and len(dim_names) != frame_depth:
+            raise ValueError(f'{array}: {len(dim_names)} dimension names for {frame_depth} frame dimensions')
+        counts = [dim if dim is not None else len(value) for dim in dims[:frame_depth]]
+        frames = flatten_frames(value, dims, frame_depth)
+        element_count = 1
+        for dim in dims:
+            element_count *= dim if dim is not None else len(value)
+        raw_size += element_count
+
+        maps = []
+        for frame in frames:
+            data = frame_bytes(frame, width, pages)
+            tiles = []
+            for page in range(pages):
+                for x in range(0, width, TILE_SIZE):
+                    tile = bytes(data[page * width + x:page * width + x + TILE_SIZE])
+                    tiles.append(palette.setdefault(tile, len(palette)))
+            maps.append(tiles)
+        sprites.append((array, name, width, pages, maps, list(zip(dim_names or (), counts))))
+
+    if len(palette) > MAX_TILES:
+        raise ValueError(f'{len(palette)} unique tiles, only {MAX_TILES} fit in an index')
+
+    packed_size = len(palette) * TILE_SIZE + sum(len(maps) * len(maps[0]) * 2 for *_, maps, _ in sprites)
+    lines = [
+        "// Copyright 2024 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>",
+        '// SPDX-License-Identifier: GPL-3.0-or-later',
+        '',
+        f'// Generated by encode_sprites.py from {source.name}, do not edit.',
+        f'// {raw_size} bytes raw, {packed_size} bytes as {len(palette)} tiles and the frame maps.',
+        '',
+        '#pragma once',
+        '',
+        '#include <stdint.h>',
+        '#include "progmem.h"',
+        '',
+        f'#define OLED_SPRITE_TILE_SIZE {TILE_SIZE}',
+        '',
+        '// clang-format off',
+        f'static const uint8_t PROGMEM oled_sprite_tiles[{len(palette)}][OLED_SPRITE_TILE_SIZE] = {{',
+    ]
+    for tile in palette:
+        lines.append('    { ' + ', '.join(f'0x{b:02X}' for b in tile) + ' },')
+    lines.append('};')
+    for array, name, width, pages, maps, frame_dims in sprites:
+        tiles = len(maps[0])
+        lines += [
+            '',
+            f'// {array}: {len(maps)} frames, {width}x{pages * 8}',
+            f'static const uint16_t PROGMEM {name}_sprite_map[{len(maps)}][{tiles}] = {{',
+        ]
+        for tile_map in maps:
+            lines.append('    { ' + ', '.join(str(t) for t in tile_map) + ' },')
+        lines += [
+            '};',
+            f'#define {name.upper()}_SPRITE_TILES {tiles}',
+            f'#define {name.upper()}_SPRITE {{ .map = &{name}_sprite_map[0][0], .width = {width // TILE_SIZE}, .pages = {pages}, .frames = {len(maps)} }}',
+        ]
+        if frame_dims:
+            lines += [f'#define {name.upper()}_SPRITE_{dim.upper()} {count}' for dim, count in frame_dims]
+            args = [dim.rstrip('s') for dim, _ in frame_dims]
+            index = f'({args[0]})'
+            for arg, (dim, _) in zip(args[1:], frame_dims[1:]):
+                index = f'({index} * {name.upper()}_SPRITE_{dim.upper()} + ({arg}))'
+            lines.append(f'#define {name.upper()}_SPRITE_FRAME({", ".join(args)}) {index}')
+    lines.append('// clang-format on')
+    output.write_text('\n'.join(lines) + '\n')
+    print(f'{raw_size} -> {packed_size} bytes, {len(palette)} unique tiles')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
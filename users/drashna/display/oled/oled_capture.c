@@ -0,0 +1,85 @@
+// Copyright 2024 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @brief Captures what the OLED code renders, without needing to look at the hardware.
+ *
+ * The frame dump is a plain PBM image of the OLED buffer, printed to the console, which oled_capture.py can pull out
+ * of a console log (and compare against reference images). The frame stats count the blocks that each frame newly
+ * marks as dirty, which is what ends up being sent over the bus.
+ */
+
+#include "oled_capture.h"
+#include "print.h"
+
+extern uint8_t         oled_buffer[OLED_MATRIX_SIZE];
+extern OLED_BLOCK_TYPE oled_dirty;
+extern uint8_t         oled_rotation_width;
+
+static oled_frame_stats_t oled_frame_stats = {0};
+static bool               is_logging       = false;
+
+/**
+ * @brief Records the cost of the frame that was just rendered
+ *
+ * @param dirty_before dirty blocks from before the frame was rendered, that had not been flushed yet
+ */
+void oled_capture_record_frame(OLED_BLOCK_TYPE dirty_before) {
+    OLED_BLOCK_TYPE dirty  = oled_dirty & ~dirty_before;
+    uint16_t        blocks = 0;
+    for (; dirty; dirty &= dirty - 1) {
+        blocks++;
+    }
+
+    oled_frame_stats.frames++;
+    oled_frame_stats.total_blocks += blocks;
+    oled_frame_stats.last_blocks = blocks;
+    if (blocks > oled_frame_stats.max_blocks) {
+        oled_frame_stats.max_blocks = blocks;
+    }
+    if (is_logging && blocks) {
+        xprintf("OLED frame %lu: %u dirty blocks, %u bytes\n", oled_frame_stats.frames, blocks,
+                blocks * OLED_BLOCK_SIZE);
+    }
+}
+
+const oled_frame_stats_t *oled_capture_get_stats(void) {
+    return &oled_frame_stats;
+}
+
+void oled_capture_reset_stats(void) {
+    oled_frame_stats = (oled_frame_stats_t){0};
+}
+
+/**
+ * @brief Toggles printing the cost of every frame that changes something to the console
+ *
+ */
+void oled_capture_toggle_logging(void) {
+    is_logging = !is_logging;
+}
+
+/**
+ * @brief Prints the current OLED buffer to the console as a plain PBM image, along with the frame stats
+ *
+ * The image is the buffer as it is drawn to, before any rotation by the driver.
+ */
+void oled_capture_print_frame(void) {
+    uint8_t width  = oled_rotation_width;
+    uint8_t height = (OLED_MATRIX_SIZE / width) * 8;
+    char    row[(OLED_DISPLAY_WIDTH > OLED_DISPLAY_HEIGHT ? OLED_DISPLAY_WIDTH : OLED_DISPLAY_HEIGHT) + 1];
+
+    xprintf("OLED frame %lu: %u dirty blocks, max %u, avg %lu, block size %u\n", oled_frame_stats.frames,
+            oled_frame_stats.last_blocks, oled_frame_stats.max_blocks,
+            oled_frame_stats.frames ? oled_frame_stats.total_blocks / oled_frame_stats.frames : 0, OLED_BLOCK_SIZE);
+    xprintf("-----BEGIN OLED FRAME-----\nP1\n%u %u\n", width, height);
+    for (uint8_t y = 0; y < height; y++) {
+        const uint8_t *page = &oled_buffer[(y / 8) * width];
+        for (uint8_t x = 0; x < width; x++) {
+            row[x] = (page[x] & (1 << (y % 8))) ? '1' : '0';
+        }
+        row[width] = 0;
+        xprintf("%s\n", row);
+    }
+    xprintf("-----END OLED FRAME-----\n");
+}
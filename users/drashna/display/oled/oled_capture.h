@@ -0,0 +1,25 @@
+// Copyright 2024 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "oled_driver.h"
+
+/**
+ * @brief Rendering cost of the OLED frames, as newly dirtied blocks that need to be flushed to the display
+ *
+ */
+typedef struct {
+    uint32_t frames;
+    uint32_t total_blocks;
+    uint16_t last_blocks;
+    uint16_t max_blocks;
+} oled_frame_stats_t;
+
+void                      oled_capture_record_frame(OLED_BLOCK_TYPE dirty_before);
+const oled_frame_stats_t *oled_capture_get_stats(void);
+void                      oled_capture_reset_stats(void);
+void                      oled_capture_toggle_logging(void);
+void                      oled_capture_print_frame(void);
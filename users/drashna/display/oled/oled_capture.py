@@ -0,0 +1,85 @@
+#!/usr/bin/env python3
+# Copyright 2024 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+# SPDX-License-Identifier: GPL-3.0-or-later
+"""Extracts OLED frames captured with the OLED_CAPTURE keycode from a console log, as PBM images.
+
+Each frame is written to the output directory as frame_NNN.pbm. With --compare, each frame is also checked against the
+image of the same name in the reference directory, and the number of differing pixels is reported.
+
+Usage: qmk console | tee console.log
+       oled_capture.py console.log frames/ [--compare reference/]
+"""
+import argparse
+import re
+import sys
+from pathlib import Path
+
+FRAME_PATTERN = re.compile(r'-----BEGIN OLED FRAME-----\s*(P1\s+\d+\s+\d+\s+[01\s]+?)\s*-----END OLED FRAME-----')
+STATS_PATTERN = re.compile(r'^(OLED frame \d+: .*)$', re.MULTILINE)
+
+
+def read_pbm(text):
+    tokens = text.split()
+    if tokens[0] != 'P1':
+        raise ValueError('not a plain PBM image')
+    width, height = int(tokens[1]), int(tokens[2])
+    pixels = ''.join(tokens[3:])
+    if len(pixels) != width * height:
+        raise ValueError(f'expected {width * height} pixels, found {len(pixels)}')
+    return width, height, pixels
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument('log', type=Path, help='console log with captured frames')
+    parser.add_argument('output', type=Path, help='directory to write the frames to')
+    parser.add_argument('--compare', type=Path, help='directory with reference frames to compare against')
+    args = parser.parse_args()
+
+    # the console prefixes each line with the device name, which isn't part of the image
+    lines = []
+    for line in args.log.read_text().splitlines():
+        if 'OLED frame' in line:
+            line = line[line.index('OLED frame'):]
+        elif ': ' in line:
+            line = line.rsplit(': ', 1)[1]
+        lines.append(line.strip())
+    text = '\n'.join(lines)
+    frames = FRAME_PATTERN.findall(text)
+    if not frames:
+        print(f'{args.log}: no frames found')
+        return 1
+
+    args.output.mkdir(parents=True, exist_ok=True)
+    for line in STATS_PATTERN.findall(text):
+        print(line)
+
+    mismatched = 0
+    for index, frame in enumerate(frames):
+        width, height, pixels = read_pbm(frame)
+        name = f'frame_{index:03}.pbm'
+        rows = '\n'.join(pixels[y * width:(y + 1) * width] for y in range(height))
+        (args.output / name).write_text(f'P1\n{width} {height}\n{rows}\n')
+
+        if args.compare:
+            reference = args.compare / name
+            if not reference.exists():
+                print(f'{name}: no reference image')
+                mismatched += 1
+                continue
+            ref_width, ref_height, ref_pixels = read_pbm(reference.read_text())
+            if (ref_width, ref_height) != (width, height):
+                print(f'{name}: size {width}x{height} does not match reference {ref_width}x{ref_height}')
+                mismatched += 1
+                continue
+            diff = sum(1 for a, b in zip(pixels, ref_pixels) if a != b)
+            if diff:
+                print(f'{name}: {diff} pixels differ')
+                mismatched += 1
+
+    print(f'{len(frames)} frames written to {args.output}' + (f', {mismatched} mismatched' if args.compare else ''))
+    return 1 if mismatched else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,145 @@
+// Copyright 2024 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @brief Finds which parts of the OLED rendering are eating the budget.
+ *
+ * Each call wrapped in OLED_PROFILE() gets its own slot, which registers itself the first time that it is recorded,
+ * and accumulates the time spent in the call, and how many blocks it newly marked as dirty. The time spent flushing
+ * the dirty blocks to the display is recorded in the same way, so it can be compared directly against the rendering.
+ */
+
+#include "oled_profiler.h"
+#include "print.h"
+
+#ifndef OLED_PROFILER_TOP
+#    define OLED_PROFILER_TOP 10
+#endif
+
+#ifdef OLED_PROFILER_ENABLE
+bool oled_profiler_enabled = false;
+
+static oled_profiler_slot_t *oled_profiler_slots      = NULL;
+static oled_profiler_slot_t  oled_profiler_flush_slot = {.name = "oled_render_dirty(false)"};
+
+/**
+ * @brief Adds a sample to a slot, registering the slot if this is the first time it has been used
+ *
+ * @param slot slot to add to
+ * @param elapsed time spent, in microseconds
+ * @param blocks blocks dirtied (or flushed)
+ */
+static void oled_profiler_add(oled_profiler_slot_t *slot, uint32_t elapsed, uint16_t blocks) {
+    if (!slot->registered) {
+        slot->registered    = true;
+        slot->next          = oled_profiler_slots;
+        oled_profiler_slots = slot;
+    }
+    slot->calls++;
+    slot->total_us += elapsed;
+    slot->blocks += blocks;
+    if (elapsed > slot->max_us) {
+        slot->max_us = elapsed > UINT16_MAX ? UINT16_MAX : elapsed;
+    }
+}
+
+static uint16_t oled_profiler_count_blocks(OLED_BLOCK_TYPE blocks) {
+    uint16_t count = 0;
+    for (; blocks; blocks &= blocks - 1) {
+        count++;
+    }
+    return count;
+}
+
+static void oled_profiler_reset(void) {
+    for (oled_profiler_slot_t *slot = oled_profiler_slots; slot; slot = slot->next) {
+        slot->calls    = 0;
+        slot->total_us = 0;
+        slot->blocks   = 0;
+        slot->max_us   = 0;
+    }
+}
+#endif // OLED_PROFILER_ENABLE
+
+/**
+ * @brief Records a profiled call, used by OLED_PROFILE()
+ *
+ * @param slot slot for the call site
+ * @param start timer_read_precise() from before the call
+ * @param dirty_before dirty blocks from before the call
+ */
+void oled_profiler_record(oled_profiler_slot_t *slot, uint32_t start, OLED_BLOCK_TYPE dirty_before) {
+#ifdef OLED_PROFILER_ENABLE
+    uint32_t elapsed = timer_elapsed_precise_us(start);
+    oled_profiler_add(slot, elapsed, oled_profiler_count_blocks(oled_dirty & ~dirty_before));
+#endif
+}
+
+/**
+ * @brief Flushes the dirty blocks to the display, timing it, and counting the blocks sent
+ *
+ * The driver flushes after oled_task_user() returns, where it can't be timed, so while profiling, this flushes first.
+ * That does mean that the display is updated a bit faster than normal, while the profiler is running.
+ */
+void oled_profiler_flush(void) {
+#ifdef OLED_PROFILER_ENABLE
+    if (!oled_profiler_enabled || !oled_dirty) {
+        return;
+    }
+    OLED_BLOCK_TYPE dirty_before = oled_dirty;
+    uint32_t        start        = timer_read_precise();
+    oled_render_dirty(false);
+    uint32_t elapsed = timer_elapsed_precise_us(start);
+    oled_profiler_add(&oled_profiler_flush_slot, elapsed, oled_profiler_count_blocks(dirty_before & ~oled_dirty));
+#endif
+}
+
+/**
+ * @brief Starts or stops profiling, starting from a clean slate
+ *
+ */
+void oled_profiler_toggle(void) {
+#ifdef OLED_PROFILER_ENABLE
+    oled_profiler_enabled = !oled_profiler_enabled;
+    oled_profiler_reset();
+    xprintf("OLED profiler %s\n", oled_profiler_enabled ? "started" : "stopped");
+#else
+    xprintf("OLED profiler not enabled, build with OLED_PROFILER_ENABLE = yes\n");
+#endif
+}
+
+/**
+ * @brief Prints the call sites that have taken the most time to the console, and starts counting again
+ *
+ */
+void oled_profiler_print(void) {
+#ifdef OLED_PROFILER_ENABLE
+    // insertion sort the slots by total time, slowest first
+    oled_profiler_slot_t *sorted = NULL;
+    while (oled_profiler_slots) {
+        oled_profiler_slot_t  *slot = oled_profiler_slots;
+        oled_profiler_slot_t **next = &sorted;
+        oled_profiler_slots         = slot->next;
+        while (*next && (*next)->total_us >= slot->total_us) {
+            next = &(*next)->next;
+        }
+        slot->next = *next;
+        *next      = slot;
+    }
+    oled_profiler_slots = sorted;
+
+    xprintf("OLED profile:   total us   calls  avg us  max us   bytes  call\n");
+    uint8_t count = 0;
+    for (oled_profiler_slot_t *slot = oled_profiler_slots; slot && count < OLED_PROFILER_TOP; slot = slot->next) {
+        if (!slot->calls) {
+            continue;
+        }
+        xprintf("OLED profile: %10lu %7lu %7lu %7u %7lu  %s\n", slot->total_us, slot->calls,
+                slot->total_us / slot->calls, slot->max_us, slot->blocks * OLED_BLOCK_SIZE, slot->name);
+        count++;
+    }
+    oled_profiler_reset();
+#else
+    xprintf("OLED profiler not enabled, build with OLED_PROFILER_ENABLE = yes\n");
+#endif
+}
@@ -0,0 +1,52 @@
+// Copyright 2024 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "oled_driver.h"
+
+/**
+ * @brief Accumulated cost of a single profiled call site
+ *
+ */
+typedef struct oled_profiler_slot_t {
+    const char                  *name;
+    struct oled_profiler_slot_t *next;
+    uint32_t                     total_us;
+    uint32_t                     calls;
+    uint32_t                     blocks;
+    uint16_t                     max_us;
+    bool                         registered;
+} oled_profiler_slot_t;
+
+void oled_profiler_record(oled_profiler_slot_t *slot, uint32_t start, OLED_BLOCK_TYPE dirty_before);
+void oled_profiler_flush(void);
+void oled_profiler_toggle(void);
+void oled_profiler_print(void);
+
+#ifdef OLED_PROFILER_ENABLE
+#    include "drashna.h"
+
+extern bool            oled_profiler_enabled;
+extern OLED_BLOCK_TYPE oled_dirty;
+
+/**
+ * @brief Times a call, and counts the blocks that it dirties, under a slot named after the call itself
+ *
+ */
+#    define OLED_PROFILE(...)                                                                            \
+        do {                                                                                             \
+            static oled_profiler_slot_t oled_profile_slot  = {.name = #__VA_ARGS__};                     \
+            bool                        oled_profile_on    = oled_profiler_enabled;                      \
+            uint32_t                    oled_profile_start = oled_profile_on ? timer_read_precise() : 0; \
+            OLED_BLOCK_TYPE             oled_profile_dirty = oled_dirty;                                 \
+            __VA_ARGS__;                                                                                 \
+            if (oled_profile_on) {                                                                       \
+                oled_profiler_record(&oled_profile_slot, oled_profile_start, oled_profile_dirty);        \
+            }                                                                                            \
+        } while (0)
+#else
+#    define OLED_PROFILE(...) __VA_ARGS__
+#endif // OLED_PROFILER_ENABLE
@@ -0,0 +1,672 @@
+// Copyright 2024 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Generated by encode_sprites.py from oled_assets.h, do not edit.
+// 13039 bytes raw, 7614 bytes as 552 tiles and the frame maps.
+
+#pragma once
+
+#include <stdint.h>
+#include "progmem.h"
+
+#define OLED_SPRITE_TILE_SIZE 8
+
+// clang-format off
+static const uint8_t PROGMEM oled_sprite_tiles[552][OLED_SPRITE_TILE_SIZE] = {
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00 },
+    { 0x08, 0x88, 0x8E, 0x4A, 0x49, 0xC8, 0x60, 0x30 },
+    { 0x60, 0xC0, 0x49, 0x4D, 0xCB, 0x79, 0x18, 0x04 },
+    { 0x1C, 0xE0, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0E },
+    { 0x11, 0x0C, 0x03, 0x38, 0x1E, 0x61, 0x80, 0x20 },
+    { 0x20, 0x22, 0x41, 0x45, 0x85, 0x07, 0x05, 0x40 },
+    { 0x20, 0x10, 0x81, 0x7E, 0x8F, 0x78, 0xC0, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02 },
+    { 0x04, 0x04, 0x04, 0x04, 0x04, 0x0C, 0x0A, 0x09 },
+    { 0x0E, 0x0A, 0x0E, 0x0A, 0x0E, 0x06, 0x07, 0x0E },
+    { 0x09, 0x0B, 0x0E, 0x0B, 0x0D, 0x0C, 0x07, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xC2 },
+    { 0xAA, 0x92, 0xAA, 0x86, 0x82, 0x00, 0x00, 0x00 },
+    { 0x20, 0x20, 0xA0, 0x60, 0x20, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x40, 0x20 },
+    { 0x11, 0x61, 0xC1, 0x41, 0xC1, 0x60, 0x10, 0x08 },
+    { 0x04, 0xF8, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x08 },
+    { 0x26, 0x59, 0x07, 0x18, 0x1E, 0x61, 0x80, 0x20 },
+    { 0x20, 0x42, 0x42, 0x45, 0x85, 0x07, 0x05, 0x40 },
+    { 0x20, 0x20, 0x91, 0x7E, 0x8F, 0x78, 0xC0, 0x00 },
+    { 0x09, 0x0B, 0x0E, 0x0B, 0x0B, 0x0C, 0x07, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0x3C, 0x3C },
+    { 0x28, 0x28, 0x50, 0xFE, 0xDE, 0x54, 0x4C, 0x08 },
+    { 0x0A, 0x14, 0x14, 0x28, 0x50, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x1E, 0x28 },
+    { 0x50, 0x00, 0x30, 0x35, 0x29, 0x02, 0x00, 0x0B },
+    { 0x2A, 0xA0, 0xA8, 0x40, 0x3C, 0x9F, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xC0, 0xA0 },
+    { 0xA0, 0x29, 0xF1, 0x59, 0x05, 0x03, 0x00, 0xC0 },
+    { 0x2C, 0x1B, 0x09, 0x63, 0x4F, 0xCF, 0x14, 0xE0 },
+    { 0x28, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0F, 0x0A, 0x0A },
+    { 0x08, 0x08, 0x08, 0x0F, 0x08, 0x08, 0x0C, 0x07 },
+    { 0x0C, 0x0A, 0x08, 0x09, 0x08, 0x09, 0x08, 0x00 },
+    { 0x0A, 0x0F, 0x0D, 0x07, 0x05, 0x02, 0x00, 0x00 },
+    { 0x00, 0xF8, 0x38, 0x10, 0x30, 0x20, 0x20, 0x40 },
+    { 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x03, 0x0F, 0x13, 0xE3, 0x82, 0x8A },
+    { 0x8A, 0x1F, 0x04, 0x62, 0x10, 0x88, 0x40, 0x40 },
+    { 0x00, 0x00, 0x01, 0xFE, 0xFF, 0x15, 0x9E, 0xD0 },
+    { 0x60, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x86, 0xC6 },
+    { 0xAA, 0xA8, 0x4A, 0xF8, 0x88, 0x04, 0x84, 0x80 },
+    { 0xC0, 0x88, 0x87, 0x14, 0x8D, 0xF7, 0x14, 0x14 },
+    { 0x52, 0x4A, 0xCA, 0x7F, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0F, 0x0A },
+    { 0x0A, 0x0A, 0x08, 0x08, 0x0F, 0x0A, 0x0A, 0x0E },
+    { 0x07, 0x0E, 0x0A, 0x0A, 0x0F, 0x0C, 0x0C, 0x0E },
+    { 0x0A, 0x0A, 0x0F, 0x0A, 0x0E, 0x0A, 0x0A, 0x04 },
+    { 0x00, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0xC0, 0x80 },
+    { 0x00, 0x00, 0x00, 0x80, 0x70, 0x38, 0x30, 0x60 },
+    { 0x40, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x80, 0x88 },
+    { 0x89, 0x1E, 0x06, 0x05, 0x44, 0x20, 0x20, 0x90 },
+    { 0x80, 0x00, 0x01, 0xC6, 0xB8, 0x80, 0x80, 0x80 },
+    { 0xAA, 0xA8, 0x4A, 0xF8, 0x88, 0x05, 0x87, 0x8E },
+    { 0xCA, 0x92, 0x9E, 0x13, 0x8F, 0xF8, 0x94, 0x94 },
+    { 0xA4, 0xA4, 0xA5, 0x7E, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x80, 0x60, 0x18, 0x1C, 0x18, 0xB0, 0xC0 },
+    { 0x80, 0xC0, 0xB0, 0x18, 0x1C, 0x18, 0x60, 0x80 },
+    { 0x00, 0x3F, 0x40, 0xA0, 0x20, 0x2E, 0x00, 0x00 },
+    { 0x21, 0x00, 0x00, 0x2E, 0x20, 0xA0, 0x40, 0x3F },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0 },
+    { 0xA0, 0xA0, 0x40, 0xF0, 0x89, 0x0D, 0x83, 0x80 },
+    { 0xC0, 0x80, 0x83, 0x0D, 0x89, 0xF0, 0x40, 0xA0 },
+    { 0xA0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x07, 0x0E, 0x0A, 0x0A, 0x0F, 0x08, 0x08, 0x0A },
+    { 0x0A, 0x0A, 0x0F, 0x0A, 0x0E, 0x0A, 0x0E, 0x04 },
+    { 0x00, 0x80, 0x60, 0x18, 0x1C, 0x18, 0x70, 0x40 },
+    { 0xC0, 0x40, 0x70, 0x18, 0x1C, 0x18, 0x60, 0x80 },
+    { 0x00, 0x3F, 0x48, 0x89, 0x05, 0x01, 0x7A, 0x84 },
+    { 0x86, 0x78, 0x02, 0x01, 0x05, 0x89, 0x48, 0x3F },
+    { 0x00, 0x20, 0x20, 0x40, 0x40, 0x82, 0x84, 0x08 },
+    { 0x10, 0x80, 0x60, 0x38, 0x1C, 0x38, 0xB0, 0xC0 },
+    { 0x80, 0xC0, 0xB0, 0x38, 0x1C, 0x38, 0x60, 0x80 },
+    { 0x08, 0x84, 0x82, 0x40, 0x40, 0x20, 0x20, 0x00 },
+    { 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x00 },
+    { 0xA0, 0xA0, 0x40, 0xF0, 0x89, 0x05, 0x83, 0x80 },
+    { 0xC0, 0x80, 0x83, 0x05, 0x89, 0xF0, 0x58, 0xAC },
+    { 0xB6, 0xCB, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x0A, 0x08, 0x08, 0x08, 0x0F, 0x0A, 0x0A, 0x0E },
+    { 0x07, 0x0E, 0x0A, 0x0A, 0x0F, 0x08, 0x08, 0x08 },
+    { 0x0A, 0x0A, 0x0F, 0x0C, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x80, 0xC0, 0x20, 0x60, 0x90, 0x08, 0x0C },
+    { 0x0E, 0x1E, 0x20, 0x20, 0x40, 0xE0, 0xF0, 0xF0 },
+    { 0x80, 0xC0, 0x20, 0x20, 0xF0, 0x10, 0x10, 0xF0 },
+    { 0x90, 0x8F, 0x34, 0x49, 0x12, 0x04, 0x01, 0x00 },
+    { 0x10, 0x10, 0x8F, 0x98, 0xE4, 0x47, 0x21, 0x7F },
+    { 0x00, 0x80, 0xC0, 0x20, 0x50, 0x98, 0x86, 0x0D },
+    { 0x30, 0x41, 0x06, 0x08, 0x10, 0x03, 0x84, 0x88 },
+    { 0x00, 0x00, 0x81, 0xC2, 0x7C, 0x30, 0x10, 0x18 },
+    { 0x08, 0x07, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00 },
+    { 0x01, 0x02, 0x02, 0x03, 0x01, 0x01, 0x00, 0x01 },
+    { 0x02, 0x02, 0x02, 0x0C, 0x08, 0x08, 0x08, 0x09 },
+    { 0x0F, 0x09, 0x0F, 0x09, 0x0F, 0x0F, 0x09, 0x06 },
+    { 0x0E, 0x3E, 0x40, 0x40, 0x80, 0x00, 0x00, 0xE0 },
+    { 0x80, 0x40, 0xE0, 0x20, 0x10, 0x70, 0x90, 0x10 },
+    { 0xB0, 0xCF, 0x18, 0x13, 0x04, 0x01, 0x00, 0x48 },
+    { 0x48, 0x50, 0xD7, 0x80, 0x40, 0x33, 0x0C, 0xFF },
+    { 0x1E, 0x32, 0x4C, 0xA8, 0x90, 0xF8, 0x9E, 0x21 },
+    { 0x43, 0x0C, 0x10, 0x23, 0x04, 0x08, 0x81, 0x82 },
+    { 0x08, 0x0E, 0x0C, 0x0F, 0x15, 0x17, 0x0D, 0x03 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80 },
+    { 0x40, 0x40, 0x20, 0xA0, 0x50, 0x50, 0x50, 0xA0 },
+    { 0xA0, 0x40, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0xC0, 0x60, 0x90, 0xA8, 0x4C, 0x32, 0xE1 },
+    { 0x00, 0x02, 0x01, 0x40, 0x42, 0x41, 0x41, 0x54 },
+    { 0x72, 0x8A, 0x09, 0x05, 0x45, 0x26, 0x98, 0x50 },
+    { 0x30, 0x08, 0x08, 0x0C, 0x7E, 0x8E, 0x00, 0x00 },
+    { 0x07, 0x04, 0x02, 0x01, 0x00, 0x02, 0x85, 0x78 },
+    { 0x60, 0x80, 0x00, 0x60, 0xA0, 0xA5, 0xB5, 0x55 },
+    { 0xAD, 0x33, 0x40, 0x80, 0x88, 0x84, 0xC4, 0x4C },
+    { 0x88, 0x88, 0x80, 0x87, 0x80, 0x40, 0x2F, 0x18 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02 },
+    { 0x01, 0x01, 0x06, 0x0C, 0x0F, 0x02, 0x03, 0x02 },
+    { 0x0E, 0x0B, 0x0B, 0x05, 0x02, 0x01, 0x00, 0x00 },
+    { 0xE0, 0x60, 0x60, 0x40, 0x80, 0x00, 0x00, 0x00 },
+    { 0x80, 0xC0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x01, 0x02, 0xC5, 0x39, 0x45, 0x26, 0x94 },
+    { 0x48, 0x28, 0x30, 0x90, 0x50, 0x60, 0x20, 0x40 },
+    { 0x80, 0xC0, 0x30, 0x78, 0x84, 0x1C, 0x22, 0x01 },
+    { 0x01, 0x01, 0x77, 0x04, 0x08, 0x70, 0x80, 0x00 },
+    { 0xE0, 0x20, 0x18, 0xA7, 0xC0, 0xC0, 0x91, 0x60 },
+    { 0x60, 0xC2, 0xA1, 0xA0, 0x14, 0x02, 0x01, 0x01 },
+    { 0x04, 0x02, 0x00, 0x80, 0x80, 0x10, 0x91, 0x51 },
+    { 0x71, 0xC9, 0x88, 0x08, 0x08, 0x04, 0x03, 0x00 },
+    { 0x03, 0x02, 0x07, 0x05, 0x02, 0x01, 0x01, 0x01 },
+    { 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01 },
+    { 0x01, 0x01, 0x03, 0x03, 0x02, 0x05, 0x0A, 0x0A },
+    { 0x05, 0x04, 0x0A, 0x09, 0x0A, 0x04, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08 },
+    { 0xA8, 0x48, 0xA8, 0x18, 0x08, 0x00, 0x00, 0x00 },
+    { 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03 },
+    { 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x80 },
+    { 0x44, 0x84, 0x06, 0x05, 0x04, 0x80, 0x40, 0x20 },
+    { 0x10, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x20 },
+    { 0x18, 0x04, 0x04, 0x02, 0x7A, 0x86, 0x01, 0x80 },
+    { 0x80, 0x01, 0x03, 0x05, 0x07, 0x01, 0x00, 0x00 },
+    { 0x80, 0x83, 0x45, 0xFA, 0x3C, 0xE0, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08 },
+    { 0x10, 0x10, 0x10, 0x10, 0x10, 0x33, 0x24, 0x28 },
+    { 0x28, 0x29, 0x29, 0x29, 0x3A, 0x18, 0x1C, 0x39 },
+    { 0x24, 0x24, 0x3A, 0x2D, 0x26, 0x31, 0x1F, 0x00 },
+    { 0x22, 0x22, 0x3A, 0x2A, 0x26, 0x22, 0x80, 0xC0 },
+    { 0x80, 0x00, 0x24, 0x34, 0x2C, 0xE4, 0x60, 0x10 },
+    { 0x70, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x38 },
+    { 0x04, 0x02, 0x02, 0x01, 0x79, 0x87, 0x01, 0x80 },
+    { 0x81, 0x83, 0x05, 0x05, 0x03, 0x01, 0x00, 0x00 },
+    { 0x80, 0x43, 0x05, 0xFA, 0x3C, 0xE0, 0x00, 0x00 },
+    { 0x28, 0x28, 0x29, 0x29, 0x3A, 0x18, 0x1C, 0x39 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x40, 0x40 },
+    { 0x80, 0x80, 0x80, 0x00, 0xFC, 0x84, 0x08, 0x08 },
+    { 0x10, 0x20, 0x40, 0x40, 0x80, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1E, 0x60 },
+    { 0x80, 0x00, 0x00, 0x91, 0xA1, 0x80, 0x00, 0x00 },
+    { 0x22, 0x84, 0x40, 0x50, 0x48, 0xC1, 0x3E, 0x00 },
+    { 0x40, 0x41, 0x82, 0xE2, 0x12, 0x0A, 0x06, 0x00 },
+    { 0x80, 0x88, 0x4F, 0x02, 0x22, 0xE2, 0x9F, 0x40 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x1F, 0x14 },
+    { 0x14, 0x10, 0x10, 0x11, 0x1F, 0x10, 0x10, 0x18 },
+    { 0x0F, 0x18, 0x14, 0x10, 0x10, 0x10, 0x10, 0x10 },
+    { 0x14, 0x14, 0x1F, 0x1A, 0x0A, 0x0A, 0x04, 0x00 },
+    { 0x00, 0xF0, 0x10, 0x20, 0x20, 0x40, 0x40, 0x80 },
+    { 0x00, 0x00, 0x06, 0x1A, 0x22, 0xC2, 0x04, 0x04 },
+    { 0x04, 0x07, 0x00, 0xC0, 0x20, 0x10, 0x80, 0x80 },
+    { 0x01, 0x01, 0x02, 0xFC, 0xFE, 0x02, 0x3C, 0x20 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0D, 0x8D },
+    { 0x55, 0x50, 0x94, 0xF0, 0x10, 0x09, 0x08, 0x00 },
+    { 0x80, 0x00, 0x06, 0x09, 0x1B, 0xEE, 0x00, 0x00 },
+    { 0x00, 0x00, 0x81, 0xFE, 0x00, 0x00, 0x00, 0x00 },
+    { 0x0F, 0x18, 0x10, 0x10, 0x1F, 0x19, 0x18, 0x1C },
+    { 0x14, 0x16, 0x15, 0x14, 0x14, 0x14, 0x14, 0x08 },
+    { 0x00, 0x00, 0x00, 0x00, 0x80, 0x40, 0x80, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0xE0, 0x10, 0x20, 0x40 },
+    { 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x01 },
+    { 0x02, 0x04, 0x04, 0x03, 0x80, 0x40, 0x40, 0x20 },
+    { 0x00, 0x01, 0x02, 0x8C, 0x70, 0x00, 0x00, 0x00 },
+    { 0x55, 0x50, 0x94, 0xF0, 0x10, 0x0A, 0x0E, 0x1D },
+    { 0x95, 0x24, 0x24, 0x27, 0x13, 0xE1, 0x01, 0x01 },
+    { 0x01, 0x01, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00 },
+    { 0x14, 0x14, 0x17, 0x14, 0x14, 0x14, 0x14, 0x08 },
+    { 0x00, 0x00, 0xC0, 0x30, 0x08, 0x10, 0x60, 0x80 },
+    { 0x00, 0x80, 0x60, 0x10, 0x08, 0x30, 0xC0, 0x00 },
+    { 0x00, 0x7F, 0x80, 0x40, 0x40, 0x5C, 0x00, 0x01 },
+    { 0x41, 0x01, 0x00, 0x5C, 0x40, 0x40, 0x80, 0x7F },
+    { 0x40, 0x40, 0x80, 0xE1, 0x12, 0x0A, 0x06, 0x00 },
+    { 0x80, 0x00, 0x06, 0x0A, 0x12, 0xE1, 0x80, 0x40 },
+    { 0x0F, 0x18, 0x10, 0x10, 0x1F, 0x11, 0x10, 0x10 },
+    { 0x14, 0x14, 0x1F, 0x1C, 0x14, 0x14, 0x14, 0x08 },
+    { 0x00, 0x7F, 0x90, 0x12, 0x0A, 0x02, 0xF4, 0x09 },
+    { 0x0D, 0xF1, 0x04, 0x02, 0x0A, 0x12, 0x90, 0x7F },
+    { 0x40, 0x40, 0x80, 0xE1, 0x12, 0x0A, 0x06, 0x01 },
+    { 0x81, 0x00, 0x06, 0x0A, 0x12, 0xE1, 0x80, 0x40 },
+    { 0x00, 0x40, 0x40, 0x80, 0x80, 0x04, 0x08, 0x10 },
+    { 0x20, 0x00, 0xC0, 0x30, 0x08, 0x10, 0x60, 0x80 },
+    { 0x10, 0x08, 0x04, 0x80, 0x80, 0x40, 0x40, 0x00 },
+    { 0x08, 0x08, 0x08, 0x08, 0x00, 0x01, 0x01, 0x00 },
+    { 0x00, 0x01, 0x01, 0x08, 0x08, 0x08, 0x08, 0x00 },
+    { 0x80, 0x00, 0x06, 0x0A, 0x12, 0xE1, 0x90, 0x48 },
+    { 0x64, 0x92, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x14, 0x14, 0x1F, 0x18, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0xC0, 0x20, 0x10, 0x10, 0x08, 0x04, 0x02 },
+    { 0x01, 0x0F, 0x90, 0x10, 0x20, 0xF0, 0xF8, 0xF8 },
+    { 0x40, 0x20, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08 },
+    { 0x48, 0x47, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x08, 0x88, 0xC7, 0xC4, 0x62, 0x23, 0x11, 0x3F },
+    { 0x80, 0x40, 0x20, 0x10, 0x88, 0xCC, 0x43, 0x80 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xC0 },
+    { 0x80, 0x80, 0xC0, 0xE1, 0xFE, 0xB8, 0x88, 0x0C },
+    { 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00 },
+    { 0x01, 0x01, 0x01, 0x06, 0x04, 0x04, 0x04, 0x04 },
+    { 0x05, 0x04, 0x04, 0x04, 0x07, 0x07, 0x07, 0x03 },
+    { 0x01, 0x1F, 0xA0, 0x20, 0x40, 0x80, 0x00, 0xF0 },
+    { 0x48, 0x47, 0x88, 0x00, 0x00, 0x00, 0x00, 0x24 },
+    { 0x24, 0x28, 0x6B, 0x40, 0xA0, 0x99, 0x86, 0xFF },
+    { 0x0F, 0x11, 0x22, 0x44, 0x48, 0x4C, 0x43, 0x80 },
+    { 0x04, 0x06, 0x06, 0x06, 0x0E, 0x0E, 0x06, 0x01 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0 },
+    { 0x20, 0x20, 0x10, 0x10, 0x08, 0x08, 0x08, 0x10 },
+    { 0x10, 0x20, 0x20, 0x40, 0x80, 0x00, 0x00, 0x00 },
+    { 0x80, 0x60, 0x10, 0x88, 0x44, 0x22, 0x99, 0x70 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08 },
+    { 0x30, 0xC0, 0x00, 0x00, 0x00, 0x13, 0x0C, 0x08 },
+    { 0x08, 0x04, 0x04, 0x82, 0x39, 0x47, 0x80, 0x00 },
+    { 0x03, 0x02, 0x01, 0x00, 0x00, 0x01, 0xC2, 0x3C },
+    { 0xB0, 0xC0, 0x00, 0x30, 0xD0, 0x50, 0x58, 0x28 },
+    { 0x16, 0x09, 0x80, 0x80, 0x44, 0xC2, 0x62, 0x26 },
+    { 0x44, 0x44, 0x40, 0x43, 0x40, 0x20, 0x17, 0x0C },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01 },
+    { 0x00, 0x00, 0x03, 0x06, 0x07, 0x01, 0x01, 0x01 },
+    { 0x07, 0x05, 0x04, 0x02, 0x01, 0x00, 0x00, 0x00 },
+    { 0x38, 0x48, 0x88, 0x30, 0x20, 0x40, 0x80, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x40 },
+    { 0x20, 0x10, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0xF1, 0x0E, 0x00, 0x00, 0x01 },
+    { 0x02, 0x02, 0x04, 0x04, 0x04, 0x08, 0x08, 0x10 },
+    { 0x20, 0x30, 0x0C, 0x06, 0x01, 0x01, 0x40, 0x40 },
+    { 0x40, 0x40, 0x1D, 0x01, 0x02, 0x1C, 0xE0, 0x00 },
+    { 0xF8, 0x88, 0xC6, 0x61, 0xA0, 0x60, 0x60, 0x50 },
+    { 0x50, 0x30, 0x28, 0x68, 0x44, 0x40, 0x40, 0x40 },
+    { 0x40, 0x40, 0xC0, 0xE0, 0xA0, 0x40, 0x80, 0x8C },
+    { 0x1C, 0x32, 0x22, 0x42, 0x82, 0x01, 0x00, 0x00 },
+    { 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02 },
+    { 0x01, 0x01, 0x02, 0x02, 0x02, 0x01, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1C },
+    { 0x02, 0x05, 0x02, 0x24, 0x04, 0x04, 0x02, 0xA9 },
+    { 0x1E, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x10 },
+    { 0x08, 0x68, 0x10, 0x08, 0x04, 0x03, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x06, 0x82 },
+    { 0x7C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x04, 0x0C, 0x10, 0x10, 0x20, 0x20, 0x20, 0x28 },
+    { 0x3E, 0x1C, 0x20, 0x20, 0x3E, 0x0F, 0x11, 0x1F },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x90, 0x08 },
+    { 0x18, 0x60, 0x10, 0x08, 0x04, 0x03, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0E, 0x82 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x40, 0x20 },
+    { 0x10, 0x90, 0x90, 0x90, 0xA0, 0xC0, 0x80, 0x80 },
+    { 0x80, 0x70, 0x08, 0x14, 0x08, 0x90, 0x10, 0x10 },
+    { 0x08, 0xA4, 0x78, 0x80, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0xFC },
+    { 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00 },
+    { 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08 },
+    { 0x18, 0xEA, 0x10, 0x0F, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03 },
+    { 0x1C, 0x20, 0x20, 0x3C, 0x0F, 0x11, 0x1F, 0x03 },
+    { 0x06, 0x18, 0x20, 0x20, 0x3C, 0x0C, 0x12, 0x1E },
+    { 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x20, 0x20, 0x20, 0x40, 0x80, 0x00, 0x00, 0x00 },
+    { 0x00, 0xE0, 0x10, 0x28, 0x10, 0x20, 0x20, 0x20 },
+    { 0x10, 0x48, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x20, 0xF8 },
+    { 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01 },
+    { 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10 },
+    { 0x30, 0xD5, 0x20, 0x1F, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F },
+    { 0x20, 0x30, 0x0C, 0x02, 0x05, 0x09, 0x12, 0x1E },
+    { 0x02, 0x1C, 0x14, 0x08, 0x10, 0x20, 0x2C, 0x32 },
+    { 0x00, 0xC0, 0x20, 0x10, 0xD0, 0x30, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x40 },
+    { 0x3C, 0x14, 0x04, 0x08, 0x90, 0x18, 0x04, 0x08 },
+    { 0xB0, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x03, 0x04, 0x08, 0x10, 0x11, 0xF9, 0x01 },
+    { 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x80, 0xC8, 0x48, 0x28 },
+    { 0x2A, 0x10, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x02, 0x0C, 0x10, 0x20, 0x28, 0x37, 0x02, 0x02 },
+    { 0x04, 0x08, 0x10, 0x26, 0x2B, 0x32, 0x04, 0x05 },
+    { 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0xE0, 0x10, 0x10, 0xF0, 0x00, 0x00, 0x00 },
+    { 0x40, 0x2C, 0x14, 0x04, 0x08, 0x90, 0x18, 0x04 },
+    { 0x08, 0xB0, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0x48 },
+    { 0x28, 0x2A, 0x10, 0x0F, 0x20, 0x4A, 0x09, 0x10 },
+    { 0x40, 0x40, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0xC0, 0x40, 0x40, 0x80, 0x00, 0x80 },
+    { 0x00, 0x00, 0x00, 0x00, 0x1E, 0x21, 0xF0, 0x04 },
+    { 0x02, 0x02, 0x02, 0x02, 0x03, 0x02, 0x02, 0x04 },
+    { 0x04, 0x04, 0x03, 0x01, 0x00, 0x00, 0x09, 0x01 },
+    { 0x80, 0x80, 0xAB, 0x04, 0xF8, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1C },
+    { 0x20, 0x20, 0x3C, 0x0F, 0x11, 0x1F, 0x02, 0x06 },
+    { 0x18, 0x20, 0x20, 0x38, 0x08, 0x10, 0x18, 0x04 },
+    { 0x04, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00 },
+    { 0x40, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0xE0, 0xA0, 0x20, 0x40, 0x80, 0xC0 },
+    { 0x20, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x3E, 0x41, 0xF0, 0x04 },
+    { 0x02, 0x02, 0x02, 0x03, 0x02, 0x02, 0x02, 0x04 },
+    { 0x04, 0x02, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00 },
+    { 0x40, 0x40, 0x55, 0x82, 0x7C, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x20 },
+    { 0x30, 0x0C, 0x02, 0x05, 0x09, 0x12, 0x1E, 0x04 },
+    { 0x18, 0x10, 0x08, 0x10, 0x20, 0x28, 0x34, 0x06 },
+    { 0x02, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0xE0, 0x10, 0x08, 0x08 },
+    { 0xC8, 0xB0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0x80, 0x40, 0x40, 0x3C, 0x14, 0x04, 0x08, 0x90 },
+    { 0x18, 0x04, 0x08, 0xB0, 0x40, 0x80, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0xC4, 0xA4 },
+    { 0xFC, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00 },
+    { 0xC8, 0x58, 0x28, 0x2A, 0x10, 0x0F, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x09, 0x04 },
+    { 0x04, 0x04, 0x04, 0x02, 0x03, 0x02, 0x01, 0x01 },
+    { 0x02, 0x02, 0x04, 0x08, 0x10, 0x26, 0x2B, 0x32 },
+    { 0x04, 0x05, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0xE0, 0x10, 0x10, 0xF0, 0x00 },
+    { 0x80, 0x80, 0x78, 0x28, 0x08, 0x10, 0x20, 0x30 },
+    { 0x08, 0x10, 0x20, 0x40, 0x80, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x03, 0x04, 0x08, 0x10, 0x11 },
+    { 0xF9, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00 },
+    { 0x10, 0xB0, 0x50, 0x55, 0x20, 0x1F, 0x00, 0x00 },
+    { 0x00, 0x01, 0x02, 0x0C, 0x10, 0x20, 0x28, 0x37 },
+    { 0x02, 0x1E, 0x20, 0x20, 0x18, 0x0C, 0x14, 0x1E },
+    { 0x00, 0x00, 0x00, 0x00, 0x80, 0x40, 0x40, 0x20 },
+    { 0x20, 0x20, 0x20, 0xC0, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x78, 0x8E, 0x09, 0x38, 0x7C, 0x26, 0x82 },
+    { 0xC3, 0x9B, 0x03, 0x1F, 0x17, 0x97, 0x62, 0x00 },
+    { 0x00, 0xF8, 0xC6, 0x83, 0x03, 0x06, 0x3C, 0xCC },
+    { 0x84, 0x85, 0x85, 0xCB, 0x71, 0xC0, 0x00, 0x00 },
+    { 0x00, 0x00, 0x0F, 0xFF, 0x9F, 0x9F, 0x9F, 0x9F },
+    { 0x9E, 0xBE, 0xDF, 0x1F, 0x0E, 0x03, 0x00, 0x00 },
+    { 0xC3, 0x9B, 0x83, 0x1B, 0x1F, 0x97, 0xE2, 0x80 },
+    { 0xF0, 0x8C, 0x02, 0x63, 0x93, 0x0E, 0x0C, 0x0C },
+    { 0x94, 0x65, 0x8D, 0x9B, 0x71, 0xC9, 0x30, 0x00 },
+    { 0x00, 0x3B, 0x47, 0x9F, 0xBF, 0xBF, 0xBF, 0xDF },
+    { 0x0E, 0x1E, 0x7F, 0x9F, 0x8E, 0x47, 0x24, 0x18 },
+    { 0x20, 0x20, 0x60, 0xC0, 0x00, 0x00, 0x00, 0x00 },
+    { 0x60, 0x98, 0x0E, 0x39, 0x7C, 0x24, 0x82, 0xC3 },
+    { 0x9B, 0x83, 0x1B, 0x03, 0x9F, 0xE6, 0x80, 0x00 },
+    { 0x70, 0x88, 0xC5, 0x23, 0x12, 0x12, 0x14, 0x2C },
+    { 0xFD, 0x65, 0x45, 0x8F, 0x99, 0x74, 0xC4, 0x38 },
+    { 0x3C, 0x46, 0x41, 0x3D, 0x3E, 0x1E, 0x1E, 0x1F },
+    { 0x0F, 0x0E, 0x0E, 0x1F, 0x21, 0x20, 0x30, 0x1F },
+    { 0x00, 0x00, 0x80, 0x40, 0x20, 0x10, 0x90, 0xC8 },
+    { 0xC8, 0xC8, 0xD8, 0xF0, 0xC8, 0x88, 0x08, 0xF0 },
+    { 0x18, 0x26, 0x43, 0xCE, 0x9F, 0x89, 0x20, 0x30 },
+    { 0x66, 0x60, 0x46, 0xC0, 0x67, 0x39, 0xE1, 0x1E },
+    { 0x1C, 0xA2, 0x71, 0x48, 0x84, 0x84, 0x85, 0xCB },
+    { 0xFF, 0x99, 0x91, 0xE3, 0x66, 0x1D, 0x30, 0xC0 },
+    { 0x0F, 0x11, 0x10, 0x0F, 0x0F, 0x07, 0x07, 0x07 },
+    { 0x03, 0x03, 0x03, 0x07, 0x08, 0x08, 0x0C, 0x07 },
+    { 0x04, 0x04, 0x04, 0xE4, 0xB4, 0xB4, 0xBC, 0xB8 },
+    { 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0 },
+    { 0xB0, 0xB0, 0xB0, 0xBE, 0xB4, 0xB4, 0xBC, 0x34 },
+    { 0xE4, 0x8E, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE0, 0xA0 },
+    { 0xA0, 0xA0, 0xE0, 0x20, 0xA0, 0x20, 0xA0, 0x20 },
+    { 0xA0, 0x20, 0xA0, 0x20, 0xA0, 0x20, 0xA0, 0x20 },
+    { 0xA0, 0x20, 0xA0, 0x20, 0xA0, 0x20, 0xA0, 0xA0 },
+    { 0xA0, 0xA0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0xC0, 0xE0, 0x60, 0x60, 0x60, 0x60 },
+    { 0x00, 0xF8, 0x08, 0x08, 0x0C, 0x84, 0xE4, 0x34 },
+    { 0x12, 0x02, 0x03, 0x00, 0x0F, 0x08, 0x08, 0x08 },
+    { 0x08, 0x08, 0x08, 0x08, 0xC8, 0xE8, 0x88, 0x88 },
+    { 0xC8, 0x68, 0xE8, 0x08, 0x08, 0x08, 0x0F, 0x00 },
+    { 0x00, 0x00, 0x00, 0xF8, 0x08, 0x08, 0x08, 0xF8 },
+    { 0x00, 0xF8, 0x08, 0x08, 0x08, 0xF8, 0x00, 0xF8 },
+    { 0x08, 0x08, 0x08, 0x08, 0xF8, 0x00, 0x00, 0x00 },
+    { 0x02, 0x02, 0x02, 0xFA, 0x1A, 0x1A, 0x2A, 0x2A },
+    { 0x4A, 0x4A, 0x8A, 0x8A, 0x0A, 0x8A, 0x8A, 0x4A },
+    { 0x4A, 0x2A, 0x2A, 0x1A, 0xFA, 0x02, 0xFF, 0x02 },
+    { 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0xFF, 0x3F, 0x40, 0x00, 0xFF, 0x00 },
+    { 0x00, 0x00, 0x00, 0x80, 0x00, 0x40, 0x41, 0x7F },
+    { 0x40, 0x40, 0x40, 0x40, 0x7E, 0x41, 0x41, 0x41 },
+    { 0x41, 0x7F, 0x41, 0x71, 0x5D, 0x47, 0x41, 0x41 },
+    { 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41 },
+    { 0x7F, 0x40, 0x5C, 0x5F, 0x53, 0x40, 0x41, 0xC1 },
+    { 0x5C, 0x5F, 0x51, 0x40, 0x40, 0x40, 0x40, 0x40 },
+    { 0x40, 0x40, 0x40, 0x7F, 0x40, 0xC0, 0x40, 0x7F },
+    { 0x40, 0x7F, 0x40, 0x40, 0x40, 0x7F, 0x40, 0x7F },
+    { 0x40, 0x40, 0x40, 0x40, 0x7F, 0x40, 0x40, 0xC0 },
+    { 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40 },
+    { 0x40, 0x40, 0x40, 0x5F, 0x50, 0x58, 0x58, 0x54 },
+    { 0x54, 0x52, 0x52, 0x51, 0x51, 0x51, 0x52, 0x52 },
+    { 0x54, 0x54, 0x58, 0x58, 0x5F, 0x40, 0x7F, 0x40 },
+    { 0x40, 0xC0, 0x40, 0x40, 0x7F, 0x40, 0x80, 0x00 },
+    { 0x80, 0x00, 0xFF, 0x00, 0x55, 0x00, 0xFF, 0x00 },
+    { 0x80, 0x80, 0x80, 0x87, 0xC3, 0xB7, 0x80, 0x80 },
+    { 0x9C, 0xA2, 0xC1, 0xC9, 0xD9, 0xBA, 0x9C, 0x98 },
+    { 0x98, 0x98, 0x98, 0x9C, 0xBA, 0xD9, 0xD9, 0xD9 },
+    { 0xBA, 0x9C, 0x98, 0x98, 0x98, 0x98, 0x9C, 0xBA },
+    { 0xD9, 0xC9, 0xC1, 0xA2, 0x9C, 0x80, 0x9F, 0x91 },
+    { 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90 },
+    { 0x90, 0x90, 0x90, 0x90, 0x90, 0x9F, 0x90, 0x90 },
+    { 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x9F },
+    { 0x84, 0xBC, 0x80, 0x9C, 0xA2, 0xC1, 0xC9, 0xD9 },
+    { 0xD9, 0xD9, 0xD9, 0xBA, 0x9C, 0x98, 0x98, 0x98 },
+    { 0x98, 0x9C, 0xBA, 0xD9, 0xC9, 0xC1, 0xA2, 0x9C },
+    { 0x80, 0x8F, 0x93, 0xA3, 0x83, 0x83, 0x83, 0x87 },
+    { 0x83, 0x83, 0x9F, 0x8E, 0x87, 0x82, 0x83, 0x82 },
+    { 0x00, 0x00, 0xFF, 0x23, 0x45, 0xFF, 0x00, 0x00 },
+    { 0x80, 0x80, 0xFF, 0xA2, 0xC4, 0xFF, 0x80, 0x80 },
+    { 0x40, 0x40, 0x40, 0xFF, 0x23, 0x45, 0xFF, 0x41 },
+    { 0x9C, 0xA2, 0xC1, 0xFF, 0xA2, 0xC4, 0xFF, 0x98 },
+    { 0x41, 0xFF, 0x23, 0x45, 0xFF, 0x41, 0x41, 0x41 },
+    { 0xBA, 0xFF, 0xA2, 0xC4, 0xFF, 0x98, 0x9C, 0xBA },
+    { 0xFF, 0x23, 0x45, 0xFF, 0x40, 0x40, 0x40, 0x40 },
+    { 0xFF, 0xA2, 0xC4, 0xFF, 0x90, 0x90, 0x90, 0x90 },
+    { 0x00, 0x00, 0x0C, 0x0C, 0xF8, 0x00, 0x00, 0x00 },
+    { 0xFF, 0x23, 0x45, 0xFF, 0x40, 0x7F, 0x40, 0x7F },
+    { 0x82, 0x86, 0x9C, 0xFF, 0xBD, 0xB6, 0x92, 0x93 },
+    { 0x91, 0x80, 0x80, 0x87, 0xC3, 0xB7, 0x80, 0x80 },
+    { 0x02, 0x02, 0x82, 0x72, 0xDA, 0x5A, 0x5E, 0x5C },
+    { 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58 },
+    { 0x58, 0x58, 0x58, 0x5F, 0x5A, 0x5A, 0xDE, 0x1A },
+    { 0x72, 0x47, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40 },
+    { 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xF0, 0x50 },
+    { 0x50, 0x50, 0x70, 0x10, 0x50, 0x10, 0x50, 0x10 },
+    { 0x50, 0x10, 0x50, 0x10, 0x50, 0x10, 0x50, 0x10 },
+    { 0x50, 0x10, 0x50, 0x10, 0x50, 0x10, 0xD0, 0x50 },
+    { 0xD0, 0xD0, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0xE0, 0xF0, 0x30, 0x30, 0xB0, 0x30 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80 },
+    { 0x80, 0xFC, 0x84, 0x84, 0x86, 0xC2, 0xF2, 0x9A },
+    { 0x89, 0x81, 0x81, 0x80, 0x87, 0x84, 0x84, 0x84 },
+    { 0x84, 0x04, 0x04, 0x84, 0xE4, 0x74, 0xC4, 0xC4 },
+    { 0x64, 0xB4, 0xF4, 0x04, 0x04, 0x04, 0x07, 0x00 },
+    { 0x00, 0x00, 0x00, 0xFC, 0x04, 0x04, 0x04, 0xFC },
+    { 0x00, 0xFC, 0x04, 0x04, 0x04, 0xFC, 0x00, 0xFC },
+    { 0x04, 0x04, 0x04, 0x04, 0xFC, 0x00, 0x00, 0x00 },
+    { 0x01, 0x01, 0x01, 0xFD, 0x0D, 0x0D, 0x15, 0x15 },
+    { 0x25, 0x25, 0x45, 0xC5, 0x85, 0xC5, 0x45, 0x25 },
+    { 0x25, 0x15, 0x15, 0x0D, 0xFD, 0x01, 0xFF, 0x01 },
+    { 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0xFF, 0x1F, 0xA0, 0x00, 0xFF, 0x00 },
+    { 0x00, 0x00, 0x00, 0xC0, 0x80, 0xA0, 0x20, 0xBF },
+    { 0x20, 0xE0, 0x20, 0x20, 0xBF, 0xA0, 0x60, 0x60 },
+    { 0x20, 0x3F, 0x20, 0x38, 0x2E, 0x23, 0x20, 0x20 },
+    { 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20 },
+    { 0x3F, 0x20, 0x2E, 0x2F, 0x29, 0x20, 0xA0, 0xE0 },
+    { 0x2E, 0x2F, 0x28, 0x20, 0x20, 0x20, 0x20, 0x20 },
+    { 0x20, 0x20, 0x20, 0x3F, 0x20, 0xE0, 0x20, 0x3F },
+    { 0x20, 0x3F, 0x20, 0x20, 0x20, 0x3F, 0x20, 0x3F },
+    { 0x20, 0x20, 0x20, 0x20, 0x3F, 0xFF, 0x23, 0x45 },
+    { 0xFF, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20 },
+    { 0x20, 0x20, 0x20, 0x2F, 0x28, 0x2C, 0x2C, 0x2A },
+    { 0x2A, 0x29, 0x29, 0x28, 0x28, 0x28, 0x29, 0x29 },
+    { 0x2A, 0x2A, 0x2C, 0x2C, 0x2F, 0x20, 0x3F, 0x20 },
+    { 0x20, 0xA0, 0xA0, 0xA0, 0xBF, 0xA0, 0xC0, 0x80 },
+    { 0xC0, 0x80, 0xFF, 0x00, 0xAA, 0x00, 0xFF, 0x00 },
+    { 0x80, 0x80, 0x80, 0x83, 0xA1, 0x9B, 0x80, 0x81 },
+    { 0x9F, 0xFF, 0xDF, 0xCB, 0xD9, 0xBA, 0x9C, 0x98 },
+    { 0xD9, 0xC9, 0xC1, 0xA2, 0x9C, 0x80, 0x8F, 0x88 },
+    { 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88 },
+    { 0x88, 0x88, 0x88, 0x88, 0x88, 0x8F, 0x88, 0x88 },
+    { 0x88, 0x88, 0x88, 0x88, 0x88, 0xFF, 0xA2, 0xC4 },
+    { 0xFF, 0x9E, 0x80, 0x9C, 0xA2, 0xC1, 0xC9, 0xD9 },
+    { 0x80, 0x87, 0x89, 0x91, 0x81, 0x81, 0x81, 0x83 },
+    { 0x81, 0x81, 0x8F, 0x87, 0x83, 0x81, 0x81, 0x81 },
+    { 0x00, 0x00, 0x00, 0xC0, 0x80, 0xA0, 0x20, 0x3F },
+    { 0x20, 0x20, 0x20, 0x20, 0x3F, 0x20, 0x20, 0x20 },
+    { 0x20, 0xA0, 0xA0, 0x20, 0x20, 0x20, 0xF0, 0x20 },
+    { 0x20, 0x20, 0x20, 0x20, 0x3F, 0x20, 0x20, 0xE0 },
+    { 0x20, 0x20, 0x20, 0x2F, 0x28, 0xFF, 0x23, 0x45 },
+    { 0xFF, 0x29, 0x29, 0x28, 0x28, 0x28, 0x29, 0x29 },
+    { 0x80, 0x80, 0x80, 0x83, 0xA1, 0x9B, 0x80, 0x80 },
+    { 0xBA, 0x9C, 0x99, 0x9B, 0xFE, 0xFF, 0xDF, 0xBE },
+    { 0xDF, 0xCF, 0xC7, 0xA3, 0x9D, 0x81, 0x8F, 0x88 },
+    { 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8F },
+    { 0x82, 0x9E, 0x80, 0x9C, 0xA2, 0xC1, 0xC9, 0xD9 },
+    { 0xBA, 0x9C, 0x98, 0x98, 0x98, 0xFF, 0xA2, 0xC4 },
+    { 0xFF, 0xD9, 0xD9, 0xBA, 0x9C, 0x98, 0x98, 0x98 },
+    { 0x2E, 0x2F, 0x28, 0xA0, 0xA0, 0x20, 0xA0, 0xF8 },
+    { 0xE0, 0x20, 0x20, 0x3F, 0x20, 0xE0, 0x20, 0x3F },
+    { 0x2A, 0x2A, 0x2C, 0x2C, 0xFF, 0x23, 0x45, 0xFF },
+    { 0x88, 0x88, 0x88, 0x88, 0x89, 0x8F, 0xFF, 0xFF },
+    { 0x9F, 0x8E, 0x8E, 0x8E, 0x8A, 0x8F, 0x89, 0x89 },
+    { 0x89, 0x89, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88 },
+    { 0x98, 0x9C, 0xBA, 0xD9, 0xFF, 0xA2, 0xC4, 0xFF },
+    { 0x20, 0x20, 0x20, 0x20, 0xBF, 0xA0, 0x20, 0xE0 },
+    { 0xC0, 0x80, 0xFF, 0xFF, 0x23, 0x45, 0xFF, 0x00 },
+    { 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89 },
+    { 0x8B, 0x8E, 0x9C, 0xFC, 0xCF, 0xF9, 0x98, 0x8F },
+    { 0x86, 0x9E, 0x83, 0x9C, 0xA2, 0xC1, 0xC9, 0xD9 },
+    { 0x81, 0x81, 0x8F, 0xFF, 0xA2, 0xC4, 0xFF, 0x81 },
+    { 0x00, 0x00, 0x00, 0x80, 0x80, 0x40, 0x40, 0x20 },
+    { 0x20, 0x10, 0x10, 0x08, 0x08, 0x10, 0x10, 0x20 },
+    { 0x20, 0x40, 0x40, 0x80, 0x80, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x88, 0x88, 0x5D, 0x5D, 0x3E },
+    { 0x3E, 0x7C, 0x7C, 0xF8, 0xF8, 0x7C, 0x7C, 0x3E },
+    { 0x3E, 0x5D, 0x5D, 0x88, 0x88, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02 },
+    { 0x02, 0x04, 0x04, 0x08, 0x08, 0x04, 0x04, 0x02 },
+    { 0x00, 0x00, 0x00, 0x80, 0x80, 0xC0, 0xC0, 0xE0 },
+    { 0xE0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF0, 0xF0, 0xE0 },
+    { 0xE0, 0xC0, 0xC0, 0x80, 0x80, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x88, 0x88, 0x55, 0x55, 0x23 },
+    { 0x23, 0x47, 0x47, 0x8F, 0x8F, 0x47, 0x47, 0x23 },
+    { 0x23, 0x55, 0x55, 0x88, 0x88, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x88, 0x88, 0xD5, 0xD5, 0xE2 },
+    { 0xE2, 0xC4, 0xC4, 0x88, 0x88, 0xC4, 0xC4, 0xE2 },
+    { 0xE2, 0xD5, 0xD5, 0x88, 0x88, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03 },
+    { 0x03, 0x07, 0x07, 0x0F, 0x0F, 0x07, 0x07, 0x03 },
+    { 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x80, 0x80, 0x40, 0xC0, 0x60 },
+    { 0xA0, 0x50, 0xB0, 0x58, 0xA8, 0x50, 0xB0, 0x60 },
+    { 0xA0, 0x40, 0xC0, 0x80, 0x80, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x88, 0x88, 0x5D, 0xD5, 0x6B },
+    { 0xB6, 0x6D, 0xD6, 0xAD, 0xDA, 0x6D, 0xD6, 0x6B },
+    { 0xB6, 0x5D, 0xD5, 0x88, 0x88, 0x00, 0x00, 0x00 },
+    { 0x02, 0x05, 0x06, 0x0D, 0x0A, 0x05, 0x06, 0x03 },
+    { 0x00, 0x00, 0x00, 0xC0, 0xE0, 0xE0, 0x70, 0xF0 },
+    { 0xF0, 0xF0, 0xF0, 0x90, 0x90, 0xF0, 0xF0, 0xF0 },
+    { 0xF0, 0x70, 0xE0, 0xE0, 0xC0, 0x00, 0x00, 0x00 },
+    { 0x80, 0xF8, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0xE6 },
+    { 0xC3, 0xC3, 0xE6, 0xFF, 0xFF, 0xFE, 0xF7, 0xE3 },
+    { 0xF6, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xF8, 0x80 },
+    { 0x07, 0x0F, 0x0F, 0x0F, 0x07, 0x01, 0x00, 0x00 },
+    { 0x00, 0x00, 0x01, 0x07, 0x0F, 0x0F, 0x0F, 0x07 },
+    { 0xC0, 0x20, 0x20, 0x20, 0xA0, 0x20, 0x20, 0x20 },
+    { 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0 },
+    { 0x0F, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 },
+    { 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x06, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 },
+    { 0x06, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+};
+
+// pet_animiations: 54 frames, 32x32
+static const uint16_t PROGMEM pet_sprite_map[54][16] = {
+    { 0, 1, 0, 0, 0, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 },
+    { 13, 14, 15, 0, 0, 16, 17, 18, 19, 20, 21, 22, 9, 10, 11, 23 },
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 24, 25, 26, 0, 27, 28, 29, 0, 30, 31, 32, 33, 34, 35, 36, 37 },
+    { 0, 38, 39, 0, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51 },
+    { 52, 53, 54, 0, 55, 56, 57, 39, 44, 58, 59, 60, 48, 49, 50, 51 },
+    { 0, 61, 62, 0, 0, 63, 64, 0, 65, 66, 67, 68, 48, 49, 69, 70 },
+    { 0, 71, 72, 0, 0, 73, 74, 0, 65, 66, 67, 68, 48, 49, 69, 70 },
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 75, 76, 77, 78, 79, 63, 64, 80, 65, 81, 82, 83, 48, 84, 85, 86 },
+    { 0, 61, 62, 0, 0, 63, 64, 0, 65, 66, 67, 68, 48, 49, 69, 70 },
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 87, 88, 0, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 0 },
+    { 0, 0, 87, 99, 0, 100, 101, 102, 103, 104, 94, 105, 106, 97, 98, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 107, 108, 109, 0, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 0 },
+    { 121, 0, 0, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134 },
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 135, 136, 137, 0, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149 },
+    { 0, 0, 0, 0, 0, 150, 151, 152, 153, 154, 155, 156, 146, 147, 157, 149 },
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 158, 159, 160, 0, 161, 162, 163, 0, 107, 164, 165, 54, 166, 167, 168, 169 },
+    { 0, 170, 0, 0, 171, 172, 173, 54, 174, 175, 176, 177, 166, 167, 178, 179 },
+    { 180, 181, 182, 0, 183, 184, 185, 0, 174, 186, 187, 188, 166, 167, 178, 189 },
+    { 0, 190, 191, 0, 0, 192, 193, 0, 107, 194, 195, 54, 166, 167, 196, 197 },
+    { 0, 190, 191, 0, 0, 198, 199, 0, 107, 200, 201, 54, 166, 167, 196, 197 },
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 202, 203, 191, 204, 205, 192, 193, 206, 107, 194, 207, 208, 166, 167, 196, 209 },
+    { 0, 61, 62, 0, 0, 63, 64, 0, 65, 66, 67, 68, 48, 49, 69, 70 },
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 210, 211, 107, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 0 },
+    { 0, 0, 210, 222, 107, 212, 223, 224, 225, 216, 217, 226, 0, 220, 221, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 227, 228, 229, 0, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 0 },
+    { 241, 0, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 0, 253, 254 },
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 255, 256, 257, 258, 259, 260, 261, 9, 262, 263, 0 },
+    { 0, 0, 0, 0, 0, 255, 256, 257, 264, 265, 266, 261, 9, 262, 263, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 255, 256, 257, 258, 259, 260, 261, 9, 262, 263, 0 },
+    { 0, 0, 0, 0, 0, 255, 256, 257, 264, 265, 266, 261, 9, 262, 263, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278 },
+    { 0, 0, 0, 0, 242, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 278 },
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 289, 290, 291, 292, 293, 294, 295, 296, 106, 297, 298, 299 },
+    { 0, 0, 0, 0, 300, 290, 301, 302, 293, 294, 303, 304, 106, 297, 298, 299 },
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 242, 305, 306, 54, 307, 308, 309, 310, 311, 312, 313, 314 },
+    { 0, 0, 0, 0, 242, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325 },
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 326, 327, 328, 329, 330, 331, 107, 332, 333, 334, 335, 336 },
+    { 0, 0, 0, 0, 337, 107, 338, 339, 340, 341, 106, 342, 0, 343, 344, 278 },
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+};
+#define PET_SPRITE_TILES 16
+#define PET_SPRITE { .map = &pet_sprite_map[0][0], .width = 4, .pages = 4, .frames = 54 }
+#define PET_SPRITE_PETS 3
+#define PET_SPRITE_ANIMATIONS 6
+#define PET_SPRITE_ANIMATION_FRAMES 3
+#define PET_SPRITE_FRAME(pet, animation, animation_frame) (((pet) * PET_SPRITE_ANIMATIONS + (animation)) * PET_SPRITE_ANIMATION_FRAMES + (animation_frame))
+
+// mario_animation: 4 frames, 16x32
+static const uint16_t PROGMEM mario_sprite_map[4][8] = {
+    { 345, 346, 347, 348, 349, 350, 351, 352 },
+    { 345, 346, 347, 353, 354, 355, 356, 357 },
+    { 345, 358, 359, 360, 361, 362, 363, 364 },
+    { 365, 366, 367, 368, 369, 370, 371, 372 },
+};
+#define MARIO_SPRITE_TILES 8
+#define MARIO_SPRITE { .map = &mario_sprite_map[0][0], .width = 2, .pages = 4, .frames = 4 }
+
+// train_animation: 10 frames, 128x32
+static const uint16_t PROGMEM train_sprite_map[10][64] = {
+    { 0, 0, 0, 0, 373, 374, 375, 376, 377, 377, 378, 379, 380, 381, 382, 383, 0, 0, 0, 384, 385, 386, 387, 388, 389, 390, 118, 391, 392, 393, 394, 395, 0, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410, 377, 411, 412, 413, 414, 415, 416, 417, 416, 418, 419, 414, 420, 421, 422, 423 },
+    { 0, 0, 0, 0, 373, 374, 375, 376, 377, 377, 378, 379, 380, 381, 382, 383, 0, 0, 0, 384, 385, 386, 387, 388, 389, 390, 118, 391, 392, 393, 394, 395, 424, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410, 425, 411, 412, 413, 414, 415, 416, 417, 416, 418, 419, 414, 420, 421, 422, 423 },
+    { 0, 0, 0, 0, 373, 374, 375, 376, 377, 377, 378, 379, 380, 381, 382, 383, 0, 0, 0, 384, 385, 386, 387, 388, 389, 390, 118, 391, 392, 393, 394, 395, 0, 396, 426, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410, 377, 411, 427, 413, 414, 415, 416, 417, 416, 418, 419, 414, 420, 421, 422, 423 },
+    { 0, 0, 0, 0, 373, 374, 375, 376, 377, 377, 378, 379, 380, 381, 382, 383, 0, 0, 0, 384, 385, 386, 387, 388, 389, 390, 118, 391, 392, 393, 394, 395, 0, 396, 397, 398, 428, 400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410, 377, 411, 412, 413, 429, 415, 416, 417, 416, 418, 419, 414, 420, 421, 422, 423 },
+    { 0, 0, 0, 0, 373, 374, 375, 376, 377, 377, 378, 379, 380, 381, 382, 383, 0, 0, 0, 384, 385, 386, 387, 388, 389, 390, 118, 391, 392, 393, 394, 395, 0, 396, 397, 398, 399, 400, 430, 402, 403, 404, 405, 406, 407, 408, 409, 410, 377, 411, 412, 413, 414, 415, 431, 417, 416, 418, 419, 414, 420, 421, 422, 423 },
+    { 0, 0, 0, 0, 373, 374, 375, 376, 377, 377, 378, 379, 380, 381, 382, 383, 0, 0, 0, 384, 385, 386, 387, 388, 389, 390, 118, 391, 392, 393, 394, 395, 432, 396, 397, 398, 399, 400, 401, 402, 433, 404, 405, 406, 407, 408, 409, 410, 434, 435, 412, 413, 414, 415, 416, 417, 431, 418, 419, 414, 420, 421, 422, 423 },
+    { 0, 0, 0, 0, 436, 437, 438, 439, 405, 405, 440, 441, 442, 443, 444, 445, 0, 446, 447, 448, 449, 450, 451, 452, 453, 454, 238, 455, 456, 457, 458, 459, 0, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 377, 475, 476, 413, 414, 477, 478, 479, 478, 480, 481, 414, 420, 421, 482, 483 },
+    { 0, 0, 0, 0, 436, 437, 438, 439, 405, 405, 440, 441, 442, 443, 444, 445, 0, 446, 447, 448, 449, 450, 451, 452, 453, 454, 238, 455, 456, 457, 458, 459, 0, 484, 485, 462, 486, 464, 465, 466, 467, 487, 463, 488, 489, 472, 473, 474, 377, 490, 412, 413, 491, 492, 478, 479, 478, 493, 494, 495, 496, 421, 482, 483 },
+    { 0, 0, 0, 0, 436, 437, 438, 439, 405, 405, 440, 441, 442, 443, 444, 445, 0, 446, 447, 448, 449, 450, 451, 452, 453, 454, 238, 455, 456, 457, 458, 459, 0, 484, 485, 462, 463, 464, 497, 498, 467, 487, 463, 470, 471, 499, 473, 474, 377, 490, 412, 413, 414, 477, 500, 501, 502, 493, 494, 414, 420, 503, 482, 483 },
+    { 0, 0, 0, 0, 436, 437, 438, 439, 405, 405, 440, 441, 442, 443, 444, 445, 0, 446, 447, 448, 449, 450, 451, 452, 453, 454, 238, 455, 456, 457, 458, 459, 0, 484, 485, 462, 463, 464, 465, 466, 467, 504, 463, 470, 471, 472, 473, 505, 377, 490, 412, 413, 414, 477, 478, 479, 506, 507, 508, 414, 420, 421, 482, 509 },
+};
+#define TRAIN_SPRITE_TILES 64
+#define TRAIN_SPRITE { .map = &train_sprite_map[0][0], .width = 16, .pages = 4, .frames = 10 }
+
+// tri_layer_image: 7 frames, 24x24
+static const uint16_t PROGMEM tri_layer_sprite_map[7][9] = {
+    { 510, 511, 512, 513, 514, 515, 516, 517, 325 },
+    { 518, 519, 520, 521, 522, 523, 516, 517, 325 },
+    { 510, 511, 512, 524, 525, 526, 527, 528, 529 },
+    { 530, 531, 532, 533, 534, 535, 527, 536, 325 },
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 537, 538, 539, 540, 541, 542, 543, 0, 544 },
+    { 0, 545, 546, 547, 548, 549, 275, 550, 551 },
+};
+#define TRI_LAYER_SPRITE_TILES 9
+#define TRI_LAYER_SPRITE { .map = &tri_layer_sprite_map[0][0], .width = 3, .pages = 3, .frames = 7 }
+// clang-format on
@@ -34,6 +34,15 @@
 #ifdef LAYER_MAP_ENABLE
 #    include "layer_map.h"
 #endif
+#ifdef CUSTOM_SPLIT_TRANSPORT_SYNC
+#    include "split/transport_stats.h"
+#endif
+#ifdef OLED_CAPTURE_ENABLE
+#    include "oled_capture.h"
+#endif // OLED_CAPTURE_ENABLE
+#include "oled_profiler.h"
+// Generated from oled_assets.h with encode_sprites.py
+#include "oled_sprites.h"
 
 #ifndef OLED_BRIGHTNESS_STEP
 #    define OLED_BRIGHTNESS_STEP 32
@@ -47,25 +56,343 @@ extern uint8_t         oled_rotation_width;
 deferred_token         kittoken;
 
 extern uint8_t         oled_buffer[OLED_MATRIX_SIZE];
+extern uint8_t        *oled_cursor;
 extern OLED_BLOCK_TYPE oled_dirty;
 
-void oled_pan_section(bool left, uint16_t y_start, uint16_t y_end, uint16_t x_start, uint16_t x_end) {
-    uint16_t i = 0;
-    for (uint16_t y = y_start; y < y_end; y++) {
-        if (left) {
-            for (uint16_t x = x_start; x < x_end - 1; x++) {
-                i              = y * oled_rotation_width + x;
-                oled_buffer[i] = oled_buffer[i + 1];
-                oled_dirty |= ((OLED_BLOCK_TYPE)1 << (i / OLED_BLOCK_SIZE));
-            }
+#define OLED_SCROLL_MAX_WIDTH (OLED_DISPLAY_WIDTH > OLED_DISPLAY_HEIGHT ? OLED_DISPLAY_WIDTH : OLED_DISPLAY_HEIGHT)
+#define OLED_SCROLL_MAX_PAGES (OLED_SCROLL_MAX_WIDTH / 8)
+
+/**
+ * @brief Gets a page from a column being scrolled, either wrapping around, or blank past the ends
+ *
+ */
+static uint8_t oled_scroll_get_page(const uint8_t *column, int16_t page, uint8_t pages, bool wrap) {
+    if (wrap) {
+        page %= pages;
+        return column[page < 0 ? page + pages : page];
+    }
+    return (page >= 0 && page < pages) ? column[page] : 0;
+}
+
+/**
+ * @brief Dirty blocks covering part of a page row
+ *
+ * @param page page (8 pixel row)
+ * @param x_start first column
+ * @param x_end column after the end
+ * @return OLED_BLOCK_TYPE
+ */
+static OLED_BLOCK_TYPE oled_dirty_span(uint8_t page, uint8_t x_start, uint8_t x_end) {
+    OLED_BLOCK_TYPE dirty = 0;
+    uint16_t        first = (page * oled_rotation_width + x_start) / OLED_BLOCK_SIZE;
+    uint16_t        last  = (page * oled_rotation_width + x_end - 1) / OLED_BLOCK_SIZE;
+    for (uint16_t block = first; block <= last; block++) {
+        dirty |= ((OLED_BLOCK_TYPE)1 << block);
+    }
+    return dirty;
+}
+
+/**
+ * @brief Scrolls a region of the oled buffer
+ *
+ * Horizontal scrolling moves each page row with a single memmove, and vertical scrolling shifts each column by
+ * pixels, across pages. The dirty blocks for the region are computed once, rather than for every byte.
+ *
+ * @param direction which way to move the contents of the region
+ * @param amount how many pixels to move it by
+ * @param wrap wrap the contents around to the other side, rather than clearing the uncovered area
+ * @param x_start first column of the region
+ * @param x_end column after the end of the region
+ * @param page_start first page (8 pixel row) of the region
+ * @param page_end page after the end of the region
+ */
+void oled_scroll_region(oled_scroll_direction_t direction, uint8_t amount, bool wrap, uint8_t x_start, uint8_t x_end,
+                        uint8_t page_start, uint8_t page_end) {
+    uint8_t max_pages = OLED_MATRIX_SIZE / oled_rotation_width;
+    x_end             = MIN(x_end, oled_rotation_width);
+    page_end          = MIN(page_end, max_pages);
+    if (x_start >= x_end || page_start >= page_end || !amount) {
+        return;
+    }
+    uint8_t width = x_end - x_start, pages = page_end - page_start;
+
+    if (direction == OLED_SCROLL_LEFT || direction == OLED_SCROLL_RIGHT) {
+        if (wrap) {
+            amount %= width;
         } else {
-            for (uint16_t x = x_end - 1; x >= x_start; x--) {
-                i              = y * oled_rotation_width + x;
-                oled_buffer[i] = oled_buffer[i - 1];
-                oled_dirty |= ((OLED_BLOCK_TYPE)1 << (i / OLED_BLOCK_SIZE));
+            amount = MIN(amount, width);
+        }
+        uint8_t saved[OLED_SCROLL_MAX_WIDTH];
+        uint8_t kept = width - amount;
+        for (uint8_t page = page_start; page < page_end; page++) {
+            uint8_t *row = &oled_buffer[page * oled_rotation_width + x_start];
+            if (direction == OLED_SCROLL_LEFT) {
+                memcpy(saved, row, amount);
+                memmove(row, &row[amount], kept);
+                if (wrap) {
+                    memcpy(&row[kept], saved, amount);
+                } else {
+                    memset(&row[kept], 0, amount);
+                }
+            } else {
+                memcpy(saved, &row[kept], amount);
+                memmove(&row[amount], row, kept);
+                if (wrap) {
+                    memcpy(row, saved, amount);
+                } else {
+                    memset(row, 0, amount);
+                }
+            }
+        }
+    } else {
+        uint8_t column[OLED_SCROLL_MAX_PAGES];
+        int16_t shift = (direction == OLED_SCROLL_UP) ? amount : -(int16_t)amount;
+        if (wrap) {
+            shift %= (pages * 8);
+        }
+        for (uint8_t x = x_start; x < x_end; x++) {
+            for (uint8_t page = 0; page < pages; page++) {
+                column[page] = oled_buffer[(page_start + page) * oled_rotation_width + x];
+            }
+            for (uint8_t page = 0; page < pages; page++) {
+                // each page is the 8 pixels starting at (page * 8 + shift) in the original column
+                int16_t bit    = (page * 8) + shift;
+                int16_t source = (bit < 0) ? -((7 - bit) / 8) : (bit / 8);
+                uint8_t offset = bit - (source * 8);
+                uint8_t value  = oled_scroll_get_page(column, source, pages, wrap) >> offset;
+                if (offset) {
+                    value |= oled_scroll_get_page(column, source + 1, pages, wrap) << (8 - offset);
+                }
+                oled_buffer[(page_start + page) * oled_rotation_width + x] = value;
+            }
+        }
+    }
+
+    OLED_BLOCK_TYPE dirty = 0;
+    for (uint8_t page = page_start; page < page_end; page++) {
+        dirty |= oled_dirty_span(page, x_start, x_end);
+    }
+    oled_dirty |= dirty;
+}
+
+/**
+ * @brief Retained state for a status widget
+ *
+ * Each widget keeps a compact key of everything it displays, and only writes to the oled buffer when that key (or
+ * where it is drawn) changes. Bumping the generation forces every widget to redraw on the next pass.
+ */
+typedef struct {
+    uint32_t key;
+    uint8_t  col;
+    uint8_t  line;
+    uint8_t  generation;
+} oled_widget_t;
+
+static uint8_t oled_widget_generation = 1;
+
+/**
+ * @brief Character last written to each text cell by oled_write_cells(), or 0 if it isn't known
+ *
+ * A cell is one character of a line, at a column set with oled_set_cursor(). Anything else that draws over cells that
+ * have been written with oled_write_cells() must invalidate the widgets, or those cells will be treated as unchanged.
+ */
+#define OLED_CELL_COUNT (OLED_MATRIX_SIZE / OLED_FONT_WIDTH)
+static char    oled_cells[OLED_CELL_COUNT];
+static uint8_t oled_cells_inverted[(OLED_CELL_COUNT + 7) / 8];
+
+/**
+ * @brief Forces all retained widgets to redraw, eg after the buffer has been cleared or drawn over.
+ *
+ */
+void oled_invalidate_widgets(void) {
+    if (!++oled_widget_generation) {
+        oled_widget_generation = 1;
+    }
+    memset(oled_cells, 0, sizeof(oled_cells));
+}
+
+/**
+ * @brief Gets the text cell that an offset into the oled buffer is in
+ *
+ * @param offset offset into the oled buffer
+ * @return int16_t cell index, or -1 if it is in the unused pixels at the end of a line
+ */
+static int16_t oled_cell_index(uint16_t offset) {
+    uint8_t cells_per_line = oled_rotation_width / OLED_FONT_WIDTH;
+    uint8_t cell           = (offset % oled_rotation_width) / OLED_FONT_WIDTH;
+    if (cell >= cells_per_line) {
+        return -1;
+    }
+    return (offset / oled_rotation_width) * cells_per_line + cell;
+}
+
+/**
+ * @brief Forgets the cells that overlap a range of the oled buffer
+ *
+ * @param start first offset written to
+ * @param end offset after the last one written to
+ */
+static void oled_cells_forget(uint16_t start, uint16_t end) {
+    end = MIN(end, OLED_MATRIX_SIZE);
+    for (uint16_t offset = start; offset < end; offset += OLED_FONT_WIDTH) {
+        int16_t cell = oled_cell_index(offset);
+        if (cell >= 0) {
+            oled_cells[cell] = 0;
+        }
+    }
+    if (start < end) {
+        int16_t cell = oled_cell_index(end - 1);
+        if (cell >= 0) {
+            oled_cells[cell] = 0;
+        }
+    }
+}
+
+/**
+ * @brief Writes a character at the cursor, skipping the font blit if the cell already has that character
+ *
+ * @param data character to write
+ * @param invert invert the character
+ */
+static void oled_write_cell(const char data, bool invert) {
+    uint16_t offset = oled_cursor - &oled_buffer[0];
+    int16_t  cell   = oled_cell_index(offset);
+
+    if (data == '\n' || data == '\r' || cell < 0 || (offset % oled_rotation_width) % OLED_FONT_WIDTH ||
+        (offset % oled_rotation_width) + OLED_FONT_WIDTH > oled_rotation_width) {
+        // not drawing a whole cell, so just forget whatever gets drawn over
+        if (data == '\n') {
+            oled_cells_forget(offset, offset - (offset % oled_rotation_width) + oled_rotation_width);
+        } else if (data != '\r') {
+            oled_cells_forget(offset, offset + OLED_FONT_WIDTH);
+        }
+        oled_write_char(data, invert);
+        return;
+    }
+
+    uint8_t mask = 1 << (cell % 8);
+    if (oled_cells[cell] == data && !(oled_cells_inverted[cell / 8] & mask) == !invert) {
+        oled_advance_char();
+        return;
+    }
+    oled_write_char(data, invert);
+    oled_cells[cell] = data;
+    if (invert) {
+        oled_cells_inverted[cell / 8] |= mask;
+    } else {
+        oled_cells_inverted[cell / 8] &= ~mask;
+    }
+}
+
+/**
+ * @brief Writes a string at the cursor, only drawing the characters that have changed since it was last written
+ *
+ * Meant for strings that get rewritten with small changes, like numbers, where it skips the font blit (and compare)
+ * for every character that is already there.
+ *
+ * @param data string to write
+ * @param invert invert the string
+ */
+void oled_write_cells(const char *data, bool invert) {
+    for (; *data; data++) {
+        oled_write_cell(*data, invert);
+    }
+}
+
+/**
+ * @brief Writes a string from PROGMEM at the cursor, only drawing the characters that have changed
+ *
+ * @param data string to write, in PROGMEM
+ * @param invert invert the string
+ */
+void oled_write_cells_P(const char *data, bool invert) {
+    for (char c = pgm_read_byte(data); c; c = pgm_read_byte(++data)) {
+        oled_write_cell(c, invert);
+    }
+}
+
+/**
+ * @brief Checks if a retained widget needs to be redrawn, and updates its state if so
+ *
+ * Only the verbose layouts set the cursor for each widget, so the compact layouts always redraw.
+ *
+ * @param widget widget state
+ * @param key compact key of the state being displayed
+ * @param col column the widget is drawn at
+ * @param line line the widget is drawn at
+ * @return true widget needs to be redrawn
+ * @return false buffer already has the current state
+ */
+static bool oled_widget_update(oled_widget_t *widget, uint32_t key, uint8_t col, uint8_t line) {
+#ifdef OLED_DISPLAY_VERBOSE
+    if (widget->generation == oled_widget_generation && widget->key == key && widget->col == col &&
+        widget->line == line) {
+        return false;
+    }
+#endif
+    widget->key        = key;
+    widget->col        = col;
+    widget->line       = line;
+    widget->generation = oled_widget_generation;
+    return true;
+}
+
+/**
+ * @brief Draws a frame of a tiled sprite, writing only the tiles that differ from the last frame drawn
+ *
+ * The cache holds the tile index last drawn into each cell, and is reset whenever the sprite moves, or the retained
+ * widgets are invalidated. Tiles that have changed are written directly to the oled buffer, clipped to the display.
+ *
+ * Pass a NULL cache for a sprite that shares its cells with something else that writes the buffer every frame (such
+ * as a raw logo underneath it), so every tile is checked against the buffer instead of against the last index drawn.
+ *
+ * @param sprite sprite from oled_sprites.h
+ * @param cache tile cache for this instance of the sprite, with room for width * pages tiles, or NULL to not cache
+ * @param frame frame to draw
+ * @param col column to draw at, in characters
+ * @param line line (page) to draw at
+ */
+void oled_sprite_draw(const oled_sprite_t *sprite, oled_sprite_cache_t *cache, uint8_t frame, uint8_t col,
+                      uint8_t line) {
+    if (frame >= sprite->frames) {
+        return;
+    }
+    bool moved = !cache || cache->generation != oled_widget_generation || cache->col != col || cache->line != line;
+
+    const uint16_t *map       = &sprite->map[(uint16_t)frame * sprite->width * sprite->pages];
+    uint8_t         max_pages = OLED_MATRIX_SIZE / oled_rotation_width;
+    uint16_t        x_start   = col * OLED_FONT_WIDTH;
+    OLED_BLOCK_TYPE dirty     = 0;
+
+    for (uint8_t page = 0; page < sprite->pages && line + page < max_pages; page++) {
+        for (uint8_t tile = 0; tile < sprite->width; tile++) {
+            uint8_t  cell  = page * sprite->width + tile;
+            uint16_t index = pgm_read_word(&map[cell]);
+            if (cache) {
+                if (!moved && cache->tiles[cell] == index) {
+                    continue;
+                }
+                cache->tiles[cell] = index;
+            }
+
+            uint16_t x = x_start + tile * OLED_SPRITE_TILE_SIZE;
+            for (uint8_t i = 0; i < OLED_SPRITE_TILE_SIZE && x + i < oled_rotation_width; i++) {
+                uint16_t offset = (line + page) * oled_rotation_width + x + i;
+                uint8_t  value  = pgm_read_byte(&oled_sprite_tiles[index][i]);
+                if (oled_buffer[offset] != value) {
+                    oled_buffer[offset] = value;
+                    dirty |= ((OLED_BLOCK_TYPE)1 << (offset / OLED_BLOCK_SIZE));
+                }
             }
         }
     }
+    oled_dirty |= dirty;
+
+    if (cache) {
+        cache->col        = col;
+        cache->line       = line;
+        cache->generation = oled_widget_generation;
+    }
 }
 
 /**
@@ -138,6 +465,22 @@ bool process_record_user_oled(uint16_t keycode, keyrecord_t *record) {
                     oled_init(rot_temp);
                     break;
                 }
+#ifdef OLED_CAPTURE_ENABLE
+            case OLED_CAPTURE:
+                if (get_mods() & MOD_MASK_SHIFT) {
+                    oled_capture_toggle_logging();
+                } else {
+                    oled_capture_print_frame();
+                }
+                break;
+#endif // OLED_CAPTURE_ENABLE
+            case OLED_PROFILER:
+                if (get_mods() & MOD_MASK_SHIFT) {
+                    oled_profiler_toggle();
+                } else {
+                    oled_profiler_print();
+                }
+                break;
         }
     }
     return true;
@@ -162,6 +505,10 @@ void render_keylogger_status(uint8_t col, uint8_t line) {
  *
  */
 void render_default_layer_state(uint8_t col, uint8_t line) {
+    static oled_widget_t widget = {0};
+    if (!oled_widget_update(&widget, default_layer_state, col, line)) {
+        return;
+    }
 #ifdef OLED_DISPLAY_VERBOSE
     oled_set_cursor(col, line);
     oled_write_P(PSTR(OLED_RENDER_LAYOUT_NAME), false);
@@ -200,6 +547,10 @@ void render_default_layer_state(uint8_t col, uint8_t line) {
  *
  */
 void render_layer_state(uint8_t col, uint8_t line) {
+    static oled_widget_t widget = {0};
+    if (!oled_widget_update(&widget, layer_state, col, line)) {
+        return;
+    }
 #ifdef OLED_DISPLAY_VERBOSE
     uint8_t layer_is[4] = {0, 4, 4, 4};
     if (layer_state_is(_ADJUST)) {
@@ -217,32 +568,25 @@ void render_layer_state(uint8_t col, uint8_t line) {
         layer_is[2] = 5;
     }
 
-    oled_set_cursor(col, line);
-    oled_write_raw_P(tri_layer_image[layer_is[0]][0], sizeof(tri_layer_image[0][0]));
-    oled_set_cursor(col + 4, line);
-    oled_write_raw_P(tri_layer_image[layer_is[1]][0], sizeof(tri_layer_image[0][0]));
-    oled_set_cursor(col + 8, line);
-    oled_write_raw_P(tri_layer_image[layer_is[2]][0], sizeof(tri_layer_image[0][0]));
+    static uint16_t            tri_layer_tiles[3][TRI_LAYER_SPRITE_TILES];
+    static oled_sprite_cache_t tri_layer_cache[3] = {
+        {.tiles = tri_layer_tiles[0]},
+        {.tiles = tri_layer_tiles[1]},
+        {.tiles = tri_layer_tiles[2]},
+    };
+    static const oled_sprite_t tri_layer_sprite = TRI_LAYER_SPRITE;
+    for (uint8_t i = 0; i < 3; i++) {
+        oled_sprite_draw(&tri_layer_sprite, &tri_layer_cache[i], layer_is[i], col + (i * 4), line);
+    }
+
     oled_set_cursor(col + 13, line);
     oled_write_P(PSTR("Diablo2"), layer_state_is(_DIABLOII));
     oled_advance_page(true);
 
-    oled_set_cursor(col, line + 1);
-    oled_write_raw_P(tri_layer_image[layer_is[0]][1], sizeof(tri_layer_image[0][0]));
-    oled_set_cursor(col + 4, line + 1);
-    oled_write_raw_P(tri_layer_image[layer_is[1]][1], sizeof(tri_layer_image[0][0]));
-    oled_set_cursor(col + 8, line + 1);
-    oled_write_raw_P(tri_layer_image[layer_is[2]][1], sizeof(tri_layer_image[0][0]));
     oled_set_cursor(col + 13, line + 1);
     oled_write_P(PSTR("Diablo3"), layer_state_is(_DIABLO));
     oled_advance_page(true);
 
-    oled_set_cursor(col, line + 2);
-    oled_write_raw_P(tri_layer_image[layer_is[0]][2], sizeof(tri_layer_image[0][0]));
-    oled_set_cursor(col + 4, line + 2);
-    oled_write_raw_P(tri_layer_image[layer_is[1]][2], sizeof(tri_layer_image[0][0]));
-    oled_set_cursor(col + 8, line + 2);
-    oled_write_raw_P(tri_layer_image[layer_is[2]][2], sizeof(tri_layer_image[0][0]));
     oled_set_cursor(col + 13, line + 2);
     oled_write_P(PSTR("Media"), layer_state_is(_MEDIA));
 #else
@@ -259,11 +603,15 @@ void render_layer_state(uint8_t col, uint8_t line) {
  * @param led_usb_state Current keyboard led state
  */
 void render_keylock_status(led_t led_usb_state, uint8_t col, uint8_t line) {
-#if defined(OLED_DISPLAY_VERBOSE)
-    oled_set_cursor(col, line);
-#endif
+    static oled_widget_t widget = {0};
 #ifdef CAPS_WORD_ENABLE
     led_usb_state.caps_lock |= is_caps_word_on();
+#endif
+    if (!oled_widget_update(&widget, led_usb_state.raw, col, line)) {
+        return;
+    }
+#if defined(OLED_DISPLAY_VERBOSE)
+    oled_set_cursor(col, line);
 #endif
     oled_write_P(PSTR(OLED_RENDER_LOCK_NAME), false);
 #if !defined(OLED_DISPLAY_VERBOSE)
@@ -283,14 +631,18 @@ void render_keylock_status(led_t led_usb_state, uint8_t col, uint8_t line) {
  *
  */
 void render_matrix_scan_rate(uint8_t padding, uint8_t col, uint8_t line) {
+    static oled_widget_t widget = {0};
+    if (!oled_widget_update(&widget, get_matrix_scan_rate(), col, line)) {
+        return;
+    }
     oled_set_cursor(col, line);
-    oled_write_P(PSTR("MS:"), false);
+    oled_write_cells_P(PSTR("MS:"), false);
     if (padding) {
         for (uint8_t n = padding; n > 0; n--) {
-            oled_write_P(PSTR(" "), false);
+            oled_write_cells_P(PSTR(" "), false);
         }
     }
-    oled_write(get_u16_str(get_matrix_scan_rate(), ' '), false);
+    oled_write_cells(get_u16_str(get_matrix_scan_rate(), ' '), false);
 }
 
 /**
@@ -301,12 +653,16 @@ void render_matrix_scan_rate(uint8_t padding, uint8_t col, uint8_t line) {
 void render_mod_status(uint8_t modifiers, uint8_t col, uint8_t line) {
     static const char PROGMEM mod_status[5][3] = {
         {0xE8, 0xE9, 0}, {0xE4, 0xE5, 0}, {0xE6, 0xE7, 0}, {0xEA, 0xEB, 0}, {0xEC, 0xED, 0}};
-#if defined(OLED_DISPLAY_VERBOSE)
-    oled_set_cursor(col, line);
-#endif
-    bool is_caps = host_keyboard_led_state().caps_lock;
+    static oled_widget_t widget  = {0};
+    bool                 is_caps = host_keyboard_led_state().caps_lock;
 #ifdef CAPS_WORD_ENABLE
     is_caps |= is_caps_word_on();
+#endif
+    if (!oled_widget_update(&widget, modifiers | (is_caps << 8) | (keymap_config.swap_lctl_lgui << 9), col, line)) {
+        return;
+    }
+#if defined(OLED_DISPLAY_VERBOSE)
+    oled_set_cursor(col, line);
 #endif
     oled_write_P(PSTR(OLED_RENDER_MODS_NAME), false);
 #if defined(OLED_DISPLAY_VERBOSE)
@@ -338,6 +694,18 @@ void render_bootmagic_status(uint8_t col, uint8_t line) {
         {{0x95, 0x96, 0}, {0xb5, 0xb6, 0}},
     };
 
+    static oled_widget_t widget = {0};
+    uint32_t             key    = keymap_config.raw | (is_oneshot_enabled() << 16);
+#if defined(AUTOCORRECT_ENABLE)
+    key |= autocorrect_is_enabled() << 17;
+#endif
+#ifdef SWAP_HANDS_ENABLE
+    key |= swap_hands << 18;
+#endif
+    if (!oled_widget_update(&widget, key, col, line)) {
+        return;
+    }
+
     bool is_bootmagic_on;
 #ifdef OLED_DISPLAY_VERBOSE
     oled_set_cursor(col, line);
@@ -407,6 +775,21 @@ void render_user_status(uint8_t col, uint8_t line) {
 #        endif
 #    endif
 #endif
+    static oled_widget_t widget = {0};
+    uint32_t             key    = userspace_config.rgb_layer_change | (userspace_config.nuke_switch << 1) |
+                                (userspace_config.rgb_matrix_idle_anim << 2) | (get_keyboard_lock() << 3);
+#ifdef AUDIO_ENABLE
+    key |= (is_audio_on << 4) | (l_is_clicky_on << 5);
+#endif
+#if defined(POINTING_DEVICE_ENABLE) && defined(POINTING_DEVICE_AUTO_MOUSE_ENABLE)
+    key |= get_auto_mouse_toggle() << 6;
+#endif
+#if defined(UNICODE_COMMON_ENABLE)
+    key |= get_unicode_input_mode() << 8;
+#endif
+    if (!oled_widget_update(&widget, key, col, line)) {
+        return;
+    }
 #if defined(OLED_DISPLAY_VERBOSE)
     oled_set_cursor(col, line);
 #endif
@@ -462,22 +845,23 @@ void render_user_status(uint8_t col, uint8_t line) {
 
 void render_rgb_hsv(uint8_t col, uint8_t line) {
     oled_set_cursor(col, line);
-    oled_write_P(PSTR("HSV: "), false);
+    oled_write_cells_P(PSTR("HSV: "), false);
 #ifdef RGB_MATRIX_ENABLE
-    oled_write(get_u8_str(rgb_matrix_get_hue(), ' '), false);
-    oled_write_P(PSTR(", "), false);
-    oled_write(get_u8_str(rgb_matrix_get_sat(), ' '), false);
-    oled_write_P(PSTR(", "), false);
-    oled_write(get_u8_str(rgb_matrix_get_val(), ' '), false);
+    oled_write_cells(get_u8_str(rgb_matrix_get_hue(), ' '), false);
+    oled_write_cells_P(PSTR(", "), false);
+    oled_write_cells(get_u8_str(rgb_matrix_get_sat(), ' '), false);
+    oled_write_cells_P(PSTR(", "), false);
+    oled_write_cells(get_u8_str(rgb_matrix_get_val(), ' '), false);
 #elif RGBLIGHT_ENABLE
     if (is_rgblight_startup_running()) {
-        oled_write_P(PSTR("Start Animation"), false);
+        oled_write_cells_P(PSTR("Start Animation"), false);
     } else {
-        oled_write(get_u8_str(rgblight_get_hue(), ' '), false);
-        oled_write_P(PSTR(", "), false);
-        oled_write(get_u8_str(rgblight_get_sat(), ' '), false);
-        oled_write_P(PSTR(", "), false);
-        oled_write_ln(get_u8_str(rgblight_get_val(), ' '), false);
+        oled_write_cells(get_u8_str(rgblight_get_hue(), ' '), false);
+        oled_write_cells_P(PSTR(", "), false);
+        oled_write_cells(get_u8_str(rgblight_get_sat(), ' '), false);
+        oled_write_cells_P(PSTR(", "), false);
+        oled_write_cells(get_u8_str(rgblight_get_val(), ' '), false);
+        oled_write_cells_P(PSTR("\n"), false);
     }
 #endif
 }
@@ -519,14 +903,18 @@ void render_rgb_mode(uint8_t col, uint8_t line) {
 
 void render_wpm(uint8_t padding, uint8_t col, uint8_t line) {
 #ifdef WPM_ENABLE
+    static oled_widget_t widget = {0};
+    if (!oled_widget_update(&widget, get_current_wpm(), col, line)) {
+        return;
+    }
     oled_set_cursor(col, line);
-    oled_write_P(PSTR(OLED_RENDER_WPM_COUNTER), false);
+    oled_write_cells_P(PSTR(OLED_RENDER_WPM_COUNTER), false);
     if (padding) {
         for (uint8_t n = padding; n > 0; n--) {
-            oled_write_P(PSTR(" "), false);
+            oled_write_cells_P(PSTR(" "), false);
         }
     }
-    oled_write(get_u8_str(get_current_wpm(), ' '), false);
+    oled_write_cells(get_u8_str(get_current_wpm(), ' '), false);
 #endif
 }
 
@@ -542,6 +930,24 @@ void render_wpm(uint8_t padding, uint8_t col, uint8_t line) {
 // max_lines_graph          = 64;
 // vertical_offset          = 0;
 
+#ifdef WPM_ENABLE
+/**
+ * @brief Bits of a page that are part of the WPM graph
+ *
+ */
+static uint8_t oled_wpm_graph_page_mask(uint8_t page, uint8_t max_lines_graph, uint8_t vertical_offset) {
+    int16_t first = vertical_offset - (page * 8), last = first + max_lines_graph;
+    uint8_t mask  = 0xFF;
+    if (first > 0) {
+        mask &= (first >= 8) ? 0 : (uint8_t)(0xFF << first);
+    }
+    if (last < 8) {
+        mask &= (last <= 0) ? 0 : (uint8_t)(0xFF >> (8 - last));
+    }
+    return mask;
+}
+#endif
+
 /**
  * @brief Renders dynamic WPM graph on screen
  *
@@ -552,61 +958,85 @@ void render_wpm(uint8_t padding, uint8_t col, uint8_t line) {
  */
 void render_wpm_graph(uint8_t start_offset, uint8_t cutoff, uint8_t max_lines_graph, uint8_t vertical_offset) {
 #ifdef WPM_ENABLE
-    static uint16_t timer   = 0;
-    static uint8_t  x       = OLED_DISPLAY_HEIGHT - 1;
-    uint8_t         currwpm = get_current_wpm();
-    float           max_wpm = OLED_WPM_GRAPH_MAX_WPM;
-
-    if (timer_elapsed(timer) >
-        OLED_WPM_GRAPH_REFRESH_INTERVAL) { // check if it's been long enough before refreshing graph
-        x = (max_lines_graph - 1) -
-            ((currwpm / max_wpm) * (max_lines_graph - 1));                       // main calculation to plot graph line
-        for (uint8_t i = 0; i <= OLED_WPM_GRAPH_GRAPH_LINE_THICKNESS - 1; i++) { // first draw actual value line
-            oled_write_pixel(start_offset, x + i + vertical_offset, true);
-        }
+    static uint16_t timer = 0;
+
+    if (timer_elapsed(timer) <= OLED_WPM_GRAPH_REFRESH_INTERVAL) { // check if it's been long enough before refreshing graph
+        return;
+    }
+    timer = timer_read(); // refresh the timer for the next iteration
+
+    uint8_t max_pages = OLED_MATRIX_SIZE / oled_rotation_width;
+    cutoff            = MIN(cutoff, oled_rotation_width);
+    if (cutoff <= start_offset || !max_lines_graph) {
+        return;
+    }
+
+    float   max_wpm          = OLED_WPM_GRAPH_MAX_WPM;
+    uint8_t line             = (max_lines_graph - 1) - ((MIN(get_current_wpm(), OLED_WPM_GRAPH_MAX_WPM) / max_wpm) *
+                                                        (max_lines_graph - 1)); // main calculation to plot graph line
+    bool    is_vertical_line = false;
 #    ifdef OLED_WPM_GRAPH_VERTICAL_LINE
-        static uint8_t vert_count = 0;
-        if (vert_count == OLED_WPM_GRAPH_VERTCAL_LINE_INTERVAL) {
-            vert_count = 0;
-            while (x <= (max_lines_graph - 1)) {
-                oled_write_pixel(start_offset, x + vertical_offset, true);
-                x++;
-            }
-        } else {
-            for (uint8_t i = (max_lines_graph - 1); i > x; i--) {
-                if (i % OLED_WPM_GRAPH_AREA_FILL_INTERVAL == 0) {
-                    oled_write_pixel(start_offset, i + vertical_offset, true);
-                }
-            }
-            vert_count++;
+    static uint8_t vert_count = 0;
+    if (vert_count == OLED_WPM_GRAPH_VERTCAL_LINE_INTERVAL) {
+        vert_count       = 0;
+        is_vertical_line = true;
+    } else {
+        vert_count++;
+    }
+#    endif
+
+    // move the graph one pixel to the right: whole pages with a memmove each, and the pages that are shared with other
+    // content (when the graph isn't page aligned) byte by byte, keeping the bits that aren't part of the graph
+    uint8_t         page_start = vertical_offset / 8;
+    uint8_t         page_end   = MIN((vertical_offset + max_lines_graph + 7) / 8, max_pages);
+    uint8_t         full_start = (vertical_offset + 7) / 8;
+    uint8_t         full_end   = MIN((vertical_offset + max_lines_graph) / 8, max_pages);
+    OLED_BLOCK_TYPE dirty      = 0;
+    if (full_start < full_end) {
+        oled_scroll_region(OLED_SCROLL_RIGHT, 1, false, start_offset, cutoff, full_start, full_end);
+    }
+    for (uint8_t page = page_start; page < page_end; page++) {
+        if (page >= full_start && page < full_end) {
+            continue;
         }
-#    else
-        for (int i = (max_lines_graph - 1); i > x; i--) {
-            if (i % OLED_WPM_GRAPH_AREA_FILL_INTERVAL == 0) {
-                oled_write_pixel(start_offset, i + vertical_offset, true);
+        uint8_t  mask = oled_wpm_graph_page_mask(page, max_lines_graph, vertical_offset);
+        uint8_t *row  = &oled_buffer[page * oled_rotation_width + start_offset];
+        for (uint8_t x = cutoff - start_offset - 1; x > 0; x--) {
+            row[x] = (row[x] & ~mask) | (row[x - 1] & mask);
+        }
+        dirty |= oled_dirty_span(page, start_offset, cutoff);
+    }
+
+    // then draw only the new sample, in the first column
+    for (uint8_t page = page_start; page < page_end; page++) {
+        uint8_t mask = oled_wpm_graph_page_mask(page, max_lines_graph, vertical_offset), data = 0;
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            int16_t y = (page * 8) + bit - vertical_offset;
+            if ((mask & (1 << bit)) &&
+                ((y >= line && y < line + OLED_WPM_GRAPH_GRAPH_LINE_THICKNESS) || // the actual value line
+                 (y > line && (is_vertical_line || y % OLED_WPM_GRAPH_AREA_FILL_INTERVAL == 0)))) {
+                data |= (1 << bit);
             }
         }
-#    endif
-        uint8_t y_start  = ceil(vertical_offset / 8);
-        uint8_t y_length = y_start + ceil(max_lines_graph / 8);
-        oled_pan_section(false, y_start, y_length, start_offset,
-                         cutoff); // then move the entire graph one pixel to the right
-        timer = timer_read();     // refresh the timer for the next iteration
+        uint16_t i     = (page * oled_rotation_width) + start_offset;
+        oled_buffer[i] = (oled_buffer[i] & ~mask) | data;
+        dirty |= ((OLED_BLOCK_TYPE)1 << (i / OLED_BLOCK_SIZE));
     }
+    oled_dirty |= dirty;
 #endif
 }
 
 #if defined(POINTING_DEVICE_ENABLE)
 void render_pointing_dpi_status(uint16_t cpi, uint8_t padding, uint8_t col, uint8_t line) {
     oled_set_cursor(col, line);
-    oled_write_P(PSTR("CPI:"), false);
+    oled_write_cells_P(PSTR("CPI:"), false);
     if (padding) {
         for (uint8_t n = padding - 1; n > 0; n--) {
-            oled_write_P(PSTR(" "), false);
+            oled_write_cells_P(PSTR(" "), false);
         }
     }
 
-    oled_write(get_u16_str(cpi, ' '), false);
+    oled_write_cells(get_u16_str(cpi, ' '), false);
 }
 #endif
 
@@ -623,6 +1053,9 @@ void render_pointing_dpi_status(uint16_t cpi, uint8_t padding, uint8_t col, uint
 #ifndef OLED_PET_ARRAY
 #    define OLED_PET_ARRAY tora_the_cat_animation
 #endif
+#ifndef OLED_PET_INDEX
+#    define OLED_PET_INDEX 1 // 0 is tora the cat, 1 is neko, 2 is luna
+#endif
 
 // #define ANIM_FRAME_DURATION 500 // how long each frame lasts in ms
 //  #define SLEEP_TIMER 60000 // should sleep after this period of 0 wpm, needs fixing
@@ -630,15 +1063,18 @@ void render_pointing_dpi_status(uint16_t cpi, uint8_t padding, uint8_t col, uint
     (OLED_KAKI_FRAMES > OLED_ANIM_MAX_FRAMES) || (OLED_RTOGI_FRAMES > OLED_ANIM_MAX_FRAMES)
 #    error frame size too large
 #endif
+#if OLED_PET_INDEX >= PET_SPRITE_PETS
+#    error OLED_PET_INDEX is not a pet in pet_animiations
+#endif
 
 static uint8_t animation_frame = 0;
 static uint8_t animation_type  = 0;
 
 void render_pet(uint8_t col, uint8_t line) {
-    for (uint8_t i = 0; i < 4; i++) {
-        oled_set_cursor(col, line + i);
-        oled_write_raw_P(pet_animiations[1][animation_type][animation_frame][i], OLED_ANIM_SIZE);
-    }
+    static uint16_t            tiles[PET_SPRITE_TILES];
+    static oled_sprite_cache_t cache  = {.tiles = tiles};
+    static const oled_sprite_t sprite = PET_SPRITE;
+    oled_sprite_draw(&sprite, &cache, PET_SPRITE_FRAME(OLED_PET_INDEX, animation_type, animation_frame), col, line);
 }
 
 uint32_t pet_animation_phases(uint32_t triger_time, void *cb_arg) {
@@ -716,48 +1152,48 @@ void render_mouse_mode(uint8_t col, uint8_t line) {
 
 void render_status_right(void) {
 #if defined(OLED_DISPLAY_VERBOSE)
-    render_default_layer_state(1, 1);
+    OLED_PROFILE(render_default_layer_state(1, 1));
 #else
-    render_default_layer_state(0, 0);
+    OLED_PROFILE(render_default_layer_state(0, 0));
 #endif
 
     /* Show Keyboard Layout  */
-    render_layer_state(1, 2);
-    render_mod_status(get_mods() | get_oneshot_mods(), 1, 5);
+    OLED_PROFILE(render_layer_state(1, 2));
+    OLED_PROFILE(render_mod_status(get_mods() | get_oneshot_mods(), 1, 5));
 #if !defined(OLED_DISPLAY_VERBOSE) && defined(WPM_ENABLE) && !defined(STM32F303xC)
-    render_wpm(2, 7, 1);
+    OLED_PROFILE(render_wpm(2, 7, 1));
 #endif
-    render_keylock_status(host_keyboard_led_state(), 1, 6);
+    OLED_PROFILE(render_keylock_status(host_keyboard_led_state(), 1, 6));
 }
 
 void render_status_left(void) {
 #if defined(OLED_DISPLAY_VERBOSE)
-    render_pet(0, 1);
+    OLED_PROFILE(render_pet(0, 1));
 
 #    if defined(WPM_ENABLE)
-    render_wpm(1, 7, 1);
+    OLED_PROFILE(render_wpm(1, 7, 1));
 #    else
-    render_matrix_scan_rate(1, 7, 1);
+    OLED_PROFILE(render_matrix_scan_rate(1, 7, 1));
 #    endif
 #    if (defined(KEYBOARD_bastardkb_charybdis) || defined(KEYBOARD_handwired_tractyl_manuform)) && \
         defined(POINTING_DEVICE_ENABLE)
-    render_pointing_dpi_status(charybdis_get_pointer_sniping_enabled() ? charybdis_get_pointer_sniping_dpi()
-                                                                       : charybdis_get_pointer_default_dpi(),
-                               1, 7, 2);
-    render_mouse_mode(17, 1);
+    OLED_PROFILE(render_pointing_dpi_status(
+        charybdis_get_pointer_sniping_enabled() ? charybdis_get_pointer_sniping_dpi() : charybdis_get_pointer_default_dpi(),
+        1, 7, 2));
+    OLED_PROFILE(render_mouse_mode(17, 1));
 #    elif defined(WPM_ENABLE)
-    render_matrix_scan_rate(1, 7, 2);
+    OLED_PROFILE(render_matrix_scan_rate(1, 7, 2));
 #    endif
     /* Show Keyboard Layout  */
-    render_bootmagic_status(7, 3);
-    render_user_status(1, 5);
+    OLED_PROFILE(render_bootmagic_status(7, 3));
+    OLED_PROFILE(render_user_status(1, 5));
 #else
-    render_default_layer_state(0, 0);
+    OLED_PROFILE(render_default_layer_state(0, 0));
     /* Show Keyboard Layout  */
-    render_bootmagic_status(7, 3);
-    render_user_status(1, 5);
+    OLED_PROFILE(render_bootmagic_status(7, 3));
+    OLED_PROFILE(render_user_status(1, 5));
 
-    render_keylogger_status(1, 6);
+    OLED_PROFILE(render_keylogger_status(1, 6));
 #endif
 }
 
@@ -776,6 +1212,53 @@ void render_autocorrected_info(uint8_t col, uint8_t line) {
 #endif
 }
 
+/**
+ * @brief Renders the split transport link stats, one line per user RPC (average and p99 in us, and failures)
+ *
+ * @param col
+ * @param line
+ */
+void render_transport_stats(uint8_t col, uint8_t line) {
+#ifdef CUSTOM_SPLIT_TRANSPORT_SYNC
+    char buf[22] = {0};
+
+    oled_set_cursor(col, line);
+    oled_write_ln_P(PSTR("Lnk  avg  p99 err"), false);
+    for (uint8_t i = 0; transport_stats_render_string(i, buf, sizeof(buf), false); i++) {
+        oled_set_cursor(col, line + 1 + i);
+        oled_write_ln(buf, false);
+    }
+#endif
+}
+
+/**
+ * @brief Renders the health of the other half of the split keyboard
+ *
+ * @param col
+ * @param line
+ */
+void render_split_telemetry(uint8_t col, uint8_t line) {
+#ifdef CUSTOM_SPLIT_TRANSPORT_SYNC
+    const split_telemetry_t *peer    = transport_sync_get_remote_telemetry();
+    char                     buf[22] = {0};
+
+    oled_set_cursor(col, line);
+    if (!peer) {
+        oled_write_ln_P(PSTR("Peer: no data"), false);
+        oled_set_cursor(col, line + 1);
+        oled_advance_page(true);
+        return;
+    }
+    snprintf(buf, sizeof(buf), "Scans%7lu RTC %c", MIN(peer->matrix_scan_rate, 9999999),
+             peer->rtc_connected ? 'Y' : 'N');
+    oled_write_ln(buf, false);
+    oled_set_cursor(col, line + 1);
+    snprintf(buf, sizeof(buf), "HK%6uus Err%5u", peer->housekeeping_max_us,
+             MIN(peer->delta_errors + peer->blob_errors, 99999));
+    oled_write_ln(buf, false);
+#endif
+}
+
 void render_cyberpunk_logo(uint8_t col, uint8_t line) {
     oled_set_cursor(col, line);
     oled_write_raw_P(cyberpunk_logo, sizeof(cyberpunk_logo));
@@ -882,8 +1365,10 @@ void render_train_animation(uint8_t col, uint8_t line) {
         }
         timer = timer_read();
     }
-    oled_set_cursor(col, line);
-    oled_write_raw_P(train_animation[frame], sizeof(train_animation[0]));
+    static uint16_t            tiles[TRAIN_SPRITE_TILES];
+    static oled_sprite_cache_t cache  = {.tiles = tiles};
+    static const oled_sprite_t sprite = TRAIN_SPRITE;
+    oled_sprite_draw(&sprite, &cache, frame, col, line);
 }
 
 void oled_render_mario(uint8_t col, uint8_t line) {
@@ -896,10 +1381,9 @@ void oled_render_mario(uint8_t col, uint8_t line) {
         }
         timer = timer_read();
     }
-    for (uint8_t i = 0; i < 4; i++) {
-        oled_set_cursor(col, line + i);
-        oled_write_raw_P(mario_animation[frame][i], sizeof(mario_animation[0][0]));
-    }
+    static const oled_sprite_t sprite = MARIO_SPRITE;
+    // drawn over the arasaka logo, which rewrites these cells every frame, so it can't skip unchanged tiles
+    oled_sprite_draw(&sprite, NULL, frame, col, line);
 }
 
 void render_os(uint8_t col, uint8_t line) {
@@ -943,6 +1427,10 @@ void render_os(uint8_t col, uint8_t line) {
 
 void oled_render_time(uint8_t col, uint8_t line) {
 #ifdef RTC_ENABLE
+    static oled_widget_t widget = {0};
+    if (!oled_widget_update(&widget, rtc_is_connected() ? rtc_read_time_struct().unixtime : 0, col, line)) {
+        return;
+    }
     oled_set_cursor(col, line);
     if (rtc_is_connected()) {
 #    ifdef DS3231_RTC_DRIVER_ENABLE
@@ -954,7 +1442,8 @@ void oled_render_time(uint8_t col, uint8_t line) {
         oled_write_ln_P(PSTR("RTC Temp: N/A"), false);
 #    endif
         oled_set_cursor(col, line + 1);
-        oled_write_ln(rtc_read_date_time_str(), false);
+        oled_write_cells(rtc_read_date_time_str(), false);
+        oled_write_cells_P(PSTR("\n"), false);
     } else {
         oled_write_ln_P(PSTR("RTC not found"), false);
         oled_advance_page(true);
@@ -964,6 +1453,10 @@ void oled_render_time(uint8_t col, uint8_t line) {
 
 void oled_render_time_small(uint8_t col, uint8_t line, uint8_t padding) {
 #ifdef RTC_ENABLE
+    static oled_widget_t widget = {0};
+    if (!oled_widget_update(&widget, rtc_is_connected() ? rtc_read_time_struct().unixtime : 0, col, line)) {
+        return;
+    }
     oled_set_cursor(col, line);
     if (rtc_is_connected()) {
 #    ifdef DS3231_RTC_DRIVER_ENABLE
@@ -974,9 +1467,9 @@ void oled_render_time_small(uint8_t col, uint8_t line, uint8_t padding) {
         oled_write_ln_P(PSTR("RTC Temp: N/A"), false);
 #    endif
         oled_set_cursor(col + padding, line + 1);
-        oled_write(rtc_read_date_str(), false);
+        oled_write_cells(rtc_read_date_str(), false);
         oled_set_cursor(col + padding + 2, line + 2);
-        oled_write(rtc_read_time_str(), false);
+        oled_write_cells(rtc_read_time_str(), false);
     } else {
         oled_write_ln_P(PSTR("RTC not found"), false);
         oled_set_cursor(col, line + 1);
@@ -990,12 +1483,12 @@ void oled_render_time_small(uint8_t col, uint8_t line, uint8_t padding) {
 #ifdef OLED_DISPLAY_128X128
 __attribute__((weak)) void oled_render_large_display(bool side) {
     if (side) {
-        render_rgb_hsv(1, 6);
-        render_rgb_mode(1, 7);
+        OLED_PROFILE(render_rgb_hsv(1, 6));
+        OLED_PROFILE(render_rgb_mode(1, 7));
 
-        render_arasaka_logo(0, 8);
-        render_wpm_graph(23, 107, 25, 96);
-        oled_render_mario(1, 11);
+        OLED_PROFILE(render_arasaka_logo(0, 8));
+        OLED_PROFILE(render_wpm_graph(23, 107, 25, 96));
+        OLED_PROFILE(oled_render_mario(1, 11));
     } else {
         // oled_advance_page(true);
 #    if defined(LAYER_MAP_ENABLE)
@@ -1025,10 +1518,10 @@ __attribute__((weak)) void oled_render_large_display(bool side) {
         }
 
 #    else
-        render_autocorrected_info(1, 7);
-        render_os(1, 11);
-        render_unicode_mode(1, 12);
-        oled_render_time(1, 13);
+        OLED_PROFILE(render_autocorrected_info(1, 7));
+        OLED_PROFILE(render_os(1, 11));
+        OLED_PROFILE(render_unicode_mode(1, 12));
+        OLED_PROFILE(oled_render_time(1, 13));
 #    endif
     }
 }
@@ -1049,6 +1542,7 @@ oled_rotation_t oled_init_user(oled_rotation_t rotation) {
 
     if (has_run) {
         oled_set_brightness(userspace_config.oled_brightness);
+        oled_invalidate_widgets();
         return rotation;
     }
 
@@ -1056,6 +1550,7 @@ oled_rotation_t oled_init_user(oled_rotation_t rotation) {
 
     oled_clear();
     oled_render_dirty(true);
+    oled_invalidate_widgets();
     has_run = true;
     return rotation;
 }
@@ -1068,85 +1563,203 @@ __attribute__((weak)) void render_oled_screensaver(void) {
     oled_off();
 }
 
-bool oled_task_user(void) {
-    static bool was_screensaver_enabled = false;
-#ifndef OLED_DISPLAY_TEST
-    if (!is_oled_enabled) {
-        oled_off();
-        return false;
-    } else
-#endif
-    {
-        oled_on();
-    }
-
-    if (oled_screensaver_enabled) {
-        was_screensaver_enabled = true;
-        render_oled_screensaver();
-        return false;
-    }
-    if (was_screensaver_enabled) {
-        was_screensaver_enabled = false;
-        oled_clear();
-    }
+#if defined(OLED_DISPLAY_VERBOSE)
+#    if defined(OLED_DISPLAY_128X128)
+#        define OLED_BORDER_ROWS 15
+#    else
+#        define OLED_BORDER_ROWS 7
+#    endif
 
-    if (!oled_task_keymap()) {
-        return false;
+static void oled_render_section_header(void) {
+    static oled_widget_t header = {0};
+    if (oled_widget_update(&header, is_keyboard_left(), 0, 0)) {
+        oled_set_cursor(0, 0);
+        OLED_PROFILE(oled_write_raw_P(header_image, sizeof(header_image)));
+        oled_set_cursor(4, 0);
+        OLED_PROFILE(render_oled_title(is_keyboard_left()));
     }
-
-#if defined(OLED_DISPLAY_VERBOSE)
-    oled_write_raw_P(header_image, sizeof(header_image));
-    oled_set_cursor(4, 0);
-    render_oled_title(is_keyboard_left());
+}
 #endif
 
+static void oled_render_section_status(void) {
 #ifndef OLED_DISPLAY_TEST
     if (is_keyboard_left()) {
 #endif
         render_status_left();
-#if defined(OLED_DISPLAY_128X128)
-        oled_render_large_display(true);
-#endif
 #ifndef OLED_DISPLAY_TEST
     } else {
         render_status_right();
-#    if defined(OLED_DISPLAY_128X128)
-        oled_render_large_display(false);
-#    endif
     }
 #endif
+}
 
-#if defined(OLED_DISPLAY_VERBOSE)
-    uint8_t num_of_rows;
-#    if defined(OLED_DISPLAY_128X128)
-    num_of_rows = 15;
+#if defined(OLED_DISPLAY_128X128)
+static void oled_render_section_large_display(void) {
+#    ifndef OLED_DISPLAY_TEST
+    oled_render_large_display(is_keyboard_left());
 #    else
-    num_of_rows = 7;
+    oled_render_large_display(true);
 #    endif
-    for (uint8_t i = 1; i < num_of_rows; i++) {
+}
+#endif
+
+#if defined(OLED_DISPLAY_VERBOSE)
+static void oled_render_section_border(void) {
+    for (uint8_t i = 1; i < OLED_BORDER_ROWS; i++) {
         oled_set_cursor(0, i);
-        oled_write_raw_P(display_border, sizeof(display_border));
+        OLED_PROFILE(oled_write_raw_P(display_border, sizeof(display_border)));
         oled_set_cursor(21, i);
-        oled_write_raw_P(display_border, sizeof(display_border));
+        OLED_PROFILE(oled_write_raw_P(display_border, sizeof(display_border)));
     }
+}
 
-    oled_set_cursor(0, num_of_rows);
-    oled_write_raw_P(footer_image2, sizeof(footer_image2));
+static void oled_render_section_footer(void) {
+    static oled_widget_t footer = {0};
 
+    // the footer text is drawn over the image, so both need to be redrawn together, or not at all
+    uint32_t footer_key = is_keyboard_left();
 #    ifdef DISPLAY_KEYLOGGER_ENABLE
     if (is_keyboard_left()) {
-        oled_set_cursor(4, num_of_rows);
-        oled_write(display_keylogger_string, true);
+        for (const char *c = display_keylogger_string; *c; c++) {
+            footer_key = (footer_key * 31) + (uint8_t)*c;
+        }
     } else
 #    endif // DISPLAY_KEYLOGGER_ENABLE
     {
-        render_unicode_mode_small(4, num_of_rows, true);
+#    if defined(CUSTOM_UNICODE_ENABLE) && defined(UNICODE_COMMON_ENABLE)
+        footer_key = (footer_key << 8) | unicode_typing_mode;
+#    endif
+    }
+    if (oled_widget_update(&footer, footer_key, 0, OLED_BORDER_ROWS)) {
+        oled_set_cursor(0, OLED_BORDER_ROWS);
+        OLED_PROFILE(oled_write_raw_P(footer_image2, sizeof(footer_image2)));
+
+#    ifdef DISPLAY_KEYLOGGER_ENABLE
+        if (is_keyboard_left()) {
+            oled_set_cursor(4, OLED_BORDER_ROWS);
+            OLED_PROFILE(oled_write(display_keylogger_string, true));
+        } else
+#    endif // DISPLAY_KEYLOGGER_ENABLE
+        {
+            OLED_PROFILE(render_unicode_mode_small(4, OLED_BORDER_ROWS, true));
+        }
+    }
+}
+#endif
+
+// clang-format off
+static void (*const oled_render_section[])(void) = {
+#if defined(OLED_DISPLAY_VERBOSE)
+    oled_render_section_header,
+#endif
+    oled_render_section_status,
+#if defined(OLED_DISPLAY_128X128)
+    oled_render_section_large_display,
+#endif
+#if defined(OLED_DISPLAY_VERBOSE)
+    oled_render_section_border,
+    oled_render_section_footer,
+#endif
+};
+// clang-format on
+
+static uint8_t         oled_next_section  = 0;
+static OLED_BLOCK_TYPE oled_pending_dirty = 0;
+
+/**
+ * @brief Abandons a partially rendered frame, and releases what it already drew to be flushed
+ *
+ */
+static void oled_render_sections_reset(void) {
+    oled_dirty |= oled_pending_dirty;
+    oled_pending_dirty = 0;
+    oled_next_section  = 0;
+}
+
+/**
+ * @brief Renders the layout sections, time sliced to OLED_RENDER_BUDGET_US per pass
+ *
+ * Each pass renders sections until the budget runs out (but at least one), and picks up from there on the next pass.
+ * To keep the flushed frames consistent, the blocks dirtied by a partial frame are held back from the driver until
+ * the whole frame has been rendered, and a new frame isn't started until the last one has been completely flushed.
+ */
+static void oled_render_sections(void) {
+#if OLED_RENDER_BUDGET_US > 0
+    if (!oled_next_section && oled_dirty) {
+        return;
+    }
+    uint32_t start = timer_read_precise();
+    do {
+        oled_render_section[oled_next_section++]();
+    } while (oled_next_section < ARRAY_SIZE(oled_render_section) &&
+             timer_elapsed_precise_us(start) < OLED_RENDER_BUDGET_US);
+
+    oled_pending_dirty |= oled_dirty;
+    if (oled_next_section < ARRAY_SIZE(oled_render_section)) {
+        oled_dirty = 0;
+    } else {
+        oled_render_sections_reset();
     }
+#else
+    for (uint8_t i = 0; i < ARRAY_SIZE(oled_render_section); i++) {
+        oled_render_section[i]();
+    }
+#endif
+}
+
+static bool oled_task_render(void) {
+    static bool was_screensaver_enabled = false, was_keymap_override = false;
+#ifndef OLED_DISPLAY_TEST
+    if (!is_oled_enabled) {
+        oled_render_sections_reset();
+        oled_off();
+        return false;
+    } else
 #endif
+    {
+        oled_on();
+    }
 
+    if (oled_screensaver_enabled) {
+        was_screensaver_enabled = true;
+        oled_render_sections_reset();
+        render_oled_screensaver();
+        return false;
+    }
+    if (was_screensaver_enabled) {
+        was_screensaver_enabled = false;
+        oled_clear();
+        oled_invalidate_widgets();
+    }
+
+    // Keymap layouts use the same retained widgets, so only force a redraw when switching layouts. Anything the
+    // widgets skipped on the switching pass is redrawn on the next one.
+    bool is_keymap_override = !oled_task_keymap();
+    if (is_keymap_override != was_keymap_override) {
+        was_keymap_override = is_keymap_override;
+        oled_invalidate_widgets();
+    }
+    if (is_keymap_override) {
+        oled_render_sections_reset();
+        return false;
+    }
+
+    oled_render_sections();
     return false;
 }
 
+bool oled_task_user(void) {
+#ifdef OLED_CAPTURE_ENABLE
+    OLED_BLOCK_TYPE dirty_before = oled_dirty;
+    bool            ret          = oled_task_render();
+    oled_capture_record_frame(dirty_before);
+#else
+    bool ret = oled_task_render();
+#endif // OLED_CAPTURE_ENABLE
+    oled_profiler_flush();
+    return ret;
+}
+
 void housekeeping_task_oled(void) {
     is_oled_enabled = oled_screensaver_enabled = false;
 
@@ -28,6 +28,9 @@ void            oled_driver_render_logo(void);
 bool            process_record_user_oled(uint16_t keycode, keyrecord_t *record);
 oled_rotation_t oled_init_keymap(oled_rotation_t rotation, bool has_run);
 void            oled_timer_reset(void);
+void            oled_invalidate_widgets(void);
+void            oled_write_cells(const char *data, bool invert);
+void            oled_write_cells_P(const char *data, bool invert);
 void            render_keylogger_status(uint8_t col, uint8_t line);
 void            render_default_layer_state(uint8_t col, uint8_t line);
 void            render_layer_state(uint8_t col, uint8_t line);
@@ -50,6 +53,8 @@ void            render_rgb_hsv(uint8_t col, uint8_t line);
 void            render_rgb_mode(uint8_t col, uint8_t line);
 void            render_mouse_mode(uint8_t col, uint8_t line);
 void            render_autocorrected_info(uint8_t col, uint8_t line);
+void            render_transport_stats(uint8_t col, uint8_t line);
+void            render_split_telemetry(uint8_t col, uint8_t line);
 void            render_cyberpunk_logo(uint8_t col, uint8_t line);
 void            render_arasaka_logo(uint8_t col, uint8_t line);
 void            housekeeping_task_oled(void);
@@ -59,7 +64,33 @@ void            oled_render_time(uint8_t col, uint8_t line);
 void            render_os(uint8_t col, uint8_t line);
 
 void render_wpm_graph(uint8_t start_offset, uint8_t cutoff, uint8_t max_lines_graph, uint8_t vertical_offset);
-void oled_pan_section(bool left, uint16_t y_start, uint16_t y_end, uint16_t x_start, uint16_t x_end);
+
+typedef enum {
+    OLED_SCROLL_LEFT,
+    OLED_SCROLL_RIGHT,
+    OLED_SCROLL_UP,
+    OLED_SCROLL_DOWN,
+} oled_scroll_direction_t;
+
+void oled_scroll_region(oled_scroll_direction_t direction, uint8_t amount, bool wrap, uint8_t x_start, uint8_t x_end,
+                        uint8_t page_start, uint8_t page_end);
+
+typedef struct {
+    const uint16_t *map;
+    uint8_t         width;
+    uint8_t         pages;
+    uint8_t         frames;
+} oled_sprite_t;
+
+typedef struct {
+    uint16_t *tiles;
+    uint8_t   col;
+    uint8_t   line;
+    uint8_t   generation;
+} oled_sprite_cache_t;
+
+void oled_sprite_draw(const oled_sprite_t *sprite, oled_sprite_cache_t *cache, uint8_t frame, uint8_t col,
+                      uint8_t line);
 
 #if defined(OLED_DISPLAY_128X128) || defined(OLED_DISPLAY_128X64)
 #    define OLED_DISPLAY_VERBOSE
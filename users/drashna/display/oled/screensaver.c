@@ -3,26 +3,102 @@
 #include "timer.h"
 #include "util.h"
 
-#include "screensavers/matrix_scroll.h"
+// Generated from screensavers/matrix_scroll.h with screensavers/encode_screensaver.py
+#include "screensavers/matrix_scroll_compressed.h"
+
+#if defined(SCREENSAVER_FRAME_COUNT) && !defined(SCREENSAVER_ANIM_DISABLE)
+#    define SCREENSAVER_ANIM_ENABLED
+#endif
 
 #define FRAME_DURATION 30 // How long each frame lasts in milliseconds
+#define RESTART_GAP    (FRAME_DURATION * 10) // Not rendered for this long means the buffer has been drawn over
+
+#define SCREENSAVER_OP_SKIP      0x00
+#define SCREENSAVER_OP_COPY      0x40
+#define SCREENSAVER_OP_FILL      0x80
+#define SCREENSAVER_OP_SKIP_LONG 0xC0
+#define SCREENSAVER_OP_MASK      0xC0
+#define SCREENSAVER_LONG_SKIP    64
+
+#if defined(SCREENSAVER_ANIM_ENABLED)
+_Static_assert(SCREENSAVER_FRAME_SIZE == OLED_MATRIX_SIZE, "Screensaver frames don't match the OLED buffer size");
+
+extern uint8_t         oled_buffer[OLED_MATRIX_SIZE];
+extern OLED_BLOCK_TYPE oled_dirty;
+
+/**
+ * @brief Writes a single byte to the oled buffer, marking the block as dirty only if it has changed
+ *
+ * @param index index into the oled buffer
+ * @param value byte to write
+ */
+static inline void screensaver_patch(uint16_t index, uint8_t value) {
+    if (index < OLED_MATRIX_SIZE && oled_buffer[index] != value) {
+        oled_buffer[index] = value;
+        oled_dirty |= ((OLED_BLOCK_TYPE)1 << (index / OLED_BLOCK_SIZE));
+    }
+}
+
+/**
+ * @brief Applies a delta from the compressed screensaver, directly to the oled buffer
+ *
+ * See screensavers/encode_screensaver.py for the format.
+ *
+ * @param delta index of the delta, 0 is the keyframe, otherwise the delta into frame (delta - 1)
+ */
+static void screensaver_apply_delta(uint8_t delta) {
+    const uint8_t *data  = &screensaver_data[pgm_read_word(&screensaver_offsets[delta])];
+    const uint8_t *end   = &screensaver_data[pgm_read_word(&screensaver_offsets[delta + 1])];
+    uint16_t       index = 0;
+
+    while (data < end && index < OLED_MATRIX_SIZE) {
+        uint8_t op     = pgm_read_byte(data++);
+        uint8_t length = (op & ~SCREENSAVER_OP_MASK) + 1;
+        switch (op & SCREENSAVER_OP_MASK) {
+            case SCREENSAVER_OP_SKIP:
+                index += length;
+                break;
+            case SCREENSAVER_OP_SKIP_LONG:
+                index += length * SCREENSAVER_LONG_SKIP;
+                break;
+            case SCREENSAVER_OP_FILL:
+                {
+                    uint8_t value = pgm_read_byte(data++);
+                    for (; length; length--) {
+                        screensaver_patch(index++, value);
+                    }
+                    break;
+                }
+            default:
+                for (; length; length--) {
+                    screensaver_patch(index++, pgm_read_byte(data++));
+                }
+                break;
+        }
+    }
+}
+#endif
 
 void render_oled_screensaver(void) {
 #if defined(SCREENSAVER_ANIM_ENABLED)
     static uint32_t timer         = 0;
+    static uint32_t last_render   = 0;
     static uint8_t  current_frame = 0;
 
-    // Run animation
-    if (timer_elapsed(timer) > FRAME_DURATION) {
+    // Restart from the keyframe if something else has been drawn since the last frame
+    if (!last_render || timer_elapsed32(last_render) > RESTART_GAP) {
+        screensaver_apply_delta(0);
+        current_frame = 0;
+        timer         = timer_read32();
+    } else if (timer_elapsed32(timer) > FRAME_DURATION) {
         // Set timer to updated time
-        timer = timer_read();
+        timer = timer_read32();
 
-        // Increment frame
-        current_frame = (current_frame + 1) % ARRAY_SIZE(screensaver);
+        // Increment frame, and patch in only what changed from the last one
+        current_frame = (current_frame + 1) % SCREENSAVER_FRAME_COUNT;
+        screensaver_apply_delta(current_frame + 1);
     }
-
-    // Draw frame to OLED
-    oled_write_raw_P(screensaver[current_frame], ARRAY_SIZE(screensaver[current_frame]));
+    last_render = timer_read32() | 1;
 
 #else
     oled_off();
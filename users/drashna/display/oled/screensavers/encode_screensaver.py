@@ -0,0 +1,209 @@
+#!/usr/bin/env python3
+# Copyright 2024 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+# SPDX-License-Identifier: GPL-3.0-or-later
+"""Compresses raw OLED screensaver frames into inter-frame deltas, for screensaver.c.
+
+Reads a header with a `static const char <name>[frames][size+1] PROGMEM` array of raw frames, and writes a header
+with a keyframe (the first frame, in full), plus a delta from each frame to the next, looping from the last frame back
+to the first. Each delta is a stream of ops, where the top two bits of the op byte are the type, and the low six bits
+are the length minus one:
+
+    0b00LLLLLL              skip L+1 unchanged bytes
+    0b01LLLLLL [L+1 bytes]  copy L+1 bytes
+    0b10LLLLLL [byte]       fill L+1 bytes with a value
+    0b11LLLLLL              skip (L+1)*64 unchanged bytes
+
+Trailing unchanged bytes are not encoded, the decoder stops at the start of the next delta.
+
+Usage: encode_screensaver.py matrix_scroll.h matrix_scroll_compressed.h
+"""
+import re
+import sys
+from pathlib import Path
+
+OP_SKIP = 0x00
+OP_COPY = 0x40
+OP_FILL = 0x80
+OP_SKIP_LONG = 0xC0
+MAX_RUN = 64
+MIN_FILL = 3
+
+
+def parse_frames(text):
+    """Finds each frame array, along with the preprocessor condition that it is under"""
+    arrays = []
+    pattern = re.compile(r'(\w+)\s*\[(\d+)\]\s*\[(\d+)\s*(?:\+\s*1)?\]\s*PROGMEM\s*=\s*\{')
+    for match in pattern.finditer(text):
+        name, count, size = match.group(1), int(match.group(2)), int(match.group(3))
+        conditions = re.findall(r'^#(?:el)?if\s+(.*)$', text[:match.start()], re.MULTILINE)
+        end = text.index('};', match.end())
+        body = re.sub(r'//[^\n]*', '', text[match.end():end])
+        frames = []
+        for block in re.findall(r'\{([^{}]*)\}', body):
+            values = [int(v, 0) for v in block.split(',') if v.strip()]
+            frames.append(bytes(values[:size]).ljust(size, b'\0'))
+        if len(frames) != count:
+            raise ValueError(f'{name}: expected {count} frames, found {len(frames)}')
+        arrays.append((conditions[-1].strip() if conditions else None, name, size, frames))
+    if not arrays:
+        raise ValueError('no frame arrays found')
+    return arrays
+
+
+def fill_length(frame, i):
+    length = 1
+    while i + length < len(frame) and length < MAX_RUN and frame[i + length] == frame[i]:
+        length += 1
+    return length
+
+
+def encode_delta(frame, previous=None):
+    """Encodes the ops to turn `previous` into `frame`, or to write all of `frame` if there is no previous frame"""
+    out = bytearray()
+    size = len(frame)
+
+    def unchanged(i):
+        return previous is not None and i < size and frame[i] == previous[i]
+
+    i = 0
+    while i < size:
+        if unchanged(i):
+            start = i
+            while unchanged(i):
+                i += 1
+            if i == size:
+                break
+            skip = i - start
+            while skip >= MAX_RUN:
+                blocks = min(skip // MAX_RUN, MAX_RUN)
+                out.append(OP_SKIP_LONG | (blocks - 1))
+                skip -= blocks * MAX_RUN
+            if skip:
+                out.append(OP_SKIP | (skip - 1))
+            continue
+
+        run = fill_length(frame, i)
+        if run >= MIN_FILL:
+            out += bytes((OP_FILL | (run - 1), frame[i]))
+            i += run
+            continue
+
+        # copy until the next run worth breaking out for, a single unchanged byte is cheaper to copy than to skip
+        start = i
+        while i < size and i - start < MAX_RUN:
+            if unchanged(i) and unchanged(i + 1):
+                break
+            if fill_length(frame, i) >= MIN_FILL:
+                break
+            i += 1
+        out.append(OP_COPY | (i - start - 1))
+        out += frame[start:i]
+    return bytes(out)
+
+
+def decode_delta(data, buffer):
+    i = 0
+    pos = 0
+    while pos < len(data):
+        op = data[pos]
+        length = (op & 0x3F) + 1
+        pos += 1
+        if op & 0xC0 == OP_SKIP:
+            i += length
+        elif op & 0xC0 == OP_SKIP_LONG:
+            i += length * MAX_RUN
+        elif op & 0xC0 == OP_FILL:
+            buffer[i:i + length] = bytes([data[pos]]) * length
+            pos += 1
+            i += length
+        else:
+            buffer[i:i + length] = data[pos:pos + length]
+            pos += length
+            i += length
+
+
+def format_bytes(data, indent='    ', per_line=32):
+    lines = []
+    for i in range(0, len(data), per_line):
+        lines.append(indent + ', '.join(f'0x{b:02X}' for b in data[i:i + per_line]) + ',')
+    return '\n'.join(lines)
+
+
+def format_offsets(offsets, indent='    ', per_line=16):
+    lines = []
+    for i in range(0, len(offsets), per_line):
+        lines.append(indent + ', '.join(str(o) for o in offsets[i:i + per_line]) + ',')
+    return '\n'.join(lines)
+
+
+def encode_array(name, size, frames):
+    deltas = [encode_delta(frames[0])]
+    for index, frame in enumerate(frames):
+        deltas.append(encode_delta(frame, frames[index - 1]))
+
+    # make sure that the stream plays back exactly, including looping around
+    buffer = bytearray(size)
+    decode_delta(deltas[0], buffer)
+    assert buffer == frames[0], f'{name}: keyframe mismatch'
+    for index in range(1, len(frames) + 1):
+        decode_delta(deltas[(index % len(frames)) + 1], buffer)
+        assert buffer == frames[index % len(frames)], f'{name}: frame {index % len(frames)} mismatch'
+
+    data = b''.join(deltas)
+    offsets = [0]
+    for delta in deltas:
+        offsets.append(offsets[-1] + len(delta))
+    offset_type = 'uint16_t' if offsets[-1] <= 0xFFFF else 'uint32_t'
+    raw_size = len(frames) * (size + 1)
+    packed_size = len(data) + len(offsets) * (2 if offset_type == 'uint16_t' else 4)
+    print(f'{name}[{len(frames)}][{size}]: {raw_size} -> {packed_size} bytes ({packed_size * 100 // raw_size}%)')
+
+    return f'''// {len(frames)} frames, {raw_size} bytes raw, {packed_size} bytes compressed
+#    define SCREENSAVER_FRAME_COUNT {len(frames)}
+#    define SCREENSAVER_FRAME_SIZE  {size}
+#    define SCREENSAVER_DATA_SIZE   {len(data)}
+
+// clang-format off
+// offset of the keyframe, then of the delta into each frame, and the end of the data
+static const {offset_type} {name}_offsets[SCREENSAVER_FRAME_COUNT + 2] PROGMEM = {{
+{format_offsets(offsets)}
+}};
+
+static const uint8_t {name}_data[SCREENSAVER_DATA_SIZE] PROGMEM = {{
+{format_bytes(data)}
+}};
+// clang-format on
+'''
+
+
+def main(argv):
+    if len(argv) != 3:
+        print(__doc__.strip().splitlines()[-1])
+        return 1
+    source, output = Path(argv[1]), Path(argv[2])
+
+    header = f'''// Copyright 2024 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Generated by encode_screensaver.py from {source.name}, do not edit.
+
+#pragma once
+
+#include <stdint.h>
+#include "progmem.h"
+
+'''
+    arrays = parse_frames(source.read_text())
+    for index, (condition, name, size, frames) in enumerate(arrays):
+        if condition:
+            header += f'#{"el" if index else ""}if {condition}\n'
+        header += encode_array(name, size, frames)
+    if any(condition for condition, _, _, _ in arrays):
+        header += '#endif\n'
+
+    output.write_text(header)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
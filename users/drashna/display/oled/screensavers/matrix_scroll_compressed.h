@@ -0,0 +1,693 @@
+// Copyright 2024 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Generated by encode_screensaver.py from matrix_scroll.h, do not edit.
+
+#pragma once
+
+#include <stdint.h>
+#include "progmem.h"
+
+#if defined(OLED_DISPLAY_128X128)
+// 72 frames, 147528 bytes raw, 13686 bytes compressed
+#    define SCREENSAVER_FRAME_COUNT 72
+#    define SCREENSAVER_FRAME_SIZE  2048
+#    define SCREENSAVER_DATA_SIZE   13538
+
+// clang-format off
+// offset of the keyframe, then of the delta into each frame, and the end of the data
+static const uint16_t screensaver_offsets[SCREENSAVER_FRAME_COUNT + 2] PROGMEM = {
+    0, 1101, 1309, 1537, 1642, 1840, 2027, 2204, 2359, 2558, 2699, 2905, 3057, 3226, 3386, 3531,
+    3663, 3907, 4039, 4250, 4426, 4581, 4701, 4850, 4986, 5164, 5292, 5463, 5649, 5825, 5992, 6122,
+    6254, 6387, 6558, 6684, 6834, 7002, 7137, 7318, 7477, 7660, 7858, 8013, 8158, 8352, 8566, 8738,
+    8884, 9028, 9212, 9435, 9619, 9837, 10055, 10243, 10425, 10633, 10871, 11012, 11207, 11415, 11553, 11781,
+    11960, 12137, 12332, 12554, 12626, 12818, 12958, 13208, 13377, 13538,
+};
+
+static const uint8_t screensaver_data[SCREENSAVER_DATA_SIZE] PROGMEM = {
+    0x89, 0x00, 0x43, 0x1C, 0x62, 0xA2, 0x9C, 0xA2, 0x00, 0x49, 0x1C, 0xC8, 0x3C, 0x00, 0x00, 0x74, 0x04, 0xFF, 0xF4, 0x84, 0x92, 0x00, 0x43, 0xFF, 0x40, 0x60, 0x18, 0x84, 0x00, 0x42, 0xFF, 0x08,
+    0x10, 0x87, 0x00, 0x4E, 0x38, 0x06, 0x0C, 0x70, 0x40, 0x04, 0x84, 0x7F, 0x04, 0x04, 0xF8, 0x04, 0x02, 0x1C, 0x60, 0x84, 0x00, 0x49, 0x69, 0x49, 0x92, 0x00, 0x04, 0x84, 0x7F, 0x04, 0x04, 0xC0,
+    0x89, 0x00, 0x43, 0x09, 0x89, 0x79, 0x0F, 0xA2, 0x00, 0x43, 0xCD, 0x38, 0x78, 0x84, 0x82, 0x00, 0x40, 0x01, 0x94, 0x00, 0x44, 0x38, 0x06, 0x0C, 0x70, 0x40, 0x84, 0x00, 0x42, 0xFC, 0x14, 0x1C,
+    0x8B, 0x00, 0x47, 0x09, 0x89, 0x79, 0x0F, 0x02, 0x72, 0x8A, 0x8E, 0x85, 0x00, 0x4A, 0x38, 0x08, 0x8E, 0x78, 0x80, 0x84, 0xFD, 0x84, 0x80, 0x42, 0x42, 0x88, 0x00, 0x49, 0xC0, 0xB1, 0x8C, 0xC0,
+    0x00, 0x84, 0x84, 0xFC, 0x84, 0x84, 0x9C, 0x00, 0x44, 0x08, 0x08, 0xF8, 0x08, 0x08, 0x98, 0x00, 0x43, 0x82, 0x62, 0x3E, 0xC4, 0x85, 0x00, 0x44, 0x12, 0x12, 0xF2, 0x12, 0x10, 0x89, 0x00, 0x48,
+    0xF9, 0x64, 0x14, 0xF8, 0x00, 0x08, 0x3E, 0xFE, 0x08, 0x85, 0x00, 0x44, 0xD3, 0x92, 0x24, 0x00, 0xF8, 0x82, 0x28, 0x41, 0x00, 0xF0, 0x89, 0x00, 0x47, 0xE0, 0x18, 0x31, 0xC0, 0x00, 0x10, 0xF0,
+    0x10, 0x9E, 0x00, 0x42, 0x90, 0x51, 0x30, 0x99, 0x00, 0x43, 0x49, 0xF0, 0xE0, 0x31, 0x84, 0x00, 0x44, 0x08, 0x88, 0xEE, 0x59, 0x80, 0x8B, 0x00, 0x48, 0xFD, 0x01, 0xC0, 0x00, 0x2A, 0x29, 0xF8,
+    0x24, 0x20, 0x84, 0x00, 0x43, 0x10, 0xF0, 0x11, 0x00, 0x83, 0x01, 0x41, 0xFC, 0x11, 0x89, 0x00, 0x49, 0x48, 0x48, 0x90, 0x01, 0x01, 0x52, 0x53, 0xF2, 0x48, 0x40, 0x9C, 0x00, 0x43, 0xE3, 0x12,
+    0x12, 0xE0, 0x98, 0x00, 0x42, 0xC0, 0x33, 0x04, 0x85, 0x00, 0x44, 0x41, 0x40, 0xF7, 0x40, 0x01, 0x8A, 0x00, 0x47, 0x96, 0xE3, 0xC1, 0x60, 0x00, 0x00, 0x06, 0x01, 0x86, 0x00, 0x42, 0x22, 0xC3,
+    0xFA, 0x84, 0x00, 0x41, 0xC3, 0x3E, 0x89, 0x00, 0x48, 0x03, 0x02, 0x04, 0x00, 0x10, 0x10, 0xDC, 0xD3, 0x30, 0x86, 0x00, 0x40, 0xF0, 0x82, 0x00, 0x82, 0x20, 0x40, 0xE0, 0x83, 0x00, 0x44, 0x10,
+    0x10, 0xD0, 0xD0, 0x30, 0x85, 0x00, 0x43, 0xE0, 0x23, 0x25, 0xE4, 0x97, 0x00, 0x44, 0x03, 0x82, 0x42, 0x27, 0xC0, 0x84, 0x00, 0x44, 0x06, 0x99, 0x9F, 0x90, 0x80, 0x8A, 0x00, 0x42, 0xC0, 0x87,
+    0xC9, 0x8B, 0x00, 0x43, 0x96, 0x91, 0x91, 0xF0, 0x84, 0x00, 0x40, 0x08, 0x84, 0x00, 0x42, 0xC0, 0x80, 0xC0, 0x86, 0x00, 0x43, 0xF8, 0x07, 0x00, 0xF0, 0x85, 0x00, 0x47, 0x58, 0x8F, 0xF4, 0x03,
+    0x00, 0x88, 0x64, 0x03, 0x85, 0x00, 0x43, 0x58, 0xFF, 0x20, 0x20, 0x85, 0x00, 0x43, 0x46, 0xF9, 0xF9, 0x4F, 0x8F, 0x00, 0x43, 0x10, 0x10, 0xF0, 0x20, 0x83, 0x00, 0x4E, 0x40, 0x4F, 0xC0, 0x40,
+    0x41, 0x06, 0x40, 0x40, 0xF8, 0x40, 0x40, 0x00, 0x10, 0xFC, 0x03, 0x89, 0x00, 0x44, 0xE0, 0x31, 0x3C, 0x23, 0xE0, 0x89, 0x00, 0x43, 0xF0, 0x90, 0x08, 0x07, 0x8B, 0x00, 0x43, 0xB1, 0x4C, 0x03,
+    0x80, 0x85, 0x00, 0x43, 0x50, 0x88, 0x07, 0x80, 0x85, 0x00, 0x48, 0x4C, 0x43, 0x43, 0xC0, 0x06, 0x25, 0x24, 0x2E, 0x20, 0x84, 0x00, 0x44, 0x82, 0x81, 0xFF, 0x81, 0xE1, 0x82, 0x80, 0x45, 0x00,
+    0x00, 0x50, 0x89, 0x07, 0x80, 0x85, 0x00, 0x82, 0x80, 0x85, 0x00, 0x44, 0x80, 0x8C, 0xF3, 0x81, 0x0E, 0x83, 0x00, 0x4C, 0x40, 0x40, 0xCF, 0x40, 0x40, 0x00, 0xE7, 0xE0, 0x1F, 0x0F, 0x08, 0x0C,
+    0x03, 0x8B, 0x00, 0x44, 0x01, 0x40, 0x50, 0xCC, 0x23, 0x89, 0x00, 0x42, 0x0F, 0x00, 0x01, 0x8C, 0x00, 0x43, 0x11, 0xC8, 0x44, 0x03, 0x84, 0x00, 0x44, 0x80, 0x82, 0x9F, 0xA7, 0x81, 0x85, 0x00,
+    0x49, 0x50, 0x48, 0x46, 0x01, 0x00, 0x01, 0xA1, 0x1F, 0x01, 0x01, 0x83, 0x00, 0x44, 0x80, 0xB0, 0x8F, 0x40, 0x1F, 0x82, 0x50, 0x45, 0x00, 0x00, 0x82, 0x9F, 0xA7, 0x81, 0x84, 0x00, 0x44, 0x90,
+    0x90, 0xFF, 0x90, 0x10, 0x84, 0x00, 0x43, 0x20, 0x18, 0xD7, 0x1F, 0x84, 0x00, 0x49, 0x08, 0x08, 0x0F, 0x08, 0x08, 0x00, 0x63, 0x5F, 0x40, 0xC0, 0x8F, 0x00, 0x44, 0x01, 0x31, 0xEF, 0x01, 0x01,
+    0x89, 0x00, 0x83, 0x01, 0x8A, 0x00, 0x44, 0x98, 0x97, 0x10, 0x1C, 0x20, 0x83, 0x00, 0x44, 0x10, 0x10, 0xDF, 0x10, 0x10, 0x85, 0x00, 0x47, 0x02, 0x42, 0x32, 0x0E, 0x32, 0x4A, 0x7F, 0x02, 0x85,
+    0x00, 0x49, 0x02, 0x62, 0x1F, 0x02, 0x02, 0x82, 0xC2, 0xB2, 0x0E, 0x00, 0x83, 0x10, 0x84, 0x00, 0x44, 0x10, 0x08, 0x7E, 0x05, 0x18, 0x85, 0x00, 0x43, 0x60, 0x3F, 0x10, 0x0C, 0x89, 0x00, 0x43,
+    0x31, 0x8A, 0x0F, 0x10, 0x8E, 0x00, 0x45, 0x80, 0x31, 0x4D, 0x7F, 0x01, 0x01, 0x89, 0x00, 0x40, 0xBF, 0x82, 0x25, 0x8A, 0x00, 0x42, 0x34, 0x24, 0x49, 0x86, 0x00, 0x51, 0x8E, 0x6D, 0x3F, 0x01,
+    0x00, 0x7E, 0x1C, 0x0C, 0x7E, 0x06, 0x03, 0x7F, 0x80, 0x00, 0x64, 0x94, 0xFF, 0x04, 0x85, 0x00, 0x48, 0x72, 0x4A, 0x46, 0x00, 0x00, 0x04, 0x84, 0x64, 0x1C, 0x8A, 0x00, 0x44, 0x1C, 0x03, 0x06,
+    0x38, 0x20, 0x84, 0x00, 0x43, 0x66, 0x1C, 0xBC, 0x42, 0x89, 0x00, 0x43, 0x87, 0x43, 0x30, 0x0F, 0x8E, 0x00, 0x42, 0x7F, 0x04, 0x08, 0x8C, 0x00, 0x43, 0x7F, 0x20, 0x30, 0x0C, 0x8A, 0x00, 0x43,
+    0x7C, 0x82, 0x82, 0x7C, 0x84, 0x00, 0x53, 0x80, 0x84, 0xFC, 0x84, 0x80, 0x00, 0xFE, 0x42, 0xFE, 0x00, 0x00, 0x74, 0x04, 0xFF, 0xF4, 0x84, 0x82, 0xC2, 0x32, 0x0E, 0x83, 0x00, 0x82, 0x42, 0x46,
+    0xFE, 0x00, 0x01, 0x81, 0x7D, 0x0D, 0x03, 0x8A, 0x00, 0x42, 0xFC, 0x14, 0x1C, 0x86, 0x00, 0x44, 0x74, 0x04, 0xFF, 0xF4, 0x84, 0x88, 0x00, 0x44, 0x09, 0x09, 0xF9, 0x09, 0x08, 0xAC, 0x00, 0x44,
+    0x04, 0x84, 0x7F, 0x04, 0x04, 0x84, 0x00, 0x52, 0xF8, 0x04, 0x02, 0x1C, 0x60, 0x04, 0xF4, 0x1C, 0x04, 0x42, 0x42, 0x7E, 0x43, 0x42, 0x1E, 0x02, 0x03, 0xC2, 0x3E, 0x84, 0x00, 0x40, 0xFC, 0x82,
+    0x94, 0x44, 0x04, 0x05, 0xFC, 0x04, 0x04, 0x8A, 0x00, 0x43, 0x08, 0xFF, 0xA4, 0x9C, 0x85, 0x00, 0x43, 0x0E, 0x87, 0x61, 0x1E, 0x89, 0x00, 0x44, 0x04, 0x85, 0x7F, 0x04, 0x04, 0xAB, 0x00, 0x44,
+    0x3C, 0x04, 0x07, 0x84, 0x7C, 0x8A, 0x00, 0x40, 0xF9, 0x82, 0x28, 0x49, 0x00, 0x14, 0x14, 0xFC, 0x12, 0x10, 0x38, 0xB7, 0xFC, 0x04, 0x83, 0x00, 0x49, 0x10, 0x14, 0xFC, 0x14, 0x14, 0x00, 0x00,
+    0xFE, 0x80, 0x60, 0x8A, 0x00, 0x43, 0x38, 0xB7, 0xFC, 0x04, 0x85, 0x00, 0x44, 0x09, 0x08, 0xFE, 0x08, 0x08, 0x88, 0x00, 0x42, 0x08, 0xF9, 0x08, 0x85, 0x00, 0x44, 0x08, 0x08, 0xF8, 0x08, 0x08,
+    0xA3, 0x00, 0x43, 0x08, 0x0A, 0x09, 0x08, 0x8A, 0x00, 0x4D, 0xB9, 0x49, 0x49, 0xF9, 0x00, 0x10, 0xD3, 0x70, 0x10, 0x00, 0x0A, 0x09, 0x08, 0x08, 0x84, 0x00, 0x48, 0x30, 0xE1, 0xE1, 0x11, 0x00,
+    0x07, 0xC5, 0x7C, 0x88, 0x8A, 0x00, 0x43, 0xE2, 0x91, 0xF0, 0x80, 0x85, 0x00, 0x44, 0x28, 0x2B, 0xF8, 0x24, 0x20, 0x87, 0x00, 0x44, 0x61, 0x1F, 0x11, 0xF1, 0x11, 0x84, 0x00, 0x42, 0xFC, 0x20,
+    0x41, 0xA5, 0x00, 0x43, 0x11, 0x11, 0xF1, 0x01, 0x8A, 0x00, 0x4D, 0x21, 0xA2, 0x62, 0x03, 0x00, 0x04, 0xFB, 0x00, 0x80, 0x00, 0xC1, 0x31, 0x01, 0x01, 0x83, 0x00, 0x49, 0x10, 0x13, 0xF0, 0x11,
+    0x12, 0x00, 0xFB, 0x00, 0x00, 0xC3, 0x85, 0x00, 0x48, 0xE0, 0xDC, 0xF0, 0x10, 0x00, 0x0B, 0x88, 0xF8, 0x13, 0x84, 0x00, 0x44, 0x10, 0x10, 0xF6, 0x11, 0x10, 0x88, 0x00, 0x44, 0x20, 0x24, 0xE3,
+    0x20, 0x20, 0x84, 0x00, 0x45, 0x03, 0x20, 0xFC, 0x90, 0x90, 0x80, 0x9D, 0x00, 0xC0, 0x21, 0x44, 0x38, 0x06, 0x0C, 0x70, 0x40, 0x27, 0xA1, 0x00, 0x43, 0xCD, 0x38, 0x78, 0x84, 0xC2, 0x3A, 0x43,
+    0x00, 0x90, 0x51, 0x30, 0x99, 0x00, 0x43, 0x49, 0xF0, 0xE0, 0x31, 0x22, 0x44, 0x00, 0x10, 0xF0, 0x11, 0x00, 0x1E, 0x97, 0x00, 0x42, 0xE3, 0x12, 0x12, 0x19, 0x42, 0xC0, 0x33, 0x04, 0x85, 0x00,
+    0x0F, 0x43, 0x96, 0xE3, 0xC1, 0x60, 0x09, 0x43, 0x00, 0x22, 0xC3, 0xFA, 0x84, 0x00, 0x1A, 0x41, 0x00, 0xF0, 0x82, 0x00, 0x82, 0x20, 0x22, 0x88, 0x00, 0x1A, 0x41, 0x87, 0xC9, 0x8B, 0x00, 0x42,
+    0x96, 0x91, 0x91, 0x34, 0x82, 0x00, 0x0A, 0x88, 0x00, 0x42, 0x10, 0x10, 0xF0, 0x11, 0x40, 0xFC, 0xC0, 0x10, 0x82, 0x80, 0x0A, 0x40, 0x00, 0x82, 0x80, 0x19, 0x41, 0x0C, 0x03, 0xC3, 0x1B, 0x40,
+    0xBF, 0x23, 0x40, 0x80, 0xC0, 0x19, 0x43, 0x7F, 0x20, 0x30, 0x0C, 0x1E, 0x44, 0x74, 0x04, 0xFF, 0xF4, 0x84, 0xC0, 0x3B, 0x41, 0x7E, 0x43, 0x0E, 0x44, 0x04, 0x05, 0xFC, 0x04, 0x04, 0x14, 0x43,
+    0x0E, 0x87, 0x61, 0x1E, 0x89, 0x00, 0x09, 0xA6, 0x00, 0x28, 0x40, 0xFE, 0x0C, 0x43, 0x38, 0xB7, 0xFC, 0x04, 0x05, 0x44, 0x09, 0x08, 0xFE, 0x08, 0x08, 0xC0, 0x0E, 0x44, 0x10, 0xD3, 0x70, 0x10,
+    0x00, 0x1C, 0x41, 0xE2, 0x91, 0x06, 0x43, 0x00, 0x28, 0x2B, 0xF8, 0xC0, 0x10, 0x42, 0x04, 0xFB, 0x00, 0x23, 0x83, 0x00, 0x0D, 0x44, 0x20, 0x24, 0xE3, 0x20, 0x20, 0x84, 0x00, 0xC0, 0x3E, 0x40,
+    0x8D, 0x09, 0x43, 0x7C, 0x82, 0x82, 0x7C, 0xC0, 0x3B, 0x40, 0xB0, 0xC2, 0x02, 0x43, 0x39, 0x48, 0x98, 0x01, 0x27, 0x43, 0xF1, 0xE1, 0x61, 0xF1, 0xC0, 0x0E, 0x43, 0x02, 0xC2, 0x32, 0x03, 0x1B,
+    0x42, 0xFE, 0x09, 0x80, 0x09, 0x40, 0x03, 0x01, 0x40, 0x03, 0x0B, 0x43, 0x53, 0x92, 0xD4, 0x30, 0x17, 0x8A, 0x00, 0x36, 0x48, 0x3F, 0x29, 0xE0, 0x00, 0x03, 0x02, 0x02, 0x03, 0x04, 0x13, 0x84,
+    0x00, 0x43, 0x0C, 0x02, 0x03, 0x04, 0x18, 0x41, 0x40, 0xF8, 0x1B, 0x87, 0x00, 0x05, 0x85, 0x00, 0x0E, 0x41, 0x38, 0x27, 0x1A, 0x42, 0xA0, 0x40, 0x00, 0x3C, 0x42, 0x80, 0xF0, 0x80, 0x84, 0x00,
+    0x05, 0x41, 0xE0, 0xE0, 0x82, 0x00, 0x1D, 0x42, 0x80, 0x81, 0x80, 0x14, 0x40, 0x00, 0x02, 0x40, 0x01, 0x3A, 0x43, 0x88, 0x8F, 0x88, 0x88, 0x23, 0x42, 0x1C, 0x12, 0x11, 0x8B, 0x00, 0x08, 0x44,
+    0x00, 0x20, 0xE8, 0x38, 0x27, 0x39, 0x44, 0x02, 0x02, 0x3F, 0x22, 0x22, 0x23, 0x43, 0xA2, 0x22, 0x3E, 0x20, 0x19, 0x83, 0x00, 0x18, 0x42, 0x7E, 0x0A, 0x0E, 0xC1, 0x31, 0x43, 0x80, 0x8E, 0x92,
+    0xE6, 0x2D, 0x44, 0x00, 0x04, 0x9F, 0x7F, 0x04, 0xC0, 0x31, 0x43, 0xDC, 0x24, 0x24, 0xFC, 0x05, 0x40, 0x15, 0x02, 0x43, 0xFE, 0x08, 0x09, 0x08, 0x84, 0x00, 0x13, 0x44, 0x10, 0x14, 0xFC, 0x14,
+    0x14, 0xC0, 0x04, 0x42, 0x08, 0x08, 0xFA, 0x08, 0x82, 0x01, 0x09, 0x40, 0x01, 0x82, 0x09, 0x19, 0x43, 0xE0, 0x91, 0xF1, 0x81, 0xC0, 0x04, 0x40, 0x01, 0x30, 0x84, 0x00, 0x43, 0x4B, 0x48, 0x48,
+    0xC3, 0x2B, 0x44, 0xC4, 0x34, 0xFF, 0x04, 0x04, 0xC0, 0x3B, 0x41, 0x01, 0x01, 0x06, 0x43, 0xC5, 0x29, 0x3D, 0x43, 0x26, 0x42, 0x0C, 0x06, 0xFE, 0x24, 0x43, 0x00, 0x10, 0x10, 0xF0, 0xC0, 0x3B,
+    0x44, 0x20, 0xA1, 0xF9, 0x21, 0x01, 0xC0, 0x3A, 0x45, 0x03, 0x4C, 0x4F, 0x90, 0x00, 0x00, 0xC2, 0x2F, 0x40, 0x28, 0xC0, 0x34, 0x44, 0x80, 0xB0, 0xE8, 0xA7, 0xA0, 0x03, 0x41, 0x04, 0x04, 0x2A,
+    0x40, 0x81, 0x84, 0x00, 0x12, 0x88, 0x00, 0x27, 0x44, 0x00, 0x80, 0x8F, 0x88, 0x08, 0x30, 0x40, 0x00, 0x82, 0x40, 0x14, 0x42, 0x00, 0x00, 0xC0, 0x85, 0x00, 0xC4, 0x00, 0x44, 0x00, 0x82, 0xA2,
+    0xE2, 0x9C, 0xC4, 0x08, 0xA7, 0x00, 0xC0, 0x19, 0x40, 0x40, 0xC2, 0x17, 0x42, 0xC0, 0x30, 0x0F, 0x32, 0xA1, 0x00, 0xC4, 0x08, 0x44, 0x40, 0x53, 0xF0, 0x50, 0x53, 0x1B, 0x96, 0x00, 0x3A, 0x42,
+    0x43, 0x82, 0xF2, 0x0B, 0x42, 0x07, 0x04, 0x04, 0x0B, 0x43, 0xEC, 0x72, 0x03, 0xE4, 0x0A, 0x46, 0x40, 0x80, 0xF0, 0x00, 0x00, 0x80, 0x60, 0x86, 0x00, 0xC0, 0x04, 0x42, 0x0C, 0x03, 0x03, 0x05,
+    0x44, 0x00, 0xD0, 0x88, 0x87, 0xC0, 0x0A, 0x84, 0x00, 0x43, 0x10, 0x08, 0x06, 0x01, 0x2C, 0x91, 0x00, 0x05, 0x83, 0x00, 0x43, 0x20, 0x2C, 0x23, 0xE0, 0x1A, 0x43, 0x0F, 0x83, 0x81, 0x0F, 0x0A,
+    0x42, 0x00, 0xC0, 0x40, 0x86, 0x00, 0x21, 0x43, 0x02, 0x1F, 0x27, 0x01, 0x04, 0x43, 0x80, 0x80, 0xE0, 0x80, 0x8E, 0x00, 0x05, 0x82, 0x40, 0x00, 0x82, 0x11, 0x40, 0x1F, 0x1A, 0x43, 0x9F, 0x84,
+    0x87, 0x1C, 0x36, 0x43, 0x41, 0x3D, 0x07, 0x01, 0x0F, 0x87, 0x00, 0x27, 0x44, 0x10, 0x90, 0x10, 0x1F, 0x10, 0xC1, 0x36, 0x43, 0x04, 0xF4, 0x1C, 0x04, 0xC0, 0x00, 0x43, 0x7C, 0x82, 0x82, 0x7C,
+    0x36, 0x40, 0x01, 0x34, 0x43, 0x7C, 0x82, 0x82, 0x7C, 0x31, 0x44, 0x10, 0xFE, 0x81, 0xC0, 0x30, 0x09, 0x44, 0x10, 0x7E, 0x88, 0x3C, 0x08, 0xC0, 0x2B, 0x41, 0x00, 0x09, 0x82, 0x08, 0x09, 0x42,
+    0x04, 0xC4, 0x7F, 0x15, 0x43, 0x24, 0x27, 0xE4, 0x3C, 0x88, 0x00, 0xC0, 0x32, 0x41, 0x14, 0xF2, 0xC1, 0x2B, 0x43, 0x88, 0x89, 0xF9, 0x80, 0xC0, 0x1A, 0x43, 0x7E, 0x88, 0x3C, 0x08, 0xC0, 0x11,
+    0x43, 0xC0, 0xB0, 0x8C, 0xC0, 0x24, 0x43, 0xA0, 0xF8, 0x23, 0x00, 0x22, 0x43, 0x38, 0x1D, 0x80, 0x78, 0x2E, 0x40, 0x01, 0x06, 0x43, 0x3E, 0x01, 0xC0, 0x3C, 0x85, 0x00, 0x3A, 0x42, 0xE4, 0x12,
+    0x11, 0x37, 0x43, 0x14, 0x12, 0x11, 0x10, 0xC0, 0x3B, 0x40, 0x42, 0x01, 0x40, 0x02, 0x85, 0x00, 0x30, 0x89, 0x00, 0x27, 0x42, 0xD0, 0xAC, 0x23, 0x09, 0x44, 0x00, 0x31, 0x28, 0xE7, 0x00, 0x3B,
+    0x44, 0x80, 0x80, 0xE0, 0x80, 0x80, 0x2B, 0x43, 0x27, 0x28, 0xE8, 0x07, 0x09, 0x44, 0x04, 0x44, 0x44, 0xC7, 0x24, 0xC0, 0x00, 0x84, 0x00, 0xC0, 0x3A, 0x82, 0x80, 0x40, 0x00, 0xC0, 0x2A, 0x40,
+    0x00, 0x28, 0x42, 0x00, 0x00, 0x80, 0x84, 0x00, 0x44, 0x04, 0x05, 0x7F, 0x45, 0x45, 0xC0, 0x01, 0x84, 0x00, 0x44, 0x20, 0x10, 0xFC, 0x03, 0x00, 0xC3, 0x34, 0x44, 0xE8, 0x09, 0xFF, 0xE8, 0x08,
+    0x35, 0x43, 0xE0, 0x20, 0x39, 0xE1, 0x06, 0x44, 0x24, 0x27, 0xE4, 0x24, 0x20, 0x33, 0x45, 0x60, 0x1E, 0x10, 0xF3, 0x11, 0x01, 0x03, 0xA7, 0x00, 0x0A, 0x42, 0x04, 0x02, 0x01, 0x06, 0x42, 0x00,
+    0xFC, 0x03, 0x0F, 0x43, 0x43, 0xF8, 0x20, 0xE3, 0x2B, 0x40, 0x00, 0x35, 0x43, 0x8D, 0x42, 0x20, 0x1C, 0x93, 0x00, 0x18, 0x84, 0x00, 0x09, 0x83, 0x00, 0xC1, 0x3B, 0x44, 0x04, 0xC4, 0x34, 0x0C,
+    0x04, 0x2F, 0x44, 0x80, 0x84, 0x84, 0xFC, 0x80, 0x08, 0x44, 0x04, 0xE4, 0x14, 0x1C, 0x00, 0x38, 0x40, 0x01, 0x33, 0x41, 0x3C, 0x00, 0x0B, 0x40, 0xF0, 0x01, 0x40, 0xF0, 0xC2, 0x0F, 0x42, 0xC2,
+    0x82, 0xC7, 0x85, 0x00, 0x1E, 0x47, 0x86, 0x41, 0xC1, 0x00, 0x80, 0x87, 0x84, 0x84, 0xC0, 0x0F, 0x43, 0x51, 0xCC, 0x43, 0x40, 0x86, 0x00, 0x12, 0x41, 0x8C, 0x63, 0x07, 0x43, 0xCF, 0x82, 0x83,
+    0xCE, 0x04, 0x40, 0x84, 0x09, 0x42, 0x90, 0x08, 0x86, 0xC0, 0x1D, 0x43, 0x06, 0x05, 0x04, 0x0E, 0x0E, 0x41, 0x06, 0x05, 0x05, 0x83, 0x00, 0x42, 0x23, 0x19, 0x07, 0xC0, 0x05, 0x83, 0x00, 0x2D,
+    0x41, 0x80, 0x80, 0x87, 0x00, 0xC0, 0x03, 0x41, 0x00, 0x80, 0x90, 0x00, 0x0F, 0x40, 0x10, 0xC0, 0x0F, 0x85, 0x00, 0x28, 0x42, 0x4A, 0x4A, 0x7E, 0x8B, 0x00, 0xC0, 0x8D, 0x00, 0x12, 0x43, 0x38,
+    0x08, 0x8E, 0x78, 0xC0, 0x06, 0x44, 0x09, 0x3F, 0xC4, 0x1E, 0x04, 0x10, 0x40, 0x60, 0x1E, 0x40, 0x7D, 0xC0, 0x0A, 0x40, 0x01, 0x31, 0x44, 0x84, 0x84, 0xFC, 0x84, 0x84, 0xC3, 0x2B, 0x42, 0x28,
+    0x28, 0xF8, 0xC0, 0x1F, 0x9C, 0x00, 0x82, 0x01, 0x32, 0x44, 0x28, 0x28, 0xF9, 0x24, 0x20, 0x27, 0x42, 0x50, 0x50, 0xF0, 0xC0, 0x04, 0x44, 0x01, 0x78, 0x07, 0x80, 0x79, 0x06, 0x41, 0x06, 0x01,
+    0xC0, 0x31, 0x43, 0x00, 0x98, 0x94, 0x93, 0x2E, 0x43, 0x9C, 0x92, 0x93, 0x84, 0x0A, 0x97, 0x00, 0x1B, 0x45, 0x00, 0xD1, 0x0C, 0x83, 0x40, 0x40, 0x36, 0x43, 0x80, 0x10, 0x8C, 0x03, 0x0A, 0x82,
+    0x40, 0x00, 0x40, 0x00, 0x83, 0x20, 0x2B, 0x44, 0x4F, 0xC3, 0x44, 0x48, 0x08, 0xC0, 0x26, 0x92, 0x00, 0x0A, 0x43, 0x91, 0x91, 0x9F, 0x40, 0xC0, 0x0F, 0x84, 0x00, 0x08, 0x92, 0x00, 0x0A, 0x44,
+    0x02, 0x62, 0x1F, 0x02, 0x02, 0xC0, 0x0E, 0x84, 0x00, 0xC0, 0x26, 0x42, 0xFF, 0x08, 0x10, 0x82, 0x00, 0xC1, 0x26, 0x8D, 0x00, 0x21, 0x82, 0x89, 0x40, 0xFF, 0xC0, 0x0B, 0x40, 0x08, 0xC0, 0x12,
+    0x44, 0xF0, 0x53, 0x70, 0x00, 0x00, 0xC0, 0x25, 0x44, 0x41, 0x51, 0xF1, 0x51, 0x51, 0x0F, 0x42, 0x03, 0xF8, 0x00, 0xC0, 0x00, 0xA2, 0x00, 0x30, 0x84, 0x00, 0xC0, 0x3A, 0x40, 0xCC, 0x34, 0x83,
+    0x00, 0xC0, 0x3B, 0x40, 0xF8, 0xC1, 0x02, 0x43, 0x08, 0xC8, 0x28, 0x38, 0x86, 0x00, 0xC0, 0x17, 0x44, 0xE2, 0x82, 0x43, 0x20, 0x20, 0x18, 0x42, 0x11, 0x12, 0x12, 0x09, 0x46, 0x00, 0x23, 0xA0,
+    0xE0, 0x23, 0x03, 0xE2, 0xC0, 0x0C, 0x45, 0x00, 0xC7, 0x81, 0xC2, 0x04, 0x04, 0x26, 0x43, 0x88, 0x87, 0x80, 0x80, 0xC0, 0x3C, 0x41, 0x80, 0x60, 0x29, 0x89, 0x00, 0x3A, 0x43, 0x45, 0x44, 0xCE,
+    0x20, 0x09, 0x41, 0x03, 0x1F, 0x0E, 0x42, 0xF9, 0x87, 0x80, 0x19, 0x41, 0x80, 0x80, 0x07, 0x40, 0x9F, 0x38, 0x44, 0x01, 0x31, 0x0F, 0x01, 0x01, 0x13, 0x84, 0x00, 0x43, 0x47, 0x20, 0x1C, 0x03,
+    0x01, 0x40, 0x28, 0x1E, 0x43, 0x32, 0x4A, 0x7F, 0x02, 0x98, 0x00, 0x06, 0x83, 0x00, 0x2C, 0x89, 0x00, 0x00, 0x41, 0x64, 0x1E, 0x85, 0x00, 0x3A, 0x92, 0x00, 0xC0, 0x27, 0x44, 0x38, 0x06, 0x0C,
+    0x70, 0x40, 0x3B, 0x43, 0x82, 0x42, 0x32, 0x0E, 0x85, 0x00, 0xC0, 0x3A, 0x40, 0xF8, 0x1B, 0x43, 0x10, 0xFE, 0x49, 0x38, 0x0F, 0x8D, 0x00, 0xC0, 0x13, 0x43, 0x90, 0x51, 0x31, 0x01, 0x06, 0x82,
+    0x01, 0x10, 0x40, 0x24, 0x1F, 0x43, 0x1C, 0x00, 0x80, 0x70, 0x23, 0x42, 0x24, 0xE2, 0x21, 0x06, 0x43, 0xE3, 0xC0, 0xC0, 0xE0, 0x0A, 0x42, 0xF2, 0x12, 0x10, 0x3B, 0x41, 0x02, 0x01, 0xC2, 0x34,
+    0x83, 0x00, 0xC0, 0x31, 0x44, 0x00, 0xF8, 0x70, 0x30, 0xF8, 0x05, 0x40, 0xD2, 0x34, 0x43, 0xE1, 0x91, 0xF1, 0x80, 0x04, 0x44, 0x08, 0x08, 0xF9, 0x08, 0x08, 0x31, 0x40, 0xC9, 0x01, 0x40, 0x01,
+    0x09, 0x43, 0xE0, 0x11, 0x09, 0x70, 0x2D, 0x40, 0x03, 0x01, 0x40, 0x03, 0x04, 0x84, 0x01, 0x1D, 0x43, 0x00, 0x87, 0xE0, 0x19, 0x06, 0x42, 0xFE, 0x09, 0x80, 0x16, 0x40, 0x20, 0xC0, 0x19, 0x42,
+    0x91, 0x90, 0x9F, 0x06, 0x44, 0x03, 0x02, 0x02, 0x03, 0x04, 0xC0, 0x09, 0x43, 0x86, 0xF9, 0x49, 0xCF, 0xC0, 0x3B, 0x43, 0x40, 0x8F, 0x0A, 0x89, 0xC2, 0x09, 0x40, 0x1F, 0xC0, 0x0D, 0x42, 0x82,
+    0xBF, 0xA2, 0xC0, 0x3B, 0x44, 0x00, 0x60, 0x18, 0x0F, 0x71, 0x23, 0x42, 0x42, 0x7E, 0x42, 0x31, 0x85, 0x00, 0xC0, 0x3A, 0x40, 0x04, 0xC0, 0x30, 0x43, 0x1C, 0x0F, 0xC0, 0x3C, 0xC0, 0x3B, 0x41,
+    0x0A, 0x09, 0x24, 0x8C, 0x00, 0xC0, 0x32, 0x42, 0x10, 0xF0, 0x10, 0xC0, 0x0D, 0x88, 0x00, 0x22, 0x44, 0x38, 0x06, 0x0C, 0x70, 0x40, 0x31, 0x84, 0x00, 0xC0, 0x04, 0x40, 0xFC, 0x39, 0x43, 0x0E,
+    0x80, 0x40, 0x38, 0x93, 0x00, 0x18, 0x84, 0x00, 0xC0, 0x09, 0x41, 0x09, 0xF8, 0x2F, 0x41, 0xFC, 0x00, 0x24, 0x9C, 0x00, 0xC0, 0x23, 0x41, 0xD0, 0xD0, 0x3B, 0x42, 0x87, 0x81, 0x82, 0x1A, 0x43,
+    0x82, 0xF2, 0x42, 0xC2, 0x19, 0x43, 0x8C, 0x62, 0xC3, 0x04, 0xC0, 0x43, 0xC8, 0x08, 0x8F, 0x48, 0x19, 0x43, 0x80, 0x6F, 0x0A, 0x09, 0x19, 0x44, 0x83, 0x00, 0x80, 0x07, 0x04, 0x09, 0x97, 0x00,
+    0x1B, 0x44, 0x00, 0xEF, 0x03, 0x04, 0x88, 0x27, 0x42, 0x83, 0x9F, 0x80, 0x1B, 0x82, 0x40, 0x82, 0x00, 0x40, 0x80, 0x86, 0x00, 0x25, 0x44, 0x00, 0x90, 0x88, 0x84, 0x83, 0x19, 0x44, 0x81, 0xB1,
+    0x8F, 0x81, 0x81, 0x08, 0x42, 0x1C, 0x12, 0x11, 0x33, 0x43, 0xCA, 0xFF, 0x82, 0x80, 0x37, 0x42, 0x38, 0x06, 0x01, 0x18, 0x43, 0x40, 0x47, 0x49, 0x73, 0x23, 0x43, 0x62, 0x14, 0x1E, 0x21, 0x05,
+    0x92, 0x00, 0x08, 0x44, 0x40, 0x42, 0x7E, 0x42, 0x40, 0x28, 0x89, 0x00, 0x44, 0x04, 0x84, 0x7F, 0x04, 0x04, 0x3E, 0x92, 0x00, 0x29, 0x40, 0x43, 0xC0, 0x02, 0x40, 0x84, 0xC1, 0x20, 0x43, 0x24,
+    0x64, 0xE4, 0x1C, 0x36, 0x42, 0x10, 0xF1, 0x11, 0xC0, 0x03, 0x40, 0x01, 0x37, 0x42, 0x02, 0x03, 0x02, 0x0F, 0x8D, 0x00, 0x14, 0x42, 0x22, 0xE1, 0x20, 0x2C, 0x40, 0xB4, 0xC0, 0x3C, 0x43, 0x04,
+    0xC4, 0xBF, 0xFD, 0x86, 0x00, 0xC0, 0x34, 0x40, 0x01, 0xC2, 0x0D, 0x45, 0x08, 0x89, 0x89, 0x70, 0x00, 0xF9, 0x08, 0x43, 0x23, 0x24, 0xFF, 0xE0, 0x1E, 0x43, 0x83, 0x60, 0x50, 0x93, 0xC0, 0x09,
+    0x45, 0x22, 0xA2, 0xE3, 0x22, 0x00, 0xE3, 0x08, 0x43, 0x08, 0x56, 0x95, 0xD7, 0x1E, 0x43, 0x03, 0x04, 0x04, 0x03, 0x33, 0x40, 0xF2, 0xC0, 0x3C, 0x41, 0x0C, 0x03, 0xC0, 0x29, 0x40, 0x8F, 0xC0,
+    0x17, 0x89, 0x00, 0x1C, 0x43, 0x9F, 0x87, 0x83, 0x9F, 0xC0, 0x14, 0x88, 0x00, 0x1C, 0x44, 0x00, 0x9B, 0xA4, 0xA4, 0x3F, 0xC4, 0x18, 0x84, 0x00, 0x43, 0x40, 0x31, 0xF8, 0x06, 0x86, 0x00, 0x12,
+    0x43, 0x82, 0xA2, 0xE2, 0x9C, 0xC0, 0x01, 0x84, 0x00, 0x18, 0x41, 0xFF, 0x48, 0xC0, 0x1F, 0x43, 0xB8, 0x48, 0x48, 0xF8, 0x05, 0x42, 0x3A, 0x49, 0x98, 0x85, 0x00, 0xC0, 0x43, 0x80, 0x7C, 0x04,
+    0xC0, 0x31, 0x43, 0x02, 0xC2, 0x32, 0x03, 0x84, 0x00, 0xC0, 0x00, 0x44, 0x21, 0xE1, 0x21, 0x01, 0x02, 0x2B, 0x43, 0x20, 0x90, 0xFC, 0x03, 0x85, 0x00, 0x39, 0x40, 0xFF, 0x82, 0x84, 0xC0, 0x2C,
+    0x40, 0xFF, 0x82, 0x84, 0xC0, 0x0A, 0x85, 0x00, 0xC0, 0x82, 0x00, 0x38, 0x40, 0x1C, 0x34, 0x82, 0x00, 0x0C, 0x40, 0x10, 0x3C, 0x42, 0xE1, 0x41, 0xE1, 0x2D, 0x42, 0x90, 0xE0, 0xC0, 0x0E, 0x44,
+    0x48, 0x4A, 0x4A, 0xFB, 0x02, 0x37, 0x42, 0x08, 0x06, 0x01, 0xC0, 0x43, 0x04, 0x84, 0x84, 0x87, 0x01, 0x40, 0xC8, 0xC0, 0x3D, 0x41, 0x00, 0x8F, 0xC0, 0x16, 0x43, 0x00, 0x07, 0xC8, 0x88, 0x1A,
+    0x42, 0x2F, 0x23, 0x21, 0xC0, 0x1D, 0x45, 0x00, 0x87, 0x80, 0x81, 0x4E, 0x08, 0x18, 0x43, 0x81, 0xA1, 0x99, 0x07, 0xC0, 0x32, 0x41, 0xB8, 0x86, 0x09, 0x46, 0x11, 0x01, 0x3F, 0x01, 0x01, 0x00,
+    0x1D, 0xC0, 0x2B, 0x44, 0x30, 0x2F, 0x20, 0x38, 0x40, 0x04, 0x43, 0x38, 0x46, 0x45, 0x39, 0x0F, 0x43, 0x09, 0x09, 0xC9, 0x38, 0xC0, 0x36, 0x85, 0x00, 0x40, 0x01, 0xC0, 0x06, 0x93, 0x00, 0x43,
+    0x09, 0xFF, 0xA4, 0x9C, 0xC0, 0x28, 0x40, 0x08, 0xC0, 0x02, 0x42, 0xFC, 0x20, 0x43, 0x82, 0x00, 0xC0, 0x39, 0x41, 0x03, 0xE0, 0x17, 0x42, 0x83, 0xE2, 0x18, 0xC2, 0x0D, 0x89, 0x00, 0x08, 0x44,
+    0x00, 0x09, 0x09, 0xC9, 0x38, 0xC0, 0x3C, 0x40, 0x8D, 0xC1, 0x24, 0x44, 0x03, 0x04, 0xFF, 0x08, 0x80, 0xC0, 0x3A, 0x45, 0x00, 0x53, 0x92, 0xD2, 0x33, 0x04, 0x9C, 0x00, 0x43, 0xC3, 0xBC, 0xE4,
+    0x23, 0xC0, 0x09, 0x43, 0x24, 0x24, 0x27, 0xE0, 0x10, 0x41, 0xF0, 0x00, 0x1A, 0x42, 0x11, 0x0D, 0x07, 0x32, 0x42, 0xCC, 0x83, 0xC0, 0x14, 0x43, 0x28, 0x24, 0x23, 0xE0, 0xC0, 0x23, 0x42, 0x11,
+    0x0C, 0x03, 0x13, 0x43, 0x4F, 0x41, 0x43, 0xCF, 0x1B, 0x97, 0x00, 0xC0, 0x08, 0x41, 0x0E, 0x11, 0x1C, 0x96, 0x00, 0xC1, 0x00, 0x44, 0x04, 0x84, 0x7C, 0x04, 0x04, 0xC0, 0x17, 0x43, 0x60, 0x58,
+    0x46, 0xE0, 0x85, 0x00, 0x22, 0x92, 0x00, 0x09, 0x41, 0x1F, 0xFF, 0x35, 0x40, 0x42, 0xC0, 0x06, 0x40, 0x01, 0xC0, 0x44, 0x11, 0xFE, 0x48, 0x38, 0x00, 0x0D, 0x84, 0x00, 0xC0, 0x28, 0x42, 0x41,
+    0x01, 0x01, 0x10, 0x40, 0x7C, 0xC0, 0x05, 0x43, 0x10, 0x10, 0xFE, 0xF1, 0xC0, 0x01, 0x44, 0x53, 0x50, 0xF0, 0x4B, 0x40, 0x34, 0x43, 0x04, 0x03, 0x02, 0x03, 0xC2, 0x21, 0x43, 0x70, 0x8C, 0x8A,
+    0x72, 0x0A, 0x43, 0x09, 0x89, 0x79, 0x0F, 0xC0, 0x00, 0x42, 0x80, 0x60, 0x1E, 0x94, 0x00, 0x14, 0x40, 0x8C, 0x0C, 0x40, 0x01, 0x3E, 0x83, 0x00, 0xC0, 0x3B, 0x42, 0xE0, 0x10, 0x10, 0x32, 0x84,
+    0x00, 0xC0, 0x3B, 0x41, 0x38, 0x20, 0x12, 0x40, 0xC0, 0xC0, 0x3C, 0x44, 0x2A, 0x2E, 0xE9, 0x00, 0x9F, 0xC0, 0x3D, 0x41, 0x00, 0x06, 0xC2, 0x3A, 0x41, 0xBF, 0x81, 0x29, 0x89, 0x00, 0xC0, 0x08,
+    0x44, 0x30, 0x2F, 0x20, 0x38, 0x40, 0xC0, 0x2C, 0x43, 0x04, 0x9F, 0x7F, 0x04, 0x18, 0x44, 0x01, 0x81, 0x7D, 0x0D, 0x03, 0xC0, 0x1D, 0x40, 0x01, 0x16, 0x85, 0x00, 0x40, 0x01, 0xC0, 0x02, 0x43,
+    0x82, 0x62, 0x3E, 0xC4, 0x00, 0x92, 0x00, 0x1F, 0x41, 0xF8, 0x08, 0x0B, 0x83, 0x00, 0x35, 0x40, 0x01, 0x01, 0x40, 0x01, 0x02, 0x41, 0xF0, 0x10, 0x8F, 0x00, 0x2C, 0x48, 0x20, 0xA0, 0x60, 0x00,
+    0x23, 0x20, 0xE0, 0x20, 0x20, 0xC0, 0x09, 0x82, 0x91, 0x40, 0x71, 0x13, 0x43, 0xCC, 0x38, 0x78, 0x84, 0x3E, 0x8A, 0x00, 0xC5, 0x13, 0x83, 0x00, 0xC0, 0x3B, 0x43, 0x20, 0xC0, 0xF8, 0x00, 0x01,
+    0x41, 0x4B, 0xC2, 0x37, 0x43, 0x48, 0x46, 0xC1, 0x40, 0x3E, 0x44, 0x00, 0x20, 0x28, 0x26, 0xC1, 0x2D, 0x42, 0xF1, 0x2D, 0xE7, 0x06, 0x42, 0x10, 0x0F, 0x01, 0xC0, 0x32, 0x42, 0x0F, 0x04, 0x0F,
+    0x28, 0x43, 0x47, 0xC8, 0x48, 0x47, 0x04, 0x43, 0x40, 0x51, 0x7C, 0xC3, 0xC0, 0x31, 0x44, 0x01, 0x81, 0x9F, 0x91, 0x51, 0x84, 0x00, 0x44, 0x08, 0x04, 0x3F, 0x02, 0x0C, 0xC1, 0x17, 0x40, 0x80,
+    0xC0, 0x3E, 0x41, 0x7F, 0x04, 0x09, 0x43, 0xF8, 0x24, 0x3C, 0xE0, 0xC0, 0x17, 0x44, 0x00, 0xCC, 0x38, 0x78, 0x84, 0xC0, 0x3B, 0x40, 0x08, 0xC1, 0x25, 0x44, 0x20, 0x28, 0xF9, 0x29, 0x29, 0x18,
+    0x84, 0x00, 0xC0, 0x1D, 0x43, 0x20, 0xE3, 0x22, 0x02, 0x18, 0x40, 0x40, 0x01, 0x40, 0xE0, 0x09, 0x89, 0x00, 0xC0, 0x0D, 0x44, 0x09, 0x09, 0xF9, 0x09, 0x08, 0xC0, 0x3B, 0x40, 0x8D, 0xC0, 0x29,
+    0x89, 0x00, 0x18, 0x43, 0x05, 0x84, 0x64, 0x1C, 0xC0, 0x18, 0x40, 0x38, 0x01, 0x85, 0x00, 0x19, 0x40, 0x01, 0x17, 0x43, 0xE4, 0x17, 0x10, 0xE0, 0x22, 0x83, 0x00, 0x00, 0x43, 0x81, 0x61, 0x51,
+    0x91, 0xC0, 0x0F, 0x43, 0x50, 0x93, 0xD5, 0x34, 0x9D, 0x00, 0x05, 0x47, 0x20, 0x20, 0xE0, 0x00, 0x43, 0x44, 0xC4, 0x43, 0x2C, 0x84, 0x00, 0x22, 0x9C, 0x00, 0x3A, 0x42, 0x20, 0x20, 0xE0, 0x0F,
+    0x43, 0x48, 0xFA, 0xCE, 0x09, 0x10, 0x42, 0x40, 0x80, 0x00, 0xC0, 0x26, 0x42, 0x5F, 0x4C, 0x4B, 0xC0, 0x2E, 0x40, 0x81, 0x02, 0x41, 0x01, 0x01, 0x04, 0x42, 0x01, 0x21, 0x19, 0x37, 0x42, 0x4A,
+    0x7F, 0x02, 0x99, 0x00, 0x1C, 0x43, 0x11, 0x10, 0x90, 0xBF, 0x86, 0x00, 0x43, 0x25, 0x25, 0x3F, 0x01, 0x1D, 0x97, 0x00, 0x82, 0x21, 0x40, 0x7F, 0x99, 0x00, 0x2B, 0x40, 0xB0, 0xC0, 0x3E, 0x43,
+    0x07, 0xC4, 0x3C, 0x04, 0x31, 0x43, 0x00, 0x69, 0x49, 0x92, 0x06, 0x92, 0x00, 0x09, 0x44, 0x09, 0x09, 0xF9, 0x09, 0x08, 0x0E, 0x44, 0x09, 0x3F, 0xC4, 0x1E, 0x04, 0x08, 0x40, 0x01, 0x0E, 0x43,
+    0xE1, 0x18, 0x14, 0xE4, 0x23, 0x40, 0xFE, 0x25, 0x40, 0x01, 0x13, 0x40, 0x01, 0x14, 0x86, 0x00, 0x47, 0x01, 0x01, 0x00, 0xFC, 0x10, 0x11, 0x11, 0x01, 0x3E, 0x93, 0x00, 0x43, 0xE0, 0x20, 0x38,
+    0xE0, 0x8A, 0x00, 0x0E, 0x44, 0x40, 0x50, 0xF0, 0x50, 0x50, 0x04, 0x44, 0x03, 0x22, 0xE2, 0x22, 0x00, 0xC0, 0x41, 0x20, 0xE0, 0x11, 0x43, 0x94, 0x92, 0x91, 0x70, 0x89, 0x00, 0x00, 0x40, 0x3B,
+    0x01, 0x40, 0xE0, 0x20, 0x44, 0x80, 0x84, 0xFC, 0x84, 0x80, 0x05, 0x42, 0xE4, 0x94, 0x8C, 0x86, 0x00, 0xC0, 0x37, 0x40, 0xFC, 0xCA, 0x1B, 0x42, 0x40, 0x40, 0x87, 0x1D, 0x43, 0x4F, 0x84, 0x0F,
+    0x80, 0xC0, 0x19, 0x43, 0x03, 0xEC, 0x94, 0x93, 0x1D, 0x43, 0x02, 0x1F, 0x27, 0x01, 0x31, 0x42, 0x84, 0xBF, 0x82, 0xC0, 0x3B, 0x82, 0x10, 0x41, 0x1F, 0x10, 0xC1, 0x11, 0x40, 0xC5, 0x2C, 0x8A,
+    0x00, 0xC0, 0x04, 0x43, 0xC4, 0x34, 0xFF, 0x1C, 0xC2, 0x2B, 0x41, 0x00, 0xF8, 0x82, 0x28, 0x22, 0x44, 0x00, 0x20, 0xFD, 0x91, 0x71, 0x1D, 0x44, 0xD0, 0x11, 0xFF, 0xD1, 0x10, 0x17, 0x43, 0x11,
+    0x7C, 0xFC, 0x11, 0x14, 0x43, 0x21, 0x39, 0xE1, 0x01, 0x22, 0x44, 0x00, 0x20, 0xE3, 0x22, 0x02, 0x00, 0x83, 0x00, 0x44, 0x03, 0x70, 0x90, 0x90, 0xF0, 0x0E, 0x84, 0x00, 0x44, 0x01, 0x80, 0xE7,
+    0x1B, 0x02, 0x17, 0x42, 0x04, 0x02, 0x01, 0x35, 0x43, 0x09, 0x89, 0x79, 0x0F, 0x31, 0x83, 0x00, 0x43, 0x04, 0xC4, 0xBF, 0xFC, 0x15, 0x89, 0x00, 0x43, 0x09, 0x89, 0x79, 0x0F, 0x12, 0x44, 0x00,
+    0xC1, 0x31, 0x1F, 0xE2, 0x27, 0x89, 0x00, 0x0D, 0x40, 0x01, 0x22, 0x40, 0x01, 0x15, 0x40, 0x00, 0x08, 0x44, 0x3C, 0x04, 0x07, 0x84, 0x7C, 0xC0, 0x3B, 0x42, 0x08, 0xFA, 0x09, 0x37, 0x42, 0xC1,
+    0xE0, 0x18, 0x36, 0x44, 0x60, 0x33, 0xF0, 0x00, 0x03, 0x05, 0x43, 0xF9, 0x01, 0x01, 0xC1, 0x35, 0x42, 0x01, 0x00, 0x07, 0x02, 0x83, 0x00, 0x04, 0x40, 0x43, 0x2B, 0x43, 0xC0, 0xBF, 0xE0, 0x20,
+    0x00, 0x84, 0x00, 0x43, 0x47, 0x42, 0xC3, 0x40, 0x3B, 0x42, 0x80, 0x40, 0xC0, 0x05, 0x40, 0xC0, 0x30, 0x48, 0x80, 0xF0, 0x40, 0xC0, 0x00, 0xD0, 0x8F, 0x81, 0x40, 0x2C, 0x84, 0x00, 0x0E, 0x40,
+    0x4A, 0x01, 0x41, 0x80, 0x7F, 0x35, 0x43, 0x0C, 0x03, 0x07, 0x08, 0x2B, 0x44, 0x00, 0x40, 0x40, 0xC0, 0x20, 0x0D, 0x42, 0x4F, 0x49, 0x49, 0x01, 0x41, 0x01, 0x10, 0xC0, 0x17, 0x43, 0x01, 0x1F,
+    0xF1, 0x11, 0xC0, 0x3B, 0x44, 0x31, 0x4D, 0x7F, 0x01, 0x01, 0xC3, 0x20, 0x41, 0x08, 0x0A, 0xC0, 0x39, 0x43, 0x83, 0x42, 0x32, 0x0E, 0xC0, 0x2D, 0x43, 0x10, 0x10, 0x11, 0x10, 0x05, 0x43, 0x1E,
+    0x00, 0xE0, 0x1E, 0x0E, 0x43, 0x24, 0x24, 0x25, 0xFD, 0xC0, 0x28, 0x42, 0x12, 0xFF, 0xF0, 0x0A, 0x84, 0x00, 0x82, 0x02, 0x40, 0x03, 0xC0, 0x04, 0x94, 0x00, 0xC1, 0x21, 0x42, 0x69, 0x49, 0x92,
+    0xC2, 0x0B, 0x43, 0xF9, 0x70, 0x30, 0xF8, 0xC0, 0x18, 0x88, 0x00, 0x1C, 0x40, 0x01, 0xC0, 0x17, 0x43, 0x00, 0xE0, 0x80, 0x40, 0x28, 0x45, 0x72, 0x3A, 0x03, 0xF2, 0x48, 0x4B, 0xC0, 0x39, 0x45,
+    0x28, 0x24, 0x23, 0xC0, 0x04, 0xC4, 0xC1, 0x0E, 0x9C, 0x00, 0x2B, 0x43, 0x07, 0xE8, 0x08, 0x07, 0x32, 0x82, 0x80, 0x99, 0x00, 0x40, 0xC2, 0x29, 0x44, 0x00, 0x30, 0x1F, 0xE8, 0x06, 0xC0, 0x0F,
+    0x43, 0x21, 0x10, 0x08, 0x07, 0xC0, 0x18, 0x43, 0x64, 0x94, 0xFF, 0x04, 0xC0, 0x14, 0x43, 0x09, 0x7E, 0x9C, 0x06, 0x06, 0x40, 0xAF, 0x29, 0x86, 0x00, 0x40, 0x80, 0x90, 0x00, 0x3A, 0x43, 0x1C,
+    0x83, 0x72, 0x0E, 0xC0, 0x3B, 0x43, 0xFF, 0x40, 0x60, 0x18, 0x84, 0x00, 0xC0, 0x04, 0x93, 0x00, 0x09, 0x43, 0xF0, 0x49, 0x78, 0xC0, 0x11, 0x40, 0x10, 0x1F, 0x44, 0x24, 0x25, 0xE5, 0x25, 0x20,
+    0x27, 0x42, 0x90, 0xF0, 0x80, 0x18, 0x40, 0x01, 0x01, 0x40, 0x01, 0x18, 0x44, 0x00, 0x4A, 0xF1, 0xE0, 0x30, 0x15, 0x41, 0xE4, 0x23, 0x85, 0x00, 0x05, 0x42, 0x82, 0xC2, 0x33, 0x0E, 0x44, 0xC0,
+    0x41, 0x70, 0xC7, 0x03, 0xC0, 0x43, 0x00, 0x38, 0x03, 0x04, 0xC0, 0x39, 0x99, 0x00, 0xC0, 0x16, 0x84, 0x00, 0x19, 0x89, 0x00, 0xC0, 0x37, 0x40, 0x20, 0xC2, 0x23, 0x41, 0xC0, 0x37, 0xC0, 0x3C,
+    0x43, 0x03, 0x02, 0x02, 0x07, 0x0A, 0x40, 0x24, 0x2C, 0x42, 0x0D, 0x07, 0xF0, 0x00, 0x84, 0x00, 0xC0, 0x08, 0x40, 0x79, 0x2B, 0x42, 0x50, 0x88, 0x07, 0x02, 0x42, 0x80, 0x00, 0x80, 0x31, 0x83,
+    0x00, 0x0D, 0x40, 0x0F, 0x01, 0x41, 0x4F, 0xC0, 0xC0, 0x0F, 0x40, 0x1F, 0x01, 0x40, 0x1F, 0x14, 0x44, 0x00, 0x00, 0xE0, 0x00, 0x80, 0x0D, 0x43, 0x02, 0x06, 0x1E, 0x01, 0xC0, 0x0F, 0x43, 0x9F,
+    0xAC, 0xA2, 0x1F, 0xC3, 0x05, 0x43, 0x8D, 0x42, 0x20, 0x1C, 0xC0, 0x0A, 0x89, 0x00, 0x44, 0x25, 0x1F, 0xF2, 0x12, 0x10, 0xC0, 0x3C, 0x40, 0x49, 0xC0, 0x00, 0x48, 0x3C, 0x04, 0x07, 0x84, 0x7C,
+    0x04, 0x07, 0x84, 0x7C, 0xC0, 0x2D, 0x42, 0x10, 0xE0, 0xFC, 0x06, 0x46, 0x08, 0x8A, 0x69, 0x18, 0x08, 0x02, 0x01, 0x0B, 0x42, 0x62, 0x32, 0xF2, 0xC0, 0x00, 0x43, 0x10, 0x14, 0xDE, 0xB1, 0x1A,
+    0x40, 0x03, 0x0A, 0x40, 0x00, 0xC0, 0x43, 0x08, 0xFF, 0xA4, 0x9C, 0xC2, 0x0E, 0x43, 0xC0, 0xB1, 0x8C, 0xC0, 0x09, 0x44, 0x3C, 0x04, 0x07, 0x84, 0x7C, 0x31, 0x88, 0x00, 0x34, 0x40, 0x01, 0x0B,
+    0x41, 0x02, 0x01, 0x34, 0x40, 0x58, 0xC3, 0x1A, 0x83, 0x00, 0x04, 0x40, 0x84, 0xC0, 0x35, 0x43, 0xC0, 0x80, 0x80, 0xC0, 0x03, 0x41, 0x86, 0x7D, 0x36, 0x40, 0xC3, 0x20, 0x40, 0xC8, 0xC0, 0x1A,
+    0x43, 0x0C, 0x0B, 0x08, 0x1C, 0x1D, 0x43, 0x0C, 0x0B, 0x08, 0xFC, 0x85, 0x00, 0xC0, 0x09, 0x40, 0x80, 0x2B, 0x40, 0xB1, 0xC0, 0x11, 0x42, 0x7F, 0x04, 0x08, 0x28, 0x44, 0x00, 0x7F, 0x20, 0x30,
+    0x0C, 0x06, 0x40, 0xFE, 0xC0, 0x29, 0x44, 0x60, 0x5F, 0x41, 0x70, 0x80, 0x0D, 0x43, 0x04, 0xC4, 0xBF, 0xFC, 0xC0, 0x3B, 0x40, 0x01, 0x1C, 0x40, 0x80, 0xC0, 0x3E, 0x40, 0x01, 0xC2, 0x30, 0x43,
+    0x1C, 0x62, 0xA2, 0x9C, 0x03, 0x84, 0x00, 0xC0, 0x2D, 0x84, 0x00, 0x40, 0xF8, 0x16, 0x8C, 0x00, 0xC0, 0x15, 0x40, 0xC8, 0x01, 0x40, 0x00, 0x18, 0x42, 0x00, 0xE0, 0x10, 0xC0, 0x01, 0x88, 0x00,
+    0xC0, 0x36, 0x82, 0x80, 0x86, 0x00, 0x18, 0x43, 0xC2, 0x22, 0xA7, 0xC0, 0xC0, 0x36, 0x48, 0x40, 0x4F, 0xFA, 0x49, 0x40, 0x07, 0x0B, 0x08, 0x07, 0x3B, 0x84, 0x00, 0x34, 0x43, 0x00, 0x40, 0x58,
+    0xC7, 0x1F, 0x9C, 0x00, 0x04, 0x43, 0x00, 0x80, 0x00, 0x00, 0x33, 0x40, 0x00, 0x24, 0x9B, 0x00, 0x3B, 0x83, 0x00, 0x40, 0x10, 0xC1, 0x0D, 0x40, 0x30, 0x23, 0x91, 0x00, 0xC0, 0x07, 0x44, 0x04,
+    0x1F, 0xFF, 0x00, 0x00, 0x1A, 0x97, 0x00, 0xC0, 0x27, 0x40, 0x10, 0x04, 0x40, 0x0E, 0xC1, 0x1A, 0x92, 0x00, 0x09, 0x43, 0x1D, 0x00, 0x80, 0x71, 0x1D, 0x42, 0x58, 0x52, 0xF1, 0x3D, 0x40, 0x50,
+    0x01, 0x40, 0x48, 0x18, 0x41, 0x02, 0x01, 0x11, 0x43, 0x93, 0xE0, 0xC0, 0x60, 0x09, 0x42, 0x02, 0x02, 0x03, 0x39, 0x43, 0x80, 0x8E, 0x92, 0xE6, 0xC1, 0x00, 0x44, 0x40, 0x42, 0x42, 0x7E, 0x40,
+    0x39, 0x94, 0x00, 0xC1, 0x0F, 0x41, 0xC2, 0x3D, 0xC0, 0x3C, 0x40, 0x03, 0xC2, 0x1A, 0x41, 0x44, 0x44, 0x2B, 0x42, 0x91, 0x8D, 0x87, 0x86, 0x00, 0xC0, 0x07, 0x41, 0x90, 0x7C, 0x2B, 0x43, 0x48,
+    0x88, 0x0F, 0x88, 0x3B, 0x43, 0x80, 0x18, 0x07, 0x80, 0xC0, 0x3A, 0x44, 0x00, 0x9F, 0x87, 0x83, 0x1F, 0x85, 0x00, 0xC0, 0x34, 0x43, 0x20, 0x23, 0xA4, 0xB9, 0xC1, 0x07, 0x41, 0xC6, 0x45, 0x31,
+    0x44, 0x80, 0x84, 0xFC, 0x84, 0x80, 0xC0, 0x04, 0x44, 0x42, 0x22, 0xFB, 0x16, 0x60, 0xC0, 0x27, 0x43, 0x20, 0x10, 0xFC, 0x03, 0x0E, 0x44, 0x00, 0x7C, 0xB3, 0x8A, 0x7C, 0x2B, 0x8A, 0x00, 0x32,
+    0x40, 0x01, 0x06, 0x43, 0x38, 0x07, 0xE4, 0x1C, 0x37, 0x41, 0x50, 0x30, 0x86, 0x00, 0x39, 0x42, 0x24, 0x26, 0x25, 0xC0, 0x3C, 0x43, 0x02, 0x92, 0xE2, 0xC3, 0x20, 0x44, 0x00, 0x0F, 0x80, 0x70,
+    0x0F, 0x19, 0x43, 0x88, 0x88, 0xF8, 0x80, 0x2B, 0x44, 0x00, 0x1C, 0x83, 0x72, 0x0E, 0xC0, 0x3A, 0x41, 0x00, 0x1D, 0xC1, 0x06, 0x85, 0x00, 0x14, 0x43, 0xF0, 0xE0, 0x61, 0xF0, 0x3E, 0x8A, 0x00,
+    0x08, 0x85, 0x00, 0x09, 0x41, 0x88, 0x88, 0x0C, 0x89, 0x00, 0x40, 0x03, 0x01, 0x40, 0x03, 0x3E, 0x44, 0x00, 0x00, 0x80, 0xE0, 0x18, 0x0F, 0x83, 0x10, 0x1A, 0x42, 0x90, 0xD0, 0x30, 0xC2, 0x22,
+    0x44, 0xC7, 0x0B, 0x88, 0x47, 0x40, 0x83, 0x00, 0xC0, 0x36, 0x44, 0x0F, 0x03, 0x04, 0x08, 0x08, 0x82, 0x20, 0x40, 0x00, 0x31, 0x43, 0x82, 0xDF, 0x27, 0x81, 0x01, 0x82, 0x00, 0x02, 0x40, 0x9C,
+    0xC0, 0x32, 0x43, 0x43, 0x21, 0x18, 0x07, 0x85, 0x00, 0x44, 0x3E, 0x01, 0x00, 0x07, 0x18, 0x2A, 0x84, 0x00, 0xC0, 0x3A, 0x85, 0x00, 0xC3, 0x08, 0x44, 0x1E, 0x02, 0x03, 0xC2, 0x3E, 0xC0, 0x13,
+    0x42, 0x08, 0xF8, 0x08, 0x86, 0x00, 0x44, 0x08, 0x09, 0xFE, 0x08, 0x08, 0x21, 0x40, 0x83, 0xC0, 0x0E, 0x42, 0x7D, 0xFD, 0x10, 0x05, 0x43, 0x1C, 0x03, 0x80, 0x70, 0x22, 0x40, 0x01, 0xC0, 0x0C,
+    0x44, 0xC0, 0x3C, 0x22, 0xE1, 0x20, 0x27, 0x43, 0xE2, 0x1E, 0x93, 0x70, 0xC0, 0x21, 0x8E, 0x00, 0xC0, 0x31, 0x40, 0x8C, 0xC0, 0x1B, 0x43, 0x0E, 0x80, 0x40, 0x38, 0xC0, 0x3B, 0x40, 0x01, 0xC0,
+    0x20, 0x44, 0x43, 0xF8, 0x20, 0xF0, 0x20, 0xC0, 0x3B, 0x41, 0x01, 0x0E, 0x28, 0x89, 0x00, 0xC0, 0x35, 0x43, 0xC0, 0x00, 0x80, 0x40, 0xC5, 0x18, 0x44, 0x00, 0x20, 0xA8, 0xB8, 0x27, 0x1E, 0x9B,
+    0x00, 0xC1, 0x21, 0x82, 0x42, 0x40, 0xFE, 0x86, 0x00, 0x25, 0x41, 0x00, 0x09, 0x2A, 0x82, 0x42, 0x40, 0xFE, 0x3B, 0x43, 0x42, 0x43, 0x42, 0xFE, 0x85, 0x00, 0x23, 0x97, 0x00, 0x2F, 0x43, 0x70,
+    0x10, 0x1C, 0xF1, 0x0F, 0x44, 0x00, 0x1A, 0x85, 0x40, 0x3C, 0x1F, 0x40, 0x40, 0x82, 0x00, 0x41, 0x38, 0x48, 0xC0, 0x01, 0x41, 0x02, 0x01, 0x11, 0x44, 0x81, 0x7C, 0x04, 0xC0, 0x50, 0xC0, 0x91,
+    0x00, 0x0A, 0x42, 0xE2, 0xA1, 0xE0, 0x1A, 0x43, 0x39, 0x01, 0x01, 0xE1, 0x12, 0x44, 0x42, 0x42, 0x7E, 0x42, 0x42, 0xC1, 0x22, 0x44, 0x1C, 0x83, 0x72, 0x0E, 0x00, 0x01, 0x41, 0x42, 0x42, 0xC0,
+    0x36, 0x40, 0x01, 0xC0, 0x02, 0x94, 0x00, 0xC0, 0x25, 0x84, 0x00, 0x40, 0xF8, 0xC0, 0x2B, 0x83, 0x00, 0x09, 0x43, 0x70, 0x38, 0x00, 0xF0, 0x0B, 0x98, 0x00, 0x07, 0x44, 0x10, 0x10, 0xD7, 0xD0,
+    0x30, 0x3B, 0x47, 0x80, 0xF0, 0x40, 0xC0, 0x03, 0x42, 0x82, 0xF7, 0x85, 0x00, 0x0F, 0x42, 0x80, 0x60, 0xC0, 0x9E, 0x00, 0x42, 0x98, 0x87, 0x80, 0xC0, 0x01, 0x43, 0xCC, 0x03, 0x83, 0x40, 0xC0,
+    0x2B, 0x43, 0x00, 0x91, 0x8C, 0x83, 0x0C, 0x42, 0xE3, 0x84, 0x88, 0x04, 0x43, 0x89, 0xF9, 0x4F, 0x40, 0x2D, 0x43, 0x02, 0x1F, 0x27, 0x01, 0x30, 0x44, 0x10, 0x90, 0x9F, 0x90, 0x10, 0x0A, 0x43,
+    0x01, 0x1F, 0x14, 0x13, 0x04, 0x44, 0x04, 0x03, 0x3E, 0x02, 0x02, 0x2C, 0x43, 0x33, 0x0E, 0x1E, 0x21, 0xC0, 0x0D, 0x40, 0x00, 0x30, 0x9D, 0x00, 0x13, 0x43, 0x21, 0xA1, 0x21, 0x21, 0x17, 0x41,
+    0x40, 0x09, 0xC0, 0x26, 0x84, 0x00, 0xC3, 0x3A, 0x89, 0x00, 0xC0, 0x17, 0x44, 0x02, 0x7A, 0x02, 0x83, 0x78, 0x18, 0x42, 0x10, 0xF0, 0x10, 0x26, 0x43, 0x88, 0x88, 0xF8, 0x80, 0x00, 0x89, 0x00,
+    0x26, 0x43, 0x7C, 0xB2, 0x8A, 0x7C, 0xC0, 0x1D, 0x44, 0x04, 0x04, 0xFC, 0x04, 0x04, 0x1D, 0x8E, 0x00, 0xC2, 0x0E, 0x42, 0x11, 0xF0, 0x10, 0xC0, 0x0F, 0x43, 0x48, 0x4B, 0x48, 0xF8, 0x28, 0x42,
+    0x02, 0x03, 0x02, 0x15, 0x89, 0x00, 0x2F, 0x82, 0x04, 0x40, 0x07, 0x0C, 0x41, 0xCE, 0x30, 0x31, 0x82, 0x90, 0xC0, 0x06, 0x42, 0x02, 0x01, 0x1F, 0xC0, 0x0B, 0x42, 0x0C, 0x83, 0x63, 0x85, 0x00,
+    0x3C, 0x40, 0x03, 0x37, 0x44, 0x04, 0x03, 0xFF, 0x80, 0x80, 0x84, 0x00, 0x30, 0x44, 0x80, 0x82, 0x9F, 0xA7, 0x81, 0x04, 0x44, 0x00, 0x01, 0x01, 0x81, 0x01, 0x3B, 0x83, 0x00, 0x30, 0x44, 0x90,
+    0x10, 0x1F, 0x10, 0x10, 0x27, 0x40, 0x31, 0xC0, 0x1B, 0x42, 0x06, 0x03, 0x7F, 0x1F, 0x43, 0x82, 0x7A, 0x0E, 0x02, 0xC0, 0x3B, 0x43, 0x09, 0x09, 0xC9, 0x38, 0x2C, 0x44, 0x80, 0x84, 0xFC, 0x84,
+    0x80, 0xC0, 0x3B, 0x40, 0xE0, 0x20, 0x43, 0xF8, 0x70, 0x30, 0xF8, 0xC0, 0x18, 0x44, 0x00, 0xF0, 0x09, 0x09, 0xF0, 0x1D, 0x40, 0x01, 0x01, 0x40, 0x01, 0x31, 0x43, 0x0A, 0x09, 0xC8, 0x38, 0x18,
+    0x40, 0x11, 0x08, 0x44, 0x00, 0x79, 0x02, 0x82, 0x79, 0xC0, 0x13, 0x41, 0x02, 0x01, 0x1A, 0x40, 0x03, 0xC4, 0x30, 0x43, 0xC0, 0xBE, 0x82, 0xE0, 0x1E, 0x43, 0x24, 0x24, 0x25, 0xE0, 0xC0, 0x18,
+    0x40, 0xC0, 0x01, 0x41, 0x00, 0x01, 0x1D, 0x42, 0x48, 0x4C, 0xFB, 0x8A, 0x00, 0xC0, 0x17, 0x83, 0x00, 0xC0, 0x2D, 0x83, 0x00, 0x09, 0x82, 0x20, 0x0C, 0x97, 0x00, 0x14, 0x40, 0x0F, 0x01, 0x40,
+    0x40, 0x12, 0x8A, 0x00, 0x08, 0x43, 0x5C, 0x93, 0xD0, 0x30, 0x06, 0x42, 0x40, 0xF0, 0x40, 0x19, 0x40, 0x80, 0x01, 0x40, 0x80, 0x9D, 0x00, 0x09, 0x44, 0x0F, 0x03, 0x04, 0x08, 0x08, 0x12, 0x43,
+    0x80, 0x00, 0x00, 0x80, 0x85, 0x00, 0x09, 0x43, 0x8C, 0x82, 0x83, 0x04, 0xC0, 0x04, 0x44, 0x00, 0x02, 0x9F, 0x27, 0x01, 0xC0, 0x00, 0x42, 0x81, 0x9F, 0x94, 0x36, 0x45, 0x80, 0x0E, 0x01, 0x03,
+    0x1C, 0x10, 0xC0, 0x43, 0x20, 0x28, 0x38, 0x27, 0xC1, 0x18, 0x9C, 0x00, 0x05, 0x41, 0x00, 0x80, 0x99, 0x00, 0xC0, 0x23, 0x40, 0x24, 0x34, 0x83, 0x00, 0xC1, 0x00, 0x44, 0x04, 0xC4, 0x34, 0x0C,
+    0x04, 0x26, 0x93, 0x00, 0x3E, 0x44, 0x00, 0xF0, 0xC9, 0x28, 0xF0, 0x19, 0x42, 0x49, 0x4A, 0xCA, 0x0A, 0x40, 0x00, 0x03, 0x43, 0x00, 0x80, 0xC0, 0x30, 0xC0, 0x09, 0x44, 0x00, 0x11, 0x12, 0x92,
+    0x71, 0x18, 0x47, 0x8D, 0x42, 0x20, 0x1C, 0x60, 0x58, 0x46, 0xE0, 0xC1, 0x0A, 0x89, 0x00, 0x26, 0x43, 0x1C, 0x83, 0x72, 0x0E, 0xC0, 0x19, 0x43, 0xF9, 0x64, 0x14, 0xF8, 0x1D, 0x40, 0x01, 0x02,
+    0x8F, 0x00, 0x22, 0x42, 0x90, 0x50, 0x31, 0x8B, 0x00, 0x18, 0x41, 0x01, 0x01, 0x25, 0x40, 0xF8, 0x19, 0x93, 0x00, 0x00, 0x42, 0x4B, 0x4A, 0xFA, 0x27, 0x44, 0x08, 0x0A, 0xEB, 0x6A, 0x18, 0x3A,
+    0x40, 0x48, 0x35, 0x42, 0x87, 0x62, 0x03, 0x86, 0x00, 0x41, 0x0C, 0x03, 0xC0, 0x1F, 0x43, 0xE2, 0x21, 0x3F, 0xE0, 0x0E, 0x43, 0x06, 0xC5, 0x04, 0x8E, 0xC0, 0x28, 0x43, 0x06, 0x09, 0x09, 0x0F,
+    0xC7, 0x04, 0x40, 0x00, 0x02, 0x82, 0x00, 0xC0, 0x0C, 0x40, 0xF8, 0x2A, 0x44, 0x00, 0x80, 0xFF, 0x40, 0x30, 0x1C, 0x43, 0x38, 0x08, 0x8E, 0x78, 0x86, 0x00, 0xC0, 0x13, 0x40, 0xF9, 0x20, 0x40,
+    0x09, 0x11, 0x44, 0x00, 0x0E, 0x80, 0x41, 0x38, 0xC0, 0x04, 0x43, 0x20, 0xA1, 0xF8, 0x20, 0x32, 0x41, 0x09, 0x08, 0xC0, 0x01, 0x84, 0x00, 0x42, 0x03, 0x04, 0x07, 0x33, 0x43, 0x6A, 0x11, 0x00,
+    0xE0, 0x05, 0x44, 0xE1, 0x82, 0x42, 0x21, 0x20, 0xC1, 0x26, 0x83, 0x42, 0xC4, 0x05, 0x43, 0x04, 0xC4, 0x7C, 0x88, 0xC0, 0x3A, 0x44, 0x00, 0xC3, 0x30, 0x00, 0x03, 0x1E, 0x44, 0x44, 0x44, 0xF7,
+    0x40, 0x40, 0x3E, 0x89, 0x00, 0x17, 0x83, 0x00, 0x16, 0x41, 0x18, 0x07, 0xC0, 0x01, 0x42, 0xC0, 0xA0, 0x20, 0x0F, 0x84, 0x00, 0x08, 0x43, 0x40, 0x40, 0xC0, 0x00, 0x0B, 0x97, 0x00, 0xC0, 0x0A,
+    0x41, 0x00, 0x00, 0x1A, 0x43, 0x00, 0xE0, 0x80, 0x80, 0xC2, 0x27, 0x82, 0x00, 0xC0, 0x37, 0x40, 0x7E, 0x82, 0x4A, 0x3C, 0x82, 0x00, 0x43, 0xC8, 0x28, 0xFE, 0x08, 0x1E, 0x43, 0xC1, 0x31, 0x1F,
+    0xE2, 0xC0, 0x14, 0x84, 0x00, 0x41, 0x01, 0x01, 0xC0, 0x3A, 0x40, 0x48, 0x32, 0x84, 0x00, 0x1D, 0x43, 0x70, 0x0F, 0xC9, 0x38, 0xC0, 0x18, 0x43, 0x20, 0x38, 0xE0, 0x00, 0x1E, 0x43, 0x4C, 0x4A,
+    0xC9, 0x78, 0xC0, 0x2C, 0x44, 0x12, 0x13, 0xE0, 0xF0, 0x13, 0xC3, 0x2B, 0x88, 0x00, 0x26, 0x44, 0x08, 0x09, 0xF8, 0x08, 0x08, 0x32, 0x44, 0x20, 0xFC, 0x11, 0x78, 0x10, 0x12, 0x42, 0xE0, 0x90,
+    0xF0, 0x2E, 0x40, 0x01, 0x02, 0x8E, 0x00, 0x22, 0x42, 0x48, 0x48, 0xFF, 0xC0, 0x0B, 0x41, 0xF8, 0x08, 0xC0, 0x1A, 0x44, 0x4C, 0x43, 0xF0, 0x40, 0x40, 0xC0, 0x2F, 0x44, 0xE6, 0x25, 0x3C, 0x2E,
+    0xE0, 0x86, 0x00, 0x41, 0x18, 0x07, 0xC0, 0x1E, 0x43, 0xC6, 0xE9, 0x09, 0xCF, 0x0E, 0x44, 0x01, 0x00, 0x10, 0x0C, 0x03, 0x9D, 0x00, 0xC0, 0x09, 0x43, 0x21, 0x10, 0x0C, 0x03, 0x27, 0x42, 0x00,
+    0x80, 0x80, 0x85, 0x00, 0x19, 0x42, 0x01, 0x1F, 0x14, 0xC0, 0x3C, 0x43, 0x22, 0x22, 0x3E, 0x20, 0xC2, 0x22, 0x44, 0xFC, 0x30, 0x48, 0x84, 0x84, 0x31, 0x9C, 0x00, 0x42, 0xC0, 0x30, 0x0F, 0x86,
+    0x00, 0xC0, 0x35, 0x40, 0xF8, 0xC2, 0x2B, 0x91, 0x00, 0x43, 0xC3, 0x44, 0x77, 0xC0, 0x35, 0x83, 0x00, 0x04, 0x43, 0x60, 0x58, 0x46, 0xE0, 0x99, 0x00, 0x3B, 0x46, 0xCC, 0x38, 0x78, 0x84, 0x00,
+    0x1F, 0xFF, 0xC0, 0x3D, 0x40, 0x01, 0xC1, 0x1B, 0x43, 0xC0, 0x31, 0x29, 0xC8, 0x30, 0x44, 0x30, 0x18, 0xF8, 0x00, 0x00, 0xC0, 0x05, 0x43, 0x01, 0x02, 0x02, 0x01, 0x31, 0x41, 0xC0, 0x33, 0x00,
+    0x9E, 0x00, 0xC0, 0x2A, 0x41, 0x40, 0x40, 0xC0, 0x39, 0x83, 0x00, 0xC0, 0x2D, 0x83, 0x00, 0x09, 0x42, 0x80, 0xF0, 0x40, 0x0D, 0x96, 0x00, 0xC0, 0x09, 0x82, 0x80, 0x40, 0x00, 0x19, 0xA0, 0x00,
+    0xC4, 0x05, 0x44, 0x60, 0x5F, 0x41, 0x70, 0xC2, 0x03, 0x43, 0x04, 0xF4, 0x1C, 0x04, 0xC1, 0x32, 0x9C, 0x00, 0x1D, 0x43, 0x1A, 0x84, 0x40, 0x38, 0x85, 0x00, 0x3B, 0x42, 0x10, 0xFE, 0xD0, 0x2C,
+    0x43, 0x3D, 0x00, 0xC0, 0x3C, 0x85, 0x00, 0x41, 0xF1, 0xC8, 0xC0, 0x33, 0x42, 0x6C, 0x12, 0x01, 0x01, 0x82, 0x90, 0x39, 0x44, 0x00, 0xC1, 0xB1, 0x1F, 0xE2, 0xC0, 0x14, 0x44, 0x60, 0x5F, 0x41,
+    0x70, 0x80, 0xC0, 0x02, 0x44, 0x08, 0x0A, 0xFE, 0x8A, 0x8A, 0x32, 0x40, 0xB0, 0x11, 0x44, 0x14, 0x14, 0xFC, 0x12, 0x10, 0x30, 0x40, 0x08, 0xC0, 0x09, 0x40, 0x03, 0x02, 0x88, 0x00, 0x27, 0x43,
+    0x08, 0x89, 0x88, 0x70, 0xC0, 0x0A, 0x40, 0x30, 0x01, 0x85, 0x00, 0x27, 0x43, 0x02, 0x02, 0x03, 0x02, 0x01, 0x8C, 0x00, 0x44, 0x20, 0x20, 0xE3, 0x20, 0x20, 0xC0, 0x2C, 0x42, 0x00, 0x00, 0xF0,
+    0x8B, 0x00, 0x42, 0x40, 0x87, 0xF0, 0x1F, 0x41, 0x80, 0x78, 0x0C, 0x41, 0x71, 0x1F, 0x1A, 0x42, 0x40, 0xD8, 0x47, 0x15, 0x88, 0x00, 0x30, 0x43, 0x06, 0x05, 0x04, 0x0E, 0x0A, 0x43, 0xD0, 0xE8,
+    0x06, 0xC1, 0x18, 0x44, 0x08, 0x08, 0x0F, 0x08, 0x08, 0x13, 0x41, 0x00, 0xC0, 0x87, 0x00, 0xC0, 0x43, 0x61, 0x50, 0x4C, 0x43, 0x3B, 0x42, 0x10, 0x1F, 0x10, 0x3C, 0x44, 0x02, 0x42, 0x3E, 0x02,
+    0x02, 0x39, 0x41, 0x00, 0x3F, 0x82, 0x25, 0xC1, 0x0F, 0x43, 0x00, 0x80, 0x00, 0x00, 0xC1, 0x3A, 0x44, 0x80, 0x85, 0xFD, 0x84, 0x80, 0xC0, 0x04, 0x40, 0x08, 0xC0, 0x3E, 0x40, 0x82, 0xC0, 0x1C,
+    0x44, 0x09, 0x09, 0xF9, 0x09, 0x08, 0xC0, 0x3B, 0x40, 0xFF, 0xC0, 0x1B, 0x44, 0x09, 0x08, 0xFE, 0x08, 0x08, 0xC0, 0x15, 0x41, 0x91, 0x70, 0x8A, 0x00, 0x18, 0x41, 0x33, 0x28, 0xC0, 0x16, 0x42,
+    0x4B, 0xFA, 0x02, 0xC6, 0x21, 0x83, 0x00, 0xC0, 0x10, 0x87, 0x00, 0x14, 0x84, 0x00, 0x08, 0x84, 0x00, 0xC0, 0x0E, 0x82, 0x80, 0x86, 0x00, 0x13, 0x43, 0x00, 0x80, 0x80, 0x00, 0x18, 0xA1, 0x00,
+    0xC1, 0x09, 0x41, 0x00, 0xFC, 0x82, 0x94, 0xC0, 0x3B, 0x41, 0x84, 0xFC, 0x1F, 0x43, 0x70, 0x8C, 0x8A, 0x72, 0x84, 0x00, 0x0F, 0x43, 0x09, 0x09, 0xF9, 0x09, 0x19, 0x9C, 0x00, 0x2C, 0x40, 0x08,
+    0x17, 0x40, 0x01, 0x1C, 0x42, 0x24, 0xE4, 0x24, 0x1D, 0x9C, 0x00, 0xC0, 0x22, 0x42, 0x40, 0x70, 0xC0, 0x98, 0x00, 0x14, 0x43, 0xC4, 0x32, 0x61, 0x80, 0x00, 0x84, 0x00, 0x43, 0x04, 0xF4, 0x1C,
+    0x04, 0xC0, 0x3B, 0x40, 0x01, 0x11, 0x45, 0x08, 0x0A, 0xFE, 0x8A, 0x8A, 0x00, 0x1C, 0x84, 0x00, 0xC0, 0x17, 0x4E, 0x00, 0x12, 0x12, 0x92, 0x70, 0x00, 0x70, 0x0C, 0x18, 0xE0, 0x80, 0x85, 0x84,
+    0x84, 0xBC, 0xC0, 0x32, 0x40, 0xFE, 0xC1, 0x14, 0x89, 0x00, 0x05, 0x43, 0x79, 0x02, 0x82, 0x79, 0x1D, 0x43, 0x6A, 0x12, 0x03, 0xE2, 0xC0, 0x0B, 0x40, 0xD0, 0x0C, 0x42, 0x08, 0x04, 0x03, 0x1E,
+    0x42, 0x04, 0x02, 0x01, 0x03, 0x8C, 0x00, 0x0C, 0x95, 0x00, 0xC0, 0x0D, 0x41, 0x50, 0x90, 0x19, 0x41, 0x80, 0x78, 0xC0, 0x00, 0x42, 0x8F, 0x48, 0x48, 0xC0, 0x31, 0x82, 0x81, 0x06, 0x43, 0x0E,
+    0x11, 0x11, 0x0E, 0xC0, 0x1F, 0x40, 0xFE, 0x0F, 0x43, 0x20, 0x23, 0x24, 0x39, 0x94, 0x00, 0xC0, 0x13, 0x44, 0x62, 0x9A, 0xFF, 0x02, 0x02, 0xC1, 0x04, 0x43, 0x6E, 0x92, 0x92, 0xFE, 0x05, 0x43,
+    0x6E, 0x92, 0x92, 0xFE, 0xC3, 0x26, 0x43, 0xFE, 0x10, 0x20, 0x01, 0x86, 0x00, 0xC0, 0x34, 0x41, 0x01, 0x3C, 0xC0, 0x1C, 0x43, 0x0F, 0x80, 0x70, 0x0F, 0x9E, 0x00, 0x43, 0x43, 0x42, 0x7E, 0x40,
+    0xC0, 0x18, 0x41, 0x0B, 0xFE, 0x11, 0x40, 0x1C, 0xC1, 0x34, 0x42, 0xF8, 0x0B, 0xF8, 0xC0, 0x3C, 0x42, 0x03, 0x01, 0x03, 0xC5, 0x2E, 0x88, 0x00, 0x31, 0x43, 0x11, 0x11, 0x1F, 0x10, 0x3E, 0x82,
+    0x00, 0x40, 0xE0, 0x15, 0x40, 0xC1, 0x38, 0x40, 0x00, 0xC0, 0x00, 0x83, 0x00, 0x43, 0x3F, 0x10, 0x18, 0x06, 0x03, 0x44, 0x00, 0x00, 0x80, 0x80, 0x00, 0x2C, 0x45, 0x00, 0x01, 0x71, 0x0D, 0x03,
+    0x01, 0x03, 0x44, 0x00, 0x3E, 0x41, 0x41, 0x3E, 0x28, 0x82, 0x21, 0x05, 0x41, 0x00, 0x80, 0x82, 0x00, 0x43, 0x66, 0x1C, 0x3C, 0x42, 0x01, 0x82, 0x00, 0x0F, 0xA1, 0x00, 0x34, 0x45, 0x00, 0x04,
+    0x84, 0x7F, 0x04, 0x04, 0x0D, 0x44, 0x80, 0x00, 0x80, 0x00, 0x00, 0x04, 0x40, 0xFC, 0xC0, 0x20, 0x42, 0x00, 0x20, 0x11, 0xC0, 0x11, 0x43, 0x1C, 0x0E, 0xC0, 0x3C, 0x36, 0x44, 0x08, 0x09, 0xFE,
+    0x08, 0x08, 0xC0, 0x41, 0x02, 0x01, 0x39, 0x40, 0x03, 0x3C, 0x9C, 0x00, 0x0A, 0x43, 0x42, 0xF9, 0x20, 0xE0, 0x0F, 0x43, 0x11, 0x12, 0xF2, 0x01, 0x85, 0x00, 0x2B, 0x42, 0x94, 0x94, 0xFC, 0x2D,
+    0x42, 0xFE, 0x42, 0xFE, 0x9F, 0x00, 0xC0, 0x1C, 0x40, 0x0A, 0x21, 0x43, 0x04, 0x07, 0x84, 0x7C, 0xC0, 0x3C, 0x41, 0x02, 0x01, 0xC3, 0x27, 0x8A, 0x00, 0x26, 0x44, 0x84, 0xF2, 0x41, 0xE0, 0x40,
+    0xC0, 0x09, 0x82, 0x80, 0x2E, 0x42, 0x03, 0x1C, 0x01, 0x00, 0x8E, 0x00, 0xC0, 0x30, 0x82, 0x80, 0x8A, 0x00, 0x31, 0x42, 0xA1, 0x90, 0x8C, 0x1C, 0x40, 0x91, 0xC0, 0x1F, 0x41, 0x62, 0xDF, 0x19,
+    0x43, 0x10, 0x0C, 0x7E, 0x01, 0x0A, 0x89, 0x00, 0xC0, 0x35, 0x89, 0x00, 0xC0, 0x08, 0x43, 0xC8, 0x28, 0xFE, 0x08, 0xC0, 0x3C, 0x41, 0x01, 0x01, 0xC0, 0x0B, 0x44, 0x80, 0x8E, 0x92, 0xE6, 0x00,
+    0x36, 0x42, 0x38, 0x90, 0x78, 0x86, 0x00, 0x3B, 0x40, 0x08, 0x1B, 0x9B, 0x00, 0x00, 0x42, 0xA2, 0xF9, 0x20, 0x86, 0x00, 0x18, 0x40, 0x11, 0x01, 0x40, 0x10, 0x3C, 0x41, 0xE0, 0x20, 0x3C, 0x40,
+    0x26, 0x04, 0x43, 0x82, 0xA2, 0xE2, 0x9C, 0x05, 0x85, 0x42, 0x07, 0x44, 0x00, 0xCC, 0x38, 0x78, 0x84, 0x30, 0x43, 0x80, 0xFF, 0x40, 0x30, 0xC0, 0x00, 0x42, 0xFF, 0x08, 0x10, 0x82, 0x00, 0x34,
+    0x40, 0x01, 0x1C, 0x8E, 0x00, 0x34, 0x85, 0x00, 0xC0, 0x04, 0x42, 0x24, 0x26, 0xFD, 0x15, 0x42, 0x10, 0xF0, 0x10, 0x01, 0x46, 0x10, 0xD0, 0x70, 0x10, 0xF0, 0x52, 0x71, 0x11, 0x41, 0xF8, 0x08,
+    0xC0, 0x06, 0x42, 0x02, 0x02, 0x03, 0x14, 0x47, 0x02, 0x02, 0x03, 0x02, 0x02, 0x00, 0x04, 0x03, 0xC1, 0x1A, 0x42, 0xE8, 0x24, 0xE3, 0x01, 0x43, 0x8C, 0xF3, 0x40, 0xE0, 0xC0, 0x30, 0x48, 0x06,
+    0x95, 0x94, 0x2E, 0x00, 0x00, 0x0F, 0x04, 0x0F, 0x02, 0x42, 0xC3, 0x5C, 0x01, 0x39, 0x94, 0x00, 0x21, 0x43, 0x00, 0x06, 0x04, 0x09, 0x85, 0x00, 0x3E, 0x95, 0x00, 0xC2, 0x26, 0x83, 0x00, 0xC0,
+    0x2D, 0x83, 0x00, 0x08, 0x84, 0x00, 0xC0, 0x2C, 0x84, 0x00, 0x44, 0x87, 0x40, 0x20, 0x1C, 0x00, 0x12, 0x98, 0x00, 0xC0, 0x09, 0x40, 0x42, 0xC2, 0x33, 0x44, 0x05, 0x04, 0xF4, 0x34, 0x0C, 0x0A,
+    0x44, 0x10, 0xD3, 0xFE, 0x10, 0x10, 0xC0, 0x21, 0x42, 0xC2, 0x21, 0x10, 0x06, 0x42, 0xC6, 0x31, 0x60, 0x0B, 0x42, 0x03, 0x04, 0x07, 0xC1, 0x2B, 0x42, 0x94, 0x94, 0xFC, 0xC4, 0x10, 0x43, 0xE2,
+    0x12, 0x13, 0xE0, 0x22, 0x42, 0x23, 0xFD, 0xE3, 0xC0, 0x16, 0x42, 0x03, 0x05, 0x04, 0x21, 0x43, 0x08, 0x06, 0x05, 0x07, 0xC1, 0x01, 0x88, 0x00, 0x27, 0x44, 0xC0, 0x03, 0x9C, 0x41, 0x40, 0xC0,
+    0x09, 0x43, 0x40, 0x80, 0x00, 0x80, 0x2C, 0x44, 0x0F, 0x03, 0x04, 0x08, 0x08, 0x8D, 0x00, 0x23, 0x43, 0x91, 0x91, 0x9F, 0x90, 0xC0, 0x01, 0x96, 0x00, 0x42, 0x01, 0x1F, 0xD4, 0x1F, 0x43, 0x20,
+    0x10, 0x0C, 0x03, 0x27, 0x42, 0x8C, 0xFE, 0x81, 0x14, 0x89, 0x00, 0x0E, 0x42, 0x30, 0x0C, 0x03, 0x8A, 0x00, 0xC0, 0x00, 0x43, 0x04, 0x84, 0x64, 0x1C, 0xC0, 0x26, 0x44, 0x01, 0x81, 0x7D, 0x0D,
+    0x03, 0xC0, 0x06, 0x82, 0x00, 0x26, 0x44, 0x1E, 0x03, 0x03, 0xC2, 0x3E, 0x05, 0x44, 0x09, 0x09, 0xF9, 0x09, 0x08, 0x30, 0x42, 0xFE, 0x43, 0xFE, 0x85, 0x00, 0x09, 0x84, 0x00, 0x28, 0x40, 0x01,
+    0x08, 0x40, 0x91, 0x35, 0x87, 0x00, 0x0A, 0x40, 0x84, 0x3D, 0x44, 0x2A, 0x29, 0xF8, 0x24, 0x20, 0xC0, 0x3B, 0x41, 0x06, 0x01, 0xC1, 0x04, 0x43, 0x20, 0x10, 0xFC, 0x03, 0x14, 0x43, 0x09, 0x09,
+    0xF9, 0x09, 0x30, 0x43, 0x7D, 0xB2, 0x8A, 0x7C, 0x04, 0x43, 0x00, 0x1C, 0xC8, 0x3C, 0x9F, 0x00, 0x06, 0x40, 0x01, 0x10, 0x46, 0x08, 0x3E, 0xFE, 0x08, 0x00, 0x84, 0x85, 0x3C, 0x40, 0x09, 0x12,
+    0x8E, 0x00, 0x18, 0x41, 0x12, 0xF1, 0x1F, 0x43, 0x38, 0x1F, 0x80, 0x78, 0x35, 0x8A, 0x00, 0x3A, 0x47, 0x7C, 0x02, 0x81, 0x78, 0x00, 0xFA, 0xFB, 0x02, 0x99, 0x00, 0x22, 0x43, 0x40, 0xC3, 0x45,
+    0x44, 0x3B, 0x41, 0x88, 0xF7, 0x3E, 0x40, 0x0F, 0xC1, 0x11, 0x40, 0xE5, 0x01, 0x40, 0xE0, 0x1D, 0x43, 0xA6, 0x44, 0x09, 0x80, 0xC0, 0x19, 0x43, 0xA1, 0x90, 0x8E, 0x81, 0x1D, 0x43, 0x91, 0x88,
+    0x84, 0x03, 0x37, 0x41, 0xDF, 0x54, 0xC0, 0x3C, 0x44, 0x18, 0x17, 0x10, 0x1C, 0x20, 0xC2, 0x43, 0xC1, 0x31, 0x1F, 0xE2, 0x12, 0x8A, 0x00, 0x21, 0x84, 0x00, 0x2B, 0x44, 0x18, 0x07, 0xC4, 0x3C,
+    0x04, 0x84, 0x00, 0x35, 0x84, 0x00, 0x09, 0x40, 0x82, 0x02, 0x41, 0x04, 0xC4, 0x09, 0x98, 0x00, 0x08, 0x41, 0x39, 0x90, 0xC0, 0x0F, 0x40, 0x01, 0x0B, 0x41, 0x0E, 0xC8, 0xC1, 0x01, 0x9B, 0x00,
+    0x21, 0x44, 0x00, 0x10, 0x16, 0x11, 0xE0, 0x1D, 0x42, 0x60, 0x33, 0xF4, 0x21, 0x84, 0x00, 0x03, 0x44, 0x40, 0x42, 0x42, 0x7E, 0x40, 0x2C, 0x40, 0xFC, 0x82, 0x94, 0x2D, 0x42, 0x94, 0x94, 0xFC,
+    0xC1, 0x06, 0x43, 0xF0, 0x48, 0x78, 0xC0, 0x0E, 0x43, 0x24, 0x64, 0xE4, 0x1C, 0x09, 0x45, 0x84, 0x85, 0x84, 0xFC, 0x00, 0x00, 0xC0, 0x18, 0x43, 0x11, 0xF0, 0x10, 0x01, 0x10, 0x40, 0x01, 0x05,
+    0x85, 0x00, 0x00, 0x41, 0x1C, 0x81, 0xC0, 0x19, 0x48, 0xF2, 0x12, 0x1F, 0x12, 0xF2, 0x00, 0x24, 0xC3, 0xF8, 0x13, 0x44, 0x00, 0xF8, 0x00, 0x00, 0xC0, 0x04, 0x43, 0x20, 0x22, 0xFF, 0xE2, 0x19,
+    0x43, 0xFA, 0x02, 0x03, 0xC2, 0x38, 0x46, 0x08, 0x06, 0x01, 0x00, 0x06, 0x01, 0x01, 0x1D, 0x43, 0x08, 0x86, 0xF5, 0x47, 0x19, 0x42, 0x87, 0xF2, 0x43, 0x1F, 0x43, 0x78, 0x4F, 0xC0, 0x40, 0x37,
+    0x41, 0x84, 0x6F, 0xC0, 0x01, 0x42, 0x10, 0x0C, 0x03, 0x28, 0x89, 0x00, 0x03, 0x42, 0x04, 0x03, 0x1F, 0x1F, 0x42, 0x8F, 0x83, 0x84, 0xC0, 0x0B, 0x41, 0x00, 0x80, 0x87, 0x00, 0x26, 0x42, 0x1C,
+    0x12, 0x11, 0x1E, 0x94, 0x00, 0xC0, 0x0D, 0x8E, 0x00, 0xC2, 0x0E, 0x43, 0x04, 0x9F, 0x7F, 0x04, 0x2C, 0x43, 0x08, 0xFF, 0xA4, 0x9C, 0x35, 0x44, 0x00, 0x89, 0x88, 0xF8, 0x80, 0x0F, 0x40, 0x01,
+    0xC0, 0x20, 0x42, 0x1C, 0x25, 0xCC, 0x06, 0x40, 0x38, 0xC0, 0x33, 0x83, 0x01, 0xC2, 0x18, 0x41, 0x60, 0x33, 0x3A, 0x43, 0x20, 0x10, 0xFC, 0x03, 0xC0, 0x2C, 0x42, 0x84, 0xFC, 0x84, 0x0B, 0x43,
+    0xC5, 0x29, 0x3D, 0x43, 0xC0, 0x05, 0x43, 0x0E, 0x80, 0x41, 0x38, 0x31, 0x40, 0x84, 0x16, 0x42, 0x08, 0xF8, 0x08, 0x2E, 0x40, 0x01, 0xC0, 0x0B, 0x84, 0x01, 0x18, 0x8F, 0x00, 0x3A, 0x44, 0x54,
+    0x52, 0xF1, 0x48, 0x60, 0x31, 0x40, 0xE0, 0x20, 0x44, 0xC4, 0xBC, 0xE7, 0x20, 0x00, 0x0D, 0x43, 0x46, 0x45, 0xC7, 0x40, 0x0F, 0x41, 0xE0, 0x2C, 0xC0, 0x15, 0x44, 0x80, 0x79, 0x4D, 0xC7, 0x40,
+    0x0E, 0x42, 0x10, 0x0F, 0x01, 0xC0, 0x28, 0x43, 0x01, 0xF0, 0x0C, 0x03, 0xC0, 0x28, 0x83, 0x01, 0xC3, 0x0F, 0x43, 0x7E, 0x1C, 0x0C, 0x7E, 0xC0, 0x89, 0x00, 0xC3, 0x17, 0x83, 0x00, 0x37, 0x44,
+    0x08, 0x08, 0xFE, 0x08, 0x08, 0x30, 0x84, 0x00, 0x04, 0x82, 0x00, 0x10, 0x96, 0x00, 0x14, 0x41, 0x28, 0x2B, 0x1F, 0x43, 0x38, 0x1F, 0x80, 0x78, 0x0F, 0x40, 0xF0, 0x08, 0x40, 0x80, 0x12, 0x42,
+    0x48, 0x48, 0xC8, 0x28, 0x42, 0xA0, 0xA6, 0xE1, 0x1E, 0x42, 0xC4, 0x22, 0x11, 0xC1, 0x21, 0x40, 0x08, 0x83, 0x00, 0xC0, 0x18, 0x43, 0x60, 0xF0, 0x0C, 0x00, 0xC0, 0x3B, 0x43, 0x04, 0xF7, 0x34,
+    0x0C, 0x27, 0x42, 0x50, 0x50, 0xF1, 0x0F, 0x43, 0x08, 0xC9, 0x28, 0x38, 0x3C, 0x42, 0xE6, 0x11, 0x10, 0x28, 0x42, 0x02, 0x02, 0x03, 0x10, 0x41, 0x21, 0xFE, 0x3E, 0x43, 0x43, 0xFD, 0x44, 0x40,
+    0x1C, 0x43, 0x80, 0x61, 0xCE, 0x00, 0xC0, 0x19, 0x42, 0x7C, 0x53, 0xDF, 0x1E, 0x44, 0xE3, 0x70, 0x00, 0xE7, 0x04, 0xC2, 0x18, 0x83, 0x41, 0x28, 0x88, 0x00, 0x26, 0x40, 0xDC, 0x21, 0x44, 0x02,
+    0x42, 0x3E, 0x02, 0x02, 0x26, 0x88, 0x00, 0x27, 0x43, 0x21, 0x10, 0x08, 0x07, 0xC1, 0x00, 0x8E, 0x00, 0xC2, 0x0E, 0x42, 0x85, 0xFC, 0x84, 0x09, 0x8A, 0x00, 0xC0, 0x35, 0x40, 0x08, 0xC0, 0x11,
+    0x44, 0x05, 0x05, 0xF5, 0x35, 0x0C, 0xC0, 0x0A, 0x44, 0x90, 0x7F, 0xC8, 0x48, 0x40, 0x2B, 0x41, 0x06, 0x01, 0x06, 0x44, 0x03, 0x7C, 0x07, 0x80, 0x78, 0xC0, 0x00, 0x41, 0x30, 0xF0, 0x04, 0x83,
+    0x42, 0x21, 0x43, 0xC8, 0x28, 0xFE, 0x08, 0x8B, 0x00, 0xC0, 0x30, 0x41, 0x85, 0xFD, 0x24, 0x43, 0x05, 0xF4, 0x1C, 0x04, 0x37, 0x41, 0x3E, 0xFE, 0xC0, 0x01, 0x40, 0x09, 0x30, 0x42, 0x21, 0x20,
+    0xE0, 0x06, 0x41, 0x02, 0x01, 0xC0, 0x02, 0x41, 0xC1, 0x3D, 0x2E, 0x43, 0x02, 0x02, 0x03, 0x02, 0x1E, 0x41, 0xA1, 0x63, 0x0B, 0x84, 0x00, 0x17, 0x40, 0x03, 0x1B, 0x8F, 0x00, 0x18, 0x42, 0xE0,
+    0x28, 0x66, 0x01, 0x43, 0x96, 0x91, 0x91, 0x90, 0x03, 0x43, 0x00, 0x47, 0x44, 0xC4, 0x0B, 0x41, 0x80, 0x60, 0x82, 0x00, 0x36, 0x40, 0x80, 0x24, 0x43, 0x08, 0x08, 0x09, 0x0E, 0x02, 0x41, 0x10,
+    0x0F, 0xC1, 0x00, 0x43, 0x50, 0x48, 0xC6, 0x01, 0x15, 0x41, 0xDF, 0x80, 0xC0, 0x22, 0x44, 0x08, 0x88, 0x88, 0x8F, 0x48, 0x14, 0x44, 0x07, 0x00, 0x01, 0x0E, 0x08, 0x31, 0x41, 0x1F, 0x14, 0x0C,
+    0x40, 0xC2, 0xC0, 0x2E, 0x42, 0x3F, 0x05, 0x07, 0x8B, 0x00, 0x42, 0x62, 0x5F, 0x7E, 0xC1, 0x1D, 0x44, 0x00, 0x04, 0x9F, 0x7F, 0x04, 0xC4, 0x12, 0x40, 0x38, 0x83, 0x00, 0xC0, 0x2D, 0x84, 0x00,
+    0x44, 0xD0, 0x13, 0xFE, 0xD0, 0x10, 0x04, 0x41, 0x50, 0xF0, 0x0C, 0x97, 0x00, 0x09, 0x42, 0xC4, 0x27, 0xE0, 0x86, 0x00, 0x35, 0x45, 0x10, 0x10, 0xF0, 0x00, 0x60, 0x31, 0x01, 0x41, 0x03, 0x02,
+    0x2A, 0x44, 0x00, 0x88, 0x88, 0xF8, 0x80, 0x0E, 0x93, 0x00, 0xC0, 0x04, 0x44, 0x00, 0x87, 0x40, 0x20, 0x1C, 0x0E, 0x41, 0x84, 0xFC, 0xC0, 0x2A, 0x83, 0x10, 0x03, 0x40, 0x84, 0x84, 0x00, 0x34,
+    0x44, 0x00, 0xF9, 0x64, 0x14, 0xF8, 0x37, 0x40, 0x10, 0x01, 0x40, 0x00, 0x05, 0x41, 0x50, 0x70, 0x39, 0x40, 0x89, 0xC0, 0x0A, 0x43, 0xC0, 0x42, 0x72, 0xC3, 0xC0, 0x3B, 0x43, 0x01, 0x08, 0x04,
+    0x03, 0x2D, 0x43, 0xD7, 0x22, 0x03, 0xC0, 0x8F, 0x00, 0x34, 0x43, 0x24, 0x30, 0xBF, 0x61, 0x32, 0x42, 0xC8, 0x04, 0x82, 0xC0, 0x05, 0x44, 0x04, 0x02, 0x1F, 0x01, 0x06, 0xC3, 0x13, 0x45, 0x00,
+    0x3E, 0x01, 0x00, 0x07, 0x18, 0xC0, 0x10, 0x40, 0x8C, 0x14, 0x89, 0x00, 0x08, 0x43, 0x64, 0x94, 0xFF, 0x04, 0x98, 0x00, 0x43, 0x64, 0x94, 0xFF, 0x04, 0x1F, 0x43, 0x12, 0x32, 0xF2, 0x0E, 0x0F,
+    0x44, 0xC4, 0x34, 0xFF, 0x04, 0x04, 0x3E, 0x98, 0x00, 0x23, 0x41, 0x01, 0x01, 0x1D, 0x40, 0x00, 0x83, 0x08, 0x28, 0x40, 0x42, 0x3D, 0x42, 0x88, 0x71, 0x7E, 0x1A, 0x43, 0xF8, 0x64, 0x14, 0xF8,
+    0x34, 0x84, 0x00, 0x22, 0x43, 0x04, 0x05, 0xF4, 0x34, 0x10, 0x42, 0x08, 0x0B, 0xF8, 0x87, 0x00, 0x41, 0x01, 0x01, 0x32, 0x83, 0x00, 0x27, 0x43, 0x76, 0x91, 0x90, 0xF0, 0x0E, 0x44, 0x01, 0xA1,
+    0xA1, 0xE1, 0x01, 0x1D, 0x44, 0x54, 0x52, 0xF1, 0x48, 0x40, 0x04, 0x43, 0x4E, 0x49, 0x48, 0xC0, 0x0F, 0x43, 0x38, 0x00, 0x00, 0xE0, 0x43, 0x84, 0xFC, 0x84, 0x00, 0x14, 0x44, 0xFC, 0x30, 0x48,
+    0x84, 0x84, 0x34, 0x43, 0xC5, 0x29, 0x3D, 0x43, 0x1E, 0x43, 0x20, 0x10, 0xFC, 0x03, 0x05, 0x40, 0x42, 0x17, 0x43, 0x82, 0xA2, 0xE2, 0x9C, 0x35, 0x40, 0x04, 0x23, 0x40, 0x01, 0x31, 0x44, 0x3C,
+    0x04, 0x07, 0x84, 0x7C, 0xC0, 0x36, 0x47, 0x38, 0x1F, 0x80, 0x78, 0x00, 0x90, 0x52, 0x31, 0xC0, 0x14, 0x43, 0xC0, 0x42, 0x72, 0xC3, 0x1E, 0x42, 0x24, 0xA2, 0x61, 0x01, 0x42, 0x43, 0x72, 0xC2,
+    0x23, 0x42, 0xF3, 0x10, 0xF0, 0x2D, 0x43, 0x41, 0x08, 0x04, 0x03, 0xC0, 0x0A, 0x42, 0x07, 0x02, 0x07, 0x1A, 0x8E, 0x00, 0xC0, 0x30, 0x42, 0x00, 0x80, 0x60, 0xC2, 0x0D, 0x40, 0x11, 0xC0, 0x3C,
+    0x40, 0x3F, 0x82, 0x25, 0x98, 0x00, 0x15, 0x40, 0x87, 0xC0, 0x3C, 0x42, 0x60, 0x18, 0x07, 0x8A, 0x00, 0xC0, 0x31, 0x42, 0x1C, 0x62, 0xA2, 0x0B, 0x42, 0x8E, 0x92, 0xE6, 0xC1, 0x32, 0x43, 0x98,
+    0x70, 0xF0, 0x08, 0x85, 0x00, 0x0D, 0x89, 0x00, 0xC0, 0x1D, 0x43, 0x09, 0x08, 0xF8, 0x01, 0x13, 0x42, 0x10, 0x10, 0xFC, 0x28, 0x84, 0x00, 0xC0, 0x2C, 0x83, 0x00, 0x0A, 0x44, 0x10, 0x10, 0xE0,
+    0x00, 0xE3, 0x03, 0x42, 0x0C, 0x06, 0xFE, 0x87, 0x00, 0x03, 0x85, 0x00, 0xC1, 0x25, 0x93, 0x00, 0xC1, 0x31, 0x42, 0x39, 0x48, 0x98, 0x06, 0x43, 0x0A, 0x09, 0x08, 0x08, 0x0E, 0x84, 0x00, 0xC0,
+    0x1C, 0x40, 0xC2, 0x02, 0x86, 0x00, 0x83, 0x01, 0x0E, 0x40, 0x40, 0xC1, 0x08, 0x42, 0xC8, 0x84, 0xC3, 0x06, 0x84, 0x00, 0xC0, 0x1D, 0x47, 0x48, 0x49, 0xFE, 0x40, 0x40, 0x80, 0x70, 0xCF, 0x0A,
+    0x42, 0x11, 0x0C, 0x03, 0x05, 0x43, 0x00, 0x90, 0x90, 0x20, 0x05, 0x44, 0x80, 0xA0, 0xE3, 0xBC, 0xA1, 0xC0, 0x14, 0x42, 0x0C, 0x13, 0x1F, 0x01, 0x40, 0x03, 0x01, 0x41, 0x07, 0x54, 0x1B, 0x41,
+    0x00, 0x00, 0xC0, 0x3B, 0x40, 0x81, 0xC0, 0x3B, 0x43, 0x10, 0x0C, 0x7E, 0x01, 0xC2, 0x00, 0x40, 0x00, 0x2A, 0x8A, 0x00, 0x26, 0x43, 0xF8, 0x24, 0x3C, 0xE0, 0xC0, 0x0A, 0x40, 0x88, 0x34, 0x8D,
+    0x00, 0x0F, 0x41, 0x10, 0x20, 0xC1, 0x3C, 0x44, 0x10, 0x10, 0xF1, 0x11, 0x10, 0xC0, 0x3C, 0x40, 0x03, 0x37, 0x40, 0xE0, 0x1C, 0x42, 0x8C, 0x06, 0xFE, 0x86, 0x00, 0x04, 0x83, 0x08, 0xC5, 0x2C,
+    0x43, 0x24, 0x25, 0x25, 0xE0, 0xC0, 0x3B, 0x43, 0xF8, 0x04, 0x03, 0xC0, 0x22, 0x44, 0xE1, 0x28, 0x3C, 0x23, 0xE0, 0xC0, 0x09, 0x43, 0xC7, 0x22, 0x27, 0xC0, 0x2C, 0x44, 0x01, 0x00, 0x10, 0x0C,
+    0x03, 0xC0, 0x09, 0x43, 0x07, 0x08, 0x08, 0x07, 0x1A, 0x8D, 0x00, 0x26, 0x40, 0x82, 0x01, 0x41, 0x86, 0x80, 0xC0, 0x03, 0x42, 0x00, 0x00, 0xE0, 0x33, 0x44, 0x1F, 0x06, 0x09, 0x10, 0x10, 0xC3,
+    0x12, 0x44, 0x21, 0x21, 0x3F, 0x21, 0x21, 0x3B, 0x44, 0xF8, 0x04, 0x02, 0x1C, 0x60, 0xC0, 0x3A, 0x44, 0x08, 0x3F, 0xC4, 0x1E, 0x04, 0x0E, 0x43, 0x09, 0x89, 0x79, 0x0F, 0xC0, 0x97, 0x00, 0x11,
+    0x40, 0x01, 0x10, 0x40, 0x01, 0xC0, 0x2A, 0x40, 0xF0, 0x82, 0x50, 0xC0, 0x2C, 0x42, 0xC0, 0xE3, 0x18, 0x8A, 0x00, 0x00, 0x40, 0x03, 0x82, 0x02, 0x31, 0x42, 0xF1, 0x11, 0xF1, 0x36, 0x42, 0x61,
+    0x30, 0xF7, 0x8B, 0x00, 0xC1, 0x0D, 0x44, 0x04, 0x04, 0xFC, 0x04, 0x04, 0xC0, 0x22, 0x42, 0xFC, 0x14, 0x1D, 0x15, 0x42, 0x10, 0x10, 0xF0, 0x2D, 0x92, 0x00, 0x3B, 0x83, 0x09, 0x2C, 0x40, 0xC8,
+    0x1B, 0x43, 0xE0, 0x91, 0xF1, 0x80, 0xC0, 0x00, 0x84, 0x00, 0x35, 0x43, 0xFB, 0x00, 0x00, 0xC3, 0xC0, 0x01, 0x41, 0x60, 0xC0, 0xC0, 0x1A, 0x43, 0x9C, 0x93, 0x9F, 0x80, 0x27, 0x44, 0x91, 0x9C,
+    0x93, 0x90, 0x80, 0x08, 0x44, 0x40, 0x4F, 0xC4, 0x4F, 0x40, 0xC0, 0x00, 0x43, 0x00, 0x10, 0x0C, 0x03, 0x28, 0x41, 0x10, 0x0F, 0x0A, 0x42, 0x00, 0x00, 0xCF, 0x1F, 0x43, 0xAF, 0x23, 0xA4, 0x68,
+    0xC0, 0x3B, 0x43, 0x18, 0x05, 0x07, 0x08, 0xC0, 0x3B, 0x83, 0x02, 0xC2, 0x1E, 0x42, 0xC4, 0x38, 0x3F, 0x99, 0x00, 0xC0, 0x0E, 0x89, 0x00, 0x09, 0x40, 0x84, 0x1B, 0x42, 0x69, 0x49, 0x92, 0xC0,
+    0x00, 0x43, 0x90, 0x50, 0xFD, 0x10, 0x19, 0x44, 0x80, 0x84, 0x84, 0xFC, 0x80, 0x1C, 0x8E, 0x00, 0x44, 0x10, 0x14, 0xFC, 0x14, 0x14, 0x88, 0x00, 0x22, 0x42, 0x05, 0x06, 0xF7, 0x1C, 0x41, 0xF0,
+    0x10, 0x0A, 0x89, 0x00, 0x08, 0x40, 0x04, 0x0F, 0x42, 0xE1, 0x19, 0x01, 0x0A, 0x43, 0x93, 0x92, 0x92, 0x72, 0x3B, 0x43, 0xE0, 0xDF, 0xF0, 0x10, 0x0A, 0x41, 0x10, 0x10, 0xC0, 0x0D, 0x43, 0x8D,
+    0x42, 0x20, 0x1C, 0xC0, 0x00, 0x85, 0x00, 0xC1, 0x11, 0x44, 0x10, 0x8A, 0x52, 0x7A, 0x86, 0xC0, 0x3B, 0x43, 0x71, 0x6E, 0xF8, 0x08, 0xC0, 0x0F, 0x43, 0x06, 0xF9, 0x08, 0x80, 0x0A, 0x42, 0x49,
+    0x49, 0x91, 0x0C, 0x41, 0xE3, 0x20, 0x0A, 0x42, 0x44, 0x73, 0xC1, 0xC0, 0x10, 0x44, 0x43, 0xFA, 0x22, 0x23, 0xE5, 0x09, 0x42, 0x03, 0x02, 0x04, 0x06, 0x42, 0x00, 0xF8, 0x06, 0x01, 0x42, 0x94,
+    0x97, 0x94, 0xC0, 0x1E, 0x47, 0x92, 0x91, 0x9F, 0x81, 0x01, 0xC0, 0x90, 0xCC, 0x0A, 0x49, 0x20, 0x31, 0xED, 0x27, 0x20, 0x00, 0x58, 0x4F, 0xFC, 0x43, 0x18, 0x83, 0x00, 0x18, 0x44, 0x97, 0x98,
+    0x98, 0x97, 0x80, 0x27, 0x42, 0x80, 0x90, 0x8C, 0x01, 0x42, 0x11, 0x0C, 0x03, 0x0A, 0x44, 0x04, 0xE4, 0x07, 0x04, 0xE4, 0x01, 0x47, 0x93, 0x5F, 0x40, 0x00, 0x23, 0x20, 0x20, 0xE7, 0x13, 0x42,
+    0xA0, 0x40, 0x00, 0x1A, 0x41, 0x10, 0x0F, 0x1B, 0x8D, 0x00, 0x43, 0x52, 0x52, 0x5F, 0x40, 0x14, 0x48, 0x0E, 0x11, 0x11, 0x0E, 0x00, 0x21, 0x11, 0x0F, 0x09, 0xC0, 0x0E, 0x8E, 0x00, 0xC1, 0x3A,
+    0x43, 0x1C, 0x03, 0x06, 0x38, 0xC0, 0x21, 0x43, 0x02, 0x72, 0x8A, 0x8E, 0x90, 0x00, 0x42, 0xE4, 0x94, 0x8C, 0x86, 0x00, 0x3E, 0x40, 0x00, 0x21, 0x40, 0x02, 0x1C, 0x43, 0x04, 0xF4, 0x1C, 0x04,
+    0xC0, 0x3A, 0x43, 0x00, 0x81, 0x60, 0x1E, 0x94, 0x00, 0xC0, 0x08, 0x45, 0x01, 0x26, 0x27, 0xE4, 0x24, 0x20, 0x18, 0x40, 0x11, 0xC0, 0x20, 0x42, 0x70, 0x94, 0x93, 0x83, 0x00, 0xC0, 0x18, 0x98,
+    0x00, 0x22, 0x43, 0x04, 0xF4, 0x1C, 0x04, 0xC0, 0x3A, 0x44, 0xC0, 0xB1, 0x8C, 0xC0, 0x00, 0xC0, 0x3D, 0x40, 0x11, 0x22, 0x92, 0x00, 0xC0, 0x18, 0x44, 0x00, 0x74, 0x93, 0x91, 0xF0, 0x0F, 0x42,
+    0x20, 0xFC, 0xE0, 0xC0, 0x1F, 0x83, 0x00, 0x03, 0x44, 0x00, 0xC3, 0x84, 0xC4, 0x07, 0xC0, 0x22, 0x44, 0x00, 0x91, 0x6D, 0xC7, 0x00, 0x09, 0x40, 0xE0, 0x01, 0x45, 0xE0, 0x00, 0x50, 0xFF, 0x21,
+    0x20, 0xC0, 0x27, 0x45, 0x00, 0xE3, 0x00, 0x00, 0xE7, 0x04, 0x0C, 0x49, 0x00, 0x82, 0x01, 0x1F, 0x81, 0x81, 0x20, 0x30, 0xEF, 0x40, 0x2C, 0x43, 0x0F, 0xE3, 0x24, 0x08, 0xC0, 0x05, 0x42, 0x9F,
+    0x86, 0x89, 0x01, 0x43, 0x18, 0x06, 0x03, 0x1C, 0x0A, 0x41, 0x47, 0x40, 0x1F, 0x44, 0x0C, 0x0B, 0x08, 0x0E, 0x10, 0xC0, 0x03, 0x44, 0x12, 0x10, 0x10, 0x1F, 0x10, 0x0E, 0x43, 0x00, 0x1A, 0x12,
+    0x24, 0xC6, 0x15, 0x42, 0xF9, 0x28, 0x38, 0x14, 0x89, 0x00, 0x21, 0x84, 0x00, 0x43, 0x12, 0x12, 0x92, 0x70, 0x1E, 0x43, 0x04, 0xF4, 0x34, 0x0C, 0x0F, 0x40, 0x01, 0x16, 0x41, 0xA0, 0xF8, 0x2A,
+    0x40, 0x1C, 0x03, 0x41, 0x02, 0x01, 0x00, 0x8F, 0x00, 0x0E, 0x43, 0x96, 0x91, 0x90, 0x70, 0xC0, 0x1D, 0x82, 0x48, 0x03, 0x44, 0x18, 0x07, 0xC4, 0x3C, 0x04, 0x22, 0x43, 0x1C, 0x83, 0x72, 0x0E,
+    0x14, 0x43, 0x09, 0x89, 0x79, 0x0F, 0x36, 0x84, 0x00, 0x40, 0x21, 0x11, 0x42, 0xFF, 0x08, 0x10, 0x82, 0x00, 0x0D, 0x43, 0xC1, 0x31, 0x1F, 0xE2, 0x14, 0x40, 0x01, 0xC0, 0x12, 0x40, 0xB0, 0x11,
+    0x43, 0x1A, 0x84, 0x40, 0x38, 0xC0, 0x05, 0x43, 0x1A, 0x84, 0x40, 0x38, 0xC0, 0x3B, 0x40, 0x01, 0xC1, 0x2F, 0x43, 0xF7, 0x04, 0x04, 0xF0, 0xC0, 0x28, 0x43, 0xD1, 0x8D, 0x87, 0xC0, 0x05, 0x43,
+    0x40, 0x50, 0xFF, 0x40, 0x05, 0x41, 0xF8, 0x27, 0x0F, 0x44, 0x00, 0xEF, 0x74, 0x0F, 0xE0, 0xC0, 0x05, 0x40, 0x91, 0x01, 0x41, 0x80, 0x80, 0x09, 0x44, 0x4F, 0x83, 0x01, 0x8F, 0x00, 0x04, 0x44,
+    0x2C, 0x33, 0x3F, 0xE0, 0x50, 0x17, 0x43, 0x10, 0xC8, 0x86, 0x01, 0x13, 0x43, 0xC0, 0x50, 0x4F, 0xC0, 0x2D, 0x44, 0x1F, 0x06, 0x09, 0x10, 0x10, 0x09, 0x42, 0x82, 0x9F, 0xA7, 0x23, 0x42, 0x07,
+    0x00, 0x01, 0x02, 0x40, 0xF1, 0x10, 0x43, 0x0D, 0x12, 0x12, 0x1F, 0xC0, 0x23, 0x47, 0x21, 0x3F, 0x21, 0x00, 0x41, 0x31, 0xAF, 0xBF, 0x99, 0x00, 0x13, 0x42, 0x00, 0x00, 0x80, 0xC0, 0x0A, 0x44,
+    0x20, 0x82, 0x4F, 0x3F, 0x02, 0xC4, 0x1C, 0x44, 0x00, 0x1A, 0x85, 0x40, 0x38, 0xC0, 0x3A, 0x42, 0x00, 0x25, 0x24, 0x11, 0x44, 0x91, 0x7E, 0xC8, 0x49, 0x40, 0xC0, 0x04, 0x44, 0x26, 0xA1, 0xFC,
+    0x20, 0x20, 0x2F, 0x43, 0x00, 0xF0, 0x10, 0xF7, 0x86, 0x00, 0x0D, 0x89, 0x00, 0xC2, 0x04, 0x44, 0x03, 0xE2, 0x1A, 0x06, 0x02, 0x02, 0x43, 0xC8, 0x28, 0xFE, 0x08, 0x0B, 0x98, 0x00, 0x09, 0x84,
+    0x00, 0x0E, 0x83, 0x00, 0x0E, 0x44, 0x04, 0x84, 0x64, 0x1C, 0x00, 0x21, 0x41, 0x01, 0x01, 0x0C, 0x40, 0xF8, 0x22, 0x40, 0xF4, 0x12, 0x41, 0xFC, 0x90, 0x01, 0x43, 0x38, 0x1C, 0x81, 0x78, 0x09,
+    0x41, 0x39, 0x1C, 0xC0, 0x2E, 0x44, 0xF0, 0x14, 0x1E, 0x11, 0xF0, 0x21, 0x40, 0x40, 0x92, 0x00, 0x3A, 0x44, 0x10, 0x13, 0xD2, 0xD4, 0x30, 0x27, 0x47, 0xC0, 0xBC, 0xE3, 0x20, 0x00, 0x80, 0xF0,
+    0x40, 0xC0, 0x0B, 0x41, 0x18, 0x07, 0x0D, 0x41, 0xF8, 0xCF, 0x85, 0x00, 0x13, 0x42, 0xF1, 0x7D, 0x07, 0xC0, 0x1E, 0x48, 0x10, 0x2C, 0x2B, 0x2F, 0xE0, 0x40, 0x40, 0xC0, 0x00, 0x0F, 0x84, 0x00,
+    0xC0, 0x1D, 0x42, 0x4E, 0x51, 0x51, 0x01, 0x42, 0xA1, 0x91, 0x8F, 0x0A, 0x42, 0x58, 0x46, 0x43, 0x06, 0x82, 0x80, 0x40, 0x00, 0xC0, 0x1E, 0x47, 0x02, 0x42, 0x32, 0x0E, 0x00, 0x3F, 0x10, 0x3F,
+    0x0A, 0x43, 0x02, 0x42, 0x32, 0x0E, 0xC1, 0x2B, 0x44, 0x00, 0x7C, 0x12, 0x1E, 0x70, 0xC0, 0x18, 0x42, 0x0C, 0x06, 0xFE, 0xC2, 0x00, 0x44, 0x00, 0x00, 0x88, 0x70, 0x7F, 0xC0, 0x3A, 0x42, 0x00,
+    0x82, 0x05, 0x29, 0x8A, 0x00, 0x26, 0x44, 0xD0, 0x12, 0xFF, 0xD0, 0x10, 0xC0, 0x08, 0x42, 0x00, 0xC0, 0x20, 0x10, 0x44, 0x40, 0x50, 0xF3, 0x50, 0x50, 0x18, 0x44, 0x01, 0x00, 0x07, 0x03, 0x02,
+    0x8D, 0x00, 0x43, 0x01, 0x40, 0x47, 0xC0, 0xC0, 0x26, 0x44, 0x24, 0x1F, 0xF2, 0x12, 0x10, 0x21, 0x44, 0x00, 0x82, 0x42, 0x32, 0x0E, 0xC0, 0x15, 0x40, 0x01, 0x23, 0x44, 0x84, 0x84, 0xFC, 0x84,
+    0x84, 0x04, 0x44, 0x00, 0xDC, 0x24, 0x24, 0xFC, 0x27, 0x42, 0x38, 0x90, 0x78, 0x37, 0x84, 0x00, 0x43, 0x1D, 0x00, 0x80, 0x70, 0x05, 0x83, 0x08, 0x06, 0x42, 0x1D, 0x81, 0x79, 0x27, 0x41, 0x02,
+    0x01, 0x38, 0x41, 0x00, 0xF8, 0x01, 0x43, 0xC0, 0x42, 0x71, 0xC0, 0xC3, 0x11, 0x42, 0x8F, 0xF4, 0x03, 0xC0, 0x3C, 0x41, 0x83, 0x43, 0x0B, 0x41, 0x81, 0xFF, 0x01, 0x43, 0x00, 0xF0, 0x8F, 0x80,
+    0xC0, 0x15, 0x41, 0xC6, 0x49, 0x1E, 0x48, 0x80, 0xB0, 0x8F, 0x00, 0x00, 0x41, 0x5F, 0x54, 0x13, 0xC0, 0x14, 0x44, 0x18, 0x17, 0x10, 0x1C, 0x20, 0x35, 0x42, 0xB1, 0xAF, 0x3F, 0x0F, 0x83, 0x02,
+    0x1B, 0x8C, 0x00, 0x26, 0x42, 0x7F, 0x21, 0x7F, 0x15, 0x42, 0x34, 0x24, 0x49, 0x99, 0x00, 0x43, 0x37, 0x49, 0x49, 0x7F, 0x0F, 0x8E, 0x00, 0xC1, 0x20, 0x42, 0x0C, 0x06, 0xFE, 0x91, 0x00, 0xC0,
+    0x2C, 0x40, 0x84, 0xC0, 0x2F, 0x40, 0xF1, 0x82, 0x50, 0x08, 0x43, 0x80, 0x61, 0x18, 0x80, 0x90, 0x00, 0x21, 0x84, 0x00, 0x36, 0x40, 0x03, 0x82, 0x02, 0x08, 0x42, 0x01, 0x71, 0x91, 0x33, 0x42,
+    0x50, 0x50, 0xF0, 0x3A, 0x89, 0x00, 0x11, 0x43, 0x38, 0x08, 0x8E, 0x78, 0x33, 0x44, 0x02, 0xE2, 0x1A, 0x06, 0x02, 0xC0, 0x03, 0x40, 0x01, 0xC1, 0x03, 0x98, 0x00, 0xC0, 0x0D, 0x43, 0x10, 0x12,
+    0xFF, 0xF0, 0x15, 0x41, 0x90, 0xF0, 0x14, 0x44, 0x08, 0x09, 0xF8, 0x08, 0x08, 0x06, 0x82, 0x00, 0xC0, 0x43, 0x04, 0x03, 0x02, 0x03, 0x2C, 0x84, 0x01, 0x05, 0x44, 0x40, 0xF8, 0x20, 0x20, 0xE1,
+    0x3A, 0x92, 0x00, 0xC0, 0x18, 0x42, 0x11, 0x0C, 0xF3, 0x8B, 0x00, 0x05, 0x42, 0xE0, 0xA0, 0xA0, 0xC0, 0x1D, 0x84, 0x00, 0x04, 0x42, 0x0C, 0xE3, 0x80, 0xC0, 0x31, 0x40, 0x01, 0x82, 0x80, 0x40,
+    0x40, 0x03, 0x40, 0x40, 0x10, 0x40, 0x80, 0xC0, 0x03, 0x40, 0x42, 0x23, 0x43, 0x02, 0x02, 0x62, 0x1F, 0x82, 0x02, 0x0D, 0x44, 0x0E, 0x01, 0x03, 0x1C, 0x51, 0xC0, 0x42, 0x84, 0x47, 0x3C, 0x28,
+    0x43, 0x66, 0x1C, 0x3C, 0x42, 0xC3, 0x0E, 0x40, 0xFF, 0x82, 0x84, 0x99, 0x00, 0xC0, 0x04, 0x41, 0x0E, 0x80, 0x1B, 0x40, 0x80, 0xC0, 0x1F, 0x43, 0x00, 0xF1, 0x50, 0x70, 0x10, 0x43, 0x11, 0x7C,
+    0xFC, 0x11, 0x84, 0x00, 0xC0, 0x21, 0x43, 0x00, 0x73, 0x90, 0x90, 0x06, 0x89, 0x00, 0x42, 0xF4, 0x12, 0xF1, 0x22, 0x44, 0x48, 0x09, 0xE8, 0x6F, 0x1B, 0x30, 0x42, 0x94, 0x94, 0xFC, 0xC0, 0x01,
+    0x44, 0xC4, 0x34, 0xFF, 0x04, 0x04, 0xC0, 0x2A, 0x44, 0x80, 0x84, 0xFC, 0x85, 0x80, 0x0B, 0x40, 0x15, 0xC0, 0x15, 0x43, 0x83, 0x63, 0x3E, 0xC4, 0x32, 0x42, 0x51, 0x50, 0xF0, 0x86, 0x00, 0x04,
+    0x84, 0x00, 0x34, 0x40, 0x01, 0x01, 0x82, 0x01, 0x31, 0x41, 0x72, 0xC3, 0x0C, 0x42, 0x48, 0xF8, 0x00, 0x2C, 0x43, 0xE3, 0x12, 0x13, 0xE0, 0x36, 0x83, 0x00, 0xC0, 0x00, 0x43, 0x03, 0x04, 0x04,
+    0x03, 0x36, 0x82, 0x90, 0x40, 0x80, 0x0A, 0x40, 0xF8, 0x01, 0x40, 0xF0, 0x09, 0x43, 0x00, 0x80, 0x70, 0x0F, 0x0A, 0x43, 0x51, 0x4C, 0xC3, 0x40, 0x22, 0x43, 0xC7, 0x28, 0x28, 0xC7, 0x85, 0x00,
+    0x31, 0x42, 0x10, 0x08, 0x07, 0x0A, 0x43, 0x06, 0x25, 0x24, 0x2E, 0x0A, 0x42, 0x10, 0xEF, 0x81, 0x23, 0x43, 0xC7, 0x48, 0x48, 0xC7, 0x05, 0x42, 0xEF, 0xE3, 0x04, 0xC0, 0x15, 0x84, 0x00, 0x21,
+    0x41, 0x23, 0x1F, 0xA0, 0x00, 0x04, 0x41, 0x98, 0x97, 0x14, 0x40, 0x8E, 0x17, 0x85, 0x00, 0xC0, 0x09, 0x42, 0x34, 0x24, 0x49, 0x10, 0x47, 0x05, 0xC5, 0x3F, 0x04, 0x64, 0x94, 0xFF, 0x04, 0x31,
+    0x42, 0x4A, 0x4A, 0x7E, 0xC1, 0x1A, 0x8E, 0x00, 0x3A, 0x43, 0x08, 0xFF, 0xA4, 0x9C, 0xC2, 0x43, 0x00, 0x09, 0x08, 0xF8, 0x90, 0x00, 0x0D, 0x42, 0x39, 0x48, 0x98, 0xC0, 0x19, 0x44, 0x10, 0x21,
+    0xA1, 0xFD, 0x21, 0x1C, 0x43, 0x02, 0x72, 0x92, 0x93, 0xC0, 0x04, 0x83, 0x08, 0x1D, 0x43, 0x6E, 0x92, 0x92, 0xFE, 0x8A, 0x00, 0xC0, 0x0E, 0x43, 0x09, 0x09, 0xC9, 0x38, 0x83, 0x00, 0x1B, 0x40,
+    0x84, 0x0B, 0x42, 0xC0, 0x31, 0x0F, 0xC0, 0x0C, 0x40, 0x91, 0xC1, 0x15, 0x97, 0x00, 0x22, 0x4A, 0x00, 0x24, 0xE2, 0x21, 0x00, 0x00, 0x4C, 0x4B, 0xC8, 0x48, 0x40, 0x02, 0x44, 0x20, 0x24, 0xE2,
+    0x21, 0x20, 0x31, 0x40, 0xF8, 0x01, 0x40, 0xC0, 0x22, 0x44, 0x01, 0x28, 0x24, 0x23, 0x20, 0x0F, 0x47, 0x04, 0xF7, 0x04, 0x00, 0x00, 0x90, 0x98, 0x97, 0x05, 0x42, 0xF0, 0x07, 0x00, 0x1B, 0x42,
+    0xC4, 0xA4, 0x23, 0x36, 0x84, 0x00, 0x43, 0xC4, 0x84, 0xC4, 0x04, 0x35, 0x85, 0x00, 0x43, 0x07, 0x08, 0x08, 0x07, 0x09, 0x43, 0x07, 0x88, 0x68, 0x07, 0x29, 0x45, 0x80, 0x80, 0x00, 0x00, 0xB1,
+    0x4C, 0x01, 0x85, 0x00, 0x09, 0x43, 0x4C, 0x43, 0x43, 0xC0, 0x1D, 0x41, 0x90, 0x88, 0x03, 0x42, 0x80, 0x40, 0x40, 0x0D, 0x44, 0x04, 0xC3, 0x5F, 0x40, 0xC0, 0x2D, 0x43, 0x11, 0xC8, 0x44, 0x03,
+    0x8A, 0x00, 0x04, 0x43, 0x50, 0x48, 0x46, 0x01, 0x04, 0x84, 0x00, 0x12, 0x45, 0x10, 0x10, 0x9F, 0x10, 0x10, 0x00, 0x12, 0x43, 0x4D, 0x52, 0x52, 0xDF, 0xC0, 0x0A, 0x44, 0x00, 0x00, 0xC0, 0x00,
+    0x00, 0x2B, 0x43, 0x31, 0x0A, 0x0F, 0x10, 0xC2, 0x0F, 0x48, 0xF8, 0x04, 0x02, 0x1C, 0x61, 0x81, 0x7D, 0x0D, 0x03, 0x09, 0x43, 0x00, 0xFC, 0x14, 0x1C, 0xC0, 0x2D, 0x40, 0x01, 0xC3, 0x2E, 0x43,
+    0xFC, 0x20, 0x42, 0x01, 0x90, 0x00, 0x22, 0x42, 0x23, 0xA2, 0x62, 0xC0, 0x00, 0x83, 0x00, 0x44, 0x0B, 0x08, 0xE8, 0x68, 0x18, 0x8E, 0x00, 0x0D, 0x44, 0x1E, 0x02, 0x03, 0xC2, 0x3E, 0xC0, 0x3C,
+    0x40, 0xE3, 0x1F, 0x43, 0x12, 0x32, 0xF2, 0x0E, 0x05, 0x89, 0x00, 0x12, 0x42, 0xFD, 0x14, 0x1C, 0xC1, 0x0A, 0x43, 0x70, 0x10, 0x1C, 0xF0, 0xC0, 0x01, 0x43, 0x25, 0x24, 0x24, 0xE0, 0x36, 0x41,
+    0x02, 0x01, 0x34, 0x42, 0x24, 0xE3, 0x20, 0x84, 0x00, 0x05, 0x42, 0x70, 0x94, 0x93, 0xC0, 0x06, 0x42, 0xF1, 0x11, 0xF1, 0x24, 0x42, 0x94, 0x97, 0x94, 0xC0, 0x14, 0x42, 0x07, 0x02, 0x07, 0x32,
+    0x43, 0x11, 0x1C, 0xF3, 0x20, 0x0A, 0x43, 0x91, 0x9D, 0x97, 0x80, 0x05, 0x43, 0x17, 0x18, 0xF8, 0x27, 0x36, 0x84, 0x00, 0x26, 0x43, 0x0C, 0xE3, 0x81, 0x8E, 0x0A, 0x43, 0x80, 0x90, 0x8C, 0x03,
+    0x05, 0x43, 0x0C, 0x03, 0x01, 0x0E, 0x36, 0x83, 0x40, 0xC5, 0x44, 0x68, 0x0A, 0xFE, 0x8A, 0x8A, 0xC0, 0x09, 0x43, 0x04, 0x9F, 0x7F, 0x04, 0x05, 0x43, 0x82, 0x42, 0x32, 0x0E, 0xC0, 0x31, 0x40,
+    0x01, 0x1B, 0x8F, 0x00, 0x26, 0x84, 0x00, 0xC5, 0x43, 0x31, 0xE0, 0xE0, 0x10, 0x1D, 0x43, 0xF1, 0x50, 0x50, 0x51, 0xC0, 0x00, 0x85, 0x00, 0x12, 0x43, 0x73, 0x90, 0x91, 0xF2, 0x1D, 0x40, 0x03,
+    0x82, 0x02, 0x0A, 0x97, 0x00, 0x1D, 0x43, 0x00, 0xC0, 0xB8, 0xE0, 0x13, 0x43, 0x20, 0x23, 0xA4, 0xE4, 0x2D, 0x42, 0xD0, 0x20, 0x00, 0xC0, 0x0B, 0x42, 0x17, 0x18, 0xF8, 0x23, 0x43, 0x47, 0xF8,
+    0x28, 0x27, 0x38, 0x41, 0xC8, 0x87, 0x2E, 0x83, 0x00, 0x43, 0x4C, 0x43, 0x41, 0xCE, 0x08, 0x45, 0x00, 0xC2, 0x41, 0x5F, 0xC1, 0x01, 0x27, 0x84, 0x00, 0x09, 0x44, 0x07, 0x00, 0x01, 0x0E, 0x08,
+    0x09, 0x42, 0xE1, 0xD1, 0x0F, 0x1E, 0x41, 0x00, 0xE0, 0x82, 0x00, 0x43, 0x10, 0x08, 0x06, 0x01, 0x36, 0x84, 0x00, 0x18, 0x41, 0x47, 0x3F, 0x86, 0x00, 0xC0, 0x2E, 0x40, 0x0C, 0x0A, 0x84, 0x00,
+    0x0E, 0x84, 0x00, 0xC0, 0x18, 0x83, 0x08, 0x49, 0x00, 0x09, 0x09, 0xF9, 0x09, 0x08, 0x82, 0x42, 0x32, 0x0E, 0xC0, 0x37, 0x40, 0x01, 0x10, 0x43, 0x8D, 0x42, 0x20, 0x1C, 0xC1, 0x0A, 0x42, 0x80,
+    0x60, 0x1E, 0xC0, 0x14, 0x43, 0x80, 0x61, 0x18, 0x80, 0x8A, 0x00, 0x40, 0xF1, 0x82, 0x50, 0x14, 0x40, 0x01, 0xC0, 0x02, 0x40, 0x00, 0x12, 0x43, 0x01, 0x21, 0xA1, 0x63, 0x8A, 0x00, 0x43, 0x73,
+    0x92, 0x92, 0xF2, 0xC0, 0x18, 0x40, 0xE0, 0xC0, 0x0D, 0x43, 0xFC, 0x14, 0x1C, 0x00, 0x04, 0x44, 0x00, 0x04, 0xF4, 0x1C, 0x04, 0x0A, 0x44, 0x04, 0x84, 0x7F, 0x04, 0x04, 0x12, 0x40, 0x84, 0xC0,
+    0x0C, 0x43, 0x00, 0x94, 0x94, 0xFC, 0x16, 0x40, 0xFD, 0xC0, 0x06, 0x44, 0x08, 0x08, 0xF8, 0x08, 0x08, 0x0E, 0x43, 0x12, 0x12, 0x13, 0xFE, 0x05, 0x41, 0x82, 0x62, 0xC0, 0x21, 0x40, 0x01, 0x10,
+    0x43, 0x11, 0x11, 0xFF, 0xF1, 0x1D, 0x43, 0x24, 0x26, 0x25, 0xFC, 0x24, 0x44, 0x51, 0x51, 0xF1, 0x49, 0x40, 0xC0, 0x11, 0x82, 0x02, 0x40, 0x03, 0x24, 0x42, 0x10, 0xDC, 0xD3, 0x18, 0x43, 0x00,
+    0x03, 0x04, 0xF4, 0xC0, 0x3C, 0x43, 0x0C, 0x03, 0xC0, 0x30, 0x0A, 0x42, 0x11, 0x8D, 0x67, 0x86, 0x00, 0xC0, 0x26, 0x43, 0x02, 0xE1, 0x9F, 0x80, 0x09, 0x43, 0x04, 0x83, 0x9F, 0x80, 0x86, 0x00,
+    0x0D, 0x43, 0x02, 0xE1, 0x3F, 0x01, 0xC0, 0x06, 0x41, 0x21, 0x91, 0x32, 0x44, 0x4C, 0x4B, 0x48, 0xCE, 0x10, 0xC0, 0x04, 0x43, 0x32, 0x4A, 0x7F, 0x02, 0x23, 0x42, 0x21, 0x3F, 0x21, 0x37, 0x84,
+    0x00, 0xC2, 0x3E, 0x44, 0x46, 0x22, 0xFB, 0x16, 0x60, 0x1D, 0x40, 0xFC, 0x82, 0x94, 0x27, 0x44, 0x39, 0x06, 0x0C, 0x70, 0x40, 0x2D, 0x40, 0x01, 0xC0, 0x28, 0x8F, 0x00, 0x3E, 0x44, 0x00, 0x01,
+    0xFC, 0x00, 0xC0, 0x2D, 0x41, 0xE0, 0x18, 0x8B, 0x00, 0x35, 0x43, 0xE4, 0xDE, 0xF1, 0x10, 0x04, 0x43, 0x00, 0x26, 0xE3, 0x21, 0x98, 0x00, 0x18, 0x83, 0x00, 0x40, 0x04, 0x92, 0x00, 0xC3, 0x08,
+    0x89, 0x00, 0x13, 0x44, 0x12, 0x12, 0xF2, 0x12, 0x10, 0xC0, 0x1F, 0x40, 0x80, 0x1A, 0x41, 0x02, 0x01, 0xC2, 0x0A, 0x44, 0x10, 0x10, 0xD7, 0xD0, 0x30, 0x19, 0x44, 0x43, 0x44, 0xFC, 0x43, 0x40,
+    0x12, 0x98, 0x00, 0x43, 0x97, 0x92, 0x97, 0xF0, 0x2C, 0x42, 0x58, 0xFF, 0x20, 0x1B, 0x43, 0x10, 0xFF, 0x2F, 0x08, 0x12, 0x43, 0xC0, 0x00, 0x80, 0x40, 0x14, 0x42, 0x10, 0x08, 0x07, 0x32, 0x42,
+    0x82, 0x81, 0x9F, 0x8A, 0x00, 0xC0, 0x31, 0x42, 0x5F, 0x42, 0x43, 0x8A, 0x00, 0x06, 0x83, 0x00, 0xC0, 0x39, 0x42, 0x10, 0x80, 0x80, 0x82, 0x00, 0xC1, 0x43, 0x66, 0x1C, 0x3C, 0x42, 0x36, 0x83,
+    0x00, 0x40, 0x08, 0x1C, 0x84, 0x00, 0x44, 0xC1, 0x31, 0x1F, 0xE2, 0x01, 0xC3, 0x43, 0x1C, 0x0E, 0xC0, 0x3C, 0xC0, 0x3B, 0x41, 0x02, 0x01, 0x11, 0x43, 0x71, 0x6E, 0xF8, 0x08, 0xC0, 0x3B, 0x40,
+    0x24, 0x03, 0x89, 0x00, 0x22, 0x43, 0x0F, 0x80, 0x70, 0x0F, 0x18, 0x43, 0xFF, 0x40, 0x60, 0x18, 0x00, 0x84, 0x00, 0x2C, 0x40, 0x20, 0x20, 0x84, 0x00, 0x04, 0x40, 0x13, 0xC2, 0x3D, 0x44, 0x10,
+    0x10, 0xF1, 0x10, 0x10, 0xC0, 0x3C, 0x40, 0x03, 0x1A, 0x42, 0x23, 0xA2, 0x62, 0x15, 0x43, 0x72, 0x3A, 0x03, 0xF0, 0x0A, 0x44, 0x49, 0x49, 0xC9, 0x49, 0x40, 0x18, 0x84, 0x00, 0x34, 0x42, 0x07,
+    0x04, 0x04, 0x15, 0x42, 0x08, 0x04, 0x03, 0x0B, 0x41, 0x90, 0x98, 0x1B, 0x42, 0xC0, 0x80, 0x80, 0xC1, 0x09, 0x40, 0x20, 0x22, 0x44, 0x8C, 0x83, 0xF1, 0x8E, 0x80, 0xC0, 0x03, 0x44, 0x80, 0x87,
+    0x80, 0x81, 0x8E, 0x0A, 0x44, 0x01, 0xA1, 0x1F, 0x01, 0x01, 0x16, 0x43, 0x90, 0x90, 0xFF, 0x90, 0x06, 0x42, 0x18, 0x26, 0x3F, 0x8A, 0x00, 0x3A, 0x44, 0x10, 0x10, 0x1F, 0x10, 0x10, 0x26, 0x45,
+    0x10, 0x08, 0x7E, 0x05, 0x18, 0x00, 0x15, 0x40, 0x90, 0xC0, 0x2F, 0x40, 0xBC, 0x0A, 0x44, 0x05, 0xC5, 0x3F, 0x04, 0x04, 0xC0, 0x06, 0x40, 0xC2, 0x15, 0x84, 0x00, 0x09, 0x44, 0x74, 0x04, 0xFF,
+    0xF4, 0x84, 0x35, 0x83, 0x00, 0x40, 0x42, 0x12, 0x49, 0x42, 0x42, 0x7F, 0x42, 0x42, 0x1E, 0x02, 0x03, 0xC2, 0x3E, 0x24, 0x40, 0x01, 0x39, 0x46, 0x7E, 0x00, 0x3C, 0x04, 0x07, 0x84, 0x7C, 0x15,
+    0x40, 0x01, 0x32, 0x42, 0x08, 0xF8, 0x08, 0x2F, 0x41, 0x02, 0x01, 0x32, 0x43, 0xE1, 0x90, 0xF0, 0x80, 0x12, 0x84, 0x01, 0x19, 0x8E, 0x00, 0x3A, 0x40, 0x03, 0x01, 0x40, 0x03, 0x30, 0x42, 0x00,
+    0x40, 0x40, 0x0B, 0x40, 0x00, 0x1C, 0x93, 0x00, 0xC0, 0x3A, 0x84, 0x00, 0x13, 0x44, 0xF8, 0x04, 0x02, 0x1C, 0x60, 0x03, 0x43, 0x12, 0x32, 0xF2, 0x0E, 0x2C, 0x40, 0xFC, 0xC0, 0x05, 0x40, 0x12,
+    0xC2, 0x3D, 0x43, 0xC3, 0x32, 0x63, 0x80, 0xC0, 0x14, 0x43, 0x24, 0x27, 0x24, 0xE0, 0x83, 0x00, 0x1E, 0x44, 0xC1, 0x00, 0x80, 0x43, 0x42, 0xC0, 0x13, 0x42, 0x88, 0x64, 0x03, 0x23, 0x43, 0x1F,
+    0x13, 0xF4, 0x28, 0x08, 0x44, 0xC0, 0x67, 0xE8, 0x08, 0x07, 0x05, 0x98, 0x00, 0x18, 0x43, 0x50, 0x88, 0x07, 0x80, 0x1A, 0x42, 0xFF, 0x80, 0x80, 0x21, 0x42, 0x00, 0xEF, 0x20, 0x86, 0x00, 0x41,
+    0xE0, 0xE0, 0xA5, 0x00, 0x09, 0x44, 0x82, 0x9F, 0xA7, 0x81, 0x00, 0x17, 0x42, 0x58, 0x66, 0x7F, 0xC0, 0x2C, 0x40, 0x0E, 0x22, 0x84, 0x00, 0xC0, 0x13, 0x83, 0x04, 0x22, 0x84, 0x00, 0xC1, 0x3E,
+    0x45, 0x00, 0x02, 0xE2, 0x1A, 0x06, 0x02, 0x17, 0x84, 0x00, 0x1D, 0x44, 0xF8, 0x04, 0x03, 0x1C, 0x60, 0x35, 0x83, 0x00, 0x21, 0x44, 0x10, 0x14, 0xFC, 0x14, 0x14, 0xC0, 0x14, 0x40, 0x08, 0x11,
+    0x43, 0x00, 0x39, 0x48, 0x98, 0x10, 0x82, 0x01, 0x00, 0x42, 0xFA, 0x09, 0xF8, 0xC0, 0x23, 0x42, 0x02, 0x22, 0xA2, 0x15, 0x42, 0x03, 0x01, 0x03, 0x09, 0x43, 0x1C, 0x62, 0xA2, 0x9C, 0x35, 0x43,
+    0x38, 0x08, 0x8E, 0x78, 0x85, 0x00, 0x09, 0x83, 0x42, 0x28, 0x89, 0x00, 0x08, 0x98, 0x00, 0x13, 0x40, 0xF9, 0x0C, 0x84, 0x00, 0x40, 0xFC, 0x2D, 0x40, 0x40, 0x16, 0x82, 0x84, 0x30, 0x40, 0x08,
+    0x3A, 0x42, 0x10, 0xF0, 0x10, 0x86, 0x00, 0x21, 0x88, 0x00, 0x12, 0x44, 0x08, 0x88, 0xEE, 0x59, 0x80, 0x32, 0x43, 0x52, 0x53, 0xF2, 0x48, 0x1E, 0x42, 0xFB, 0x00, 0x80, 0x05, 0x42, 0x50, 0x50,
+    0xF0, 0x18, 0x44, 0x01, 0x00, 0x07, 0x00, 0x01, 0xC0, 0x14, 0x43, 0x0C, 0x07, 0x02, 0x01, 0x31, 0x41, 0x88, 0x64, 0xC0, 0x3C, 0x43, 0x06, 0x05, 0x04, 0x0E, 0x0A, 0x41, 0xF0, 0x90, 0xC0, 0x3D,
+    0x42, 0x0F, 0x00, 0x01, 0xC2, 0x0C, 0x43, 0x22, 0x22, 0x3E, 0x20, 0xC3, 0x08, 0x43, 0x60, 0x58, 0x46, 0xE0, 0x86, 0x00, 0xC0, 0x35, 0x44, 0x04, 0x84, 0x7F, 0x04, 0x04, 0xC0, 0x2C, 0x42, 0x1C,
+    0x24, 0xCC, 0x0B, 0x40, 0xF9, 0x2A, 0x84, 0x00, 0x43, 0x08, 0x0A, 0x09, 0x08, 0x3A, 0x83, 0x01, 0x09, 0x43, 0x11, 0x11, 0xFF, 0xF1, 0x29, 0x44, 0x20, 0xA0, 0xFC, 0x20, 0x20, 0x83, 0x01, 0xC0,
+    0x08, 0x43, 0x04, 0x03, 0x02, 0x03, 0x1A, 0x8E, 0x00, 0x30, 0x42, 0x1C, 0xC8, 0x3C, 0x8F, 0x00, 0xC0, 0x2C, 0x42, 0x85, 0xFC, 0x84, 0x90, 0x00, 0xC0, 0x21, 0x88, 0x00, 0xC0, 0x36, 0x40, 0x38,
+    0x03, 0x40, 0x30, 0x38, 0x44, 0x00, 0x12, 0xD1, 0x70, 0x10, 0xC0, 0x3A, 0x43, 0x00, 0x74, 0x3B, 0x00, 0x0B, 0x43, 0x21, 0xF9, 0xF9, 0x21, 0x89, 0x00, 0xC0, 0x09, 0x41, 0x87, 0x64, 0x25, 0x42,
+    0x98, 0x94, 0x93, 0x1A, 0x84, 0x00, 0x33, 0x4A, 0x06, 0x05, 0x04, 0x0E, 0x00, 0x00, 0x47, 0x48, 0xF8, 0x47, 0x40, 0x3B, 0x43, 0x40, 0x80, 0x00, 0x80, 0x2D, 0x42, 0x43, 0x41, 0x8E, 0x89, 0x00,
+    0x44, 0xE7, 0xE0, 0x1F, 0x0F, 0x08, 0x04, 0x97, 0x00, 0xC0, 0x0F, 0x43, 0x0F, 0x16, 0x11, 0x0F, 0x09, 0x43, 0x63, 0x5F, 0x40, 0xC0, 0xAD, 0x00, 0x09, 0x40, 0x90, 0xC0, 0x3E, 0x43, 0x46, 0x21,
+    0x10, 0x0E, 0xC1, 0x00, 0x43, 0xFE, 0x42, 0xFE, 0x00, 0x27, 0x84, 0x00, 0xC0, 0x0E, 0x43, 0x04, 0xF4, 0x1C, 0x04, 0x1D, 0x84, 0x00, 0xC0, 0x1D, 0x48, 0x14, 0x14, 0xFC, 0x12, 0x10, 0x38, 0xB7,
+    0xFC, 0x04, 0x83, 0x00, 0xC0, 0x33, 0x40, 0x03, 0x02, 0x41, 0x02, 0x01, 0x01, 0x40, 0xF0, 0x21, 0x44, 0xF1, 0xC1, 0x21, 0x10, 0x10, 0x35, 0x84, 0x00, 0x26, 0x40, 0xFB, 0x01, 0x40, 0xC0, 0x0A,
+    0x43, 0x0B, 0x88, 0xF8, 0x13, 0x05, 0x44, 0x03, 0x00, 0x01, 0x02, 0x02, 0xC0, 0x2B, 0x44, 0xF8, 0x04, 0x02, 0x1C, 0x60, 0x04, 0x42, 0x69, 0x49, 0x92, 0x85, 0x00, 0x40, 0xC0, 0x09, 0x43, 0x09,
+    0x89, 0x79, 0x0F, 0xC0, 0x44, 0x38, 0x06, 0x0C, 0x70, 0x40, 0x23, 0x40, 0x30, 0x0C, 0x84, 0x00, 0x40, 0x01, 0xC0, 0x07, 0x84, 0x00, 0x26, 0x40, 0xE8, 0x04, 0x40, 0x50, 0xC0, 0x0B, 0x44, 0x00,
+    0x00, 0xC0, 0x3C, 0x00, 0xC1, 0x0F, 0x43, 0x6C, 0x13, 0x00, 0xE0, 0xC0, 0x05, 0x44, 0x4C, 0x47, 0xFA, 0x41, 0x40, 0x0D, 0x45, 0x90, 0x91, 0x90, 0xF0, 0x03, 0x02, 0x1C, 0x42, 0x84, 0x62, 0x01,
+    0xC0, 0x06, 0x44, 0x07, 0x00, 0x1F, 0x0F, 0x08, 0x0D, 0x44, 0x08, 0x18, 0x18, 0xFF, 0x20, 0x83, 0x00, 0x18, 0x44, 0xE6, 0x25, 0x3C, 0x2E, 0xE0, 0xC0, 0x40, 0xE1, 0x01, 0x40, 0x9F, 0x8A, 0x00,
+    0x09, 0x44, 0x80, 0x8C, 0xF3, 0x81, 0x0E, 0x1C, 0x44, 0x01, 0x00, 0x10, 0x0C, 0x03, 0xC0, 0x40, 0x1F, 0x82, 0x50, 0x14, 0x43, 0x20, 0x18, 0x17, 0x1F, 0x8A, 0x00, 0xC2, 0x12, 0x82, 0x21, 0xC3,
+    0x01, 0x43, 0x40, 0x31, 0xF8, 0x06, 0x8B, 0x00, 0xC0, 0x31, 0x40, 0x0F, 0x2D, 0x44, 0x08, 0x08, 0xF8, 0x08, 0x08, 0x32, 0x43, 0xB9, 0x48, 0x48, 0xF8, 0x0E, 0x43, 0x30, 0xE1, 0xE1, 0x11, 0x32,
+    0x40, 0x41, 0xA5, 0x00, 0x42, 0x11, 0x11, 0xF1, 0x0A, 0x44, 0x00, 0x21, 0xA2, 0x62, 0x03, 0x0E, 0x43, 0x03, 0x00, 0x01, 0x02, 0x18, 0x44, 0x10, 0x13, 0xF0, 0x11, 0x12, 0x09, 0x43, 0xE3, 0x12,
+    0x13, 0xE0, 0x04, 0x45, 0x03, 0x20, 0xFC, 0x90, 0x90, 0x80, 0xC3, 0x18, 0x96, 0x00, 0xC0, 0x29, 0x42, 0x1C, 0x80, 0x78, 0x0E, 0x83, 0x00, 0xC0, 0x3B, 0x43, 0x70, 0x90, 0x90, 0xF0, 0x0A, 0x88,
+    0x00, 0x12, 0x43, 0x41, 0x40, 0xF7, 0x40, 0xC0, 0x20, 0x41, 0xB8, 0xE0, 0x18, 0x42, 0x06, 0x09, 0x0F, 0xC5, 0x1B, 0x83, 0x01, 0x31, 0x42, 0x82, 0xC2, 0xB2, 0x2D, 0xA7, 0x00, 0x26, 0x43, 0x04,
+    0x84, 0x64, 0x1C, 0xC3, 0x0E, 0x85, 0x00, 0xC2, 0x1C, 0x84, 0x00, 0xC0, 0x3A, 0x43, 0x70, 0x90, 0x90, 0xF0, 0xC0, 0x03, 0x89, 0x00, 0x2A, 0x43, 0x38, 0x08, 0x8E, 0x78, 0xC0, 0x07, 0x40, 0xF8,
+    0x25, 0x41, 0x1F, 0xFF, 0x06, 0x45, 0x38, 0x08, 0x8E, 0x78, 0x00, 0x01, 0x0D, 0x43, 0xC0, 0xB1, 0x8C, 0xC0, 0xC0, 0x1E, 0x40, 0x01, 0x08, 0x40, 0x1B, 0x0D, 0x86, 0x00, 0x40, 0x01, 0x19, 0x88,
+    0x00, 0x23, 0x82, 0x00, 0x2D, 0x42, 0x40, 0x70, 0xC0, 0x1E, 0x42, 0x20, 0xE0, 0x20, 0x28, 0x40, 0xF0, 0x21, 0x83, 0x41, 0xC0, 0x3B, 0x82, 0x90, 0x37, 0x43, 0x47, 0xF0, 0xFF, 0x4F, 0x17, 0x44,
+    0x46, 0x45, 0xC4, 0x4E, 0x40, 0xC0, 0x01, 0x84, 0x00, 0x17, 0x42, 0x10, 0x09, 0x07, 0x1A, 0x40, 0x0F, 0x16, 0x43, 0x40, 0x50, 0xCC, 0x23, 0x28, 0x83, 0x80, 0xC0, 0x0E, 0x44, 0x01, 0x31, 0x0F,
+    0x01, 0x01, 0xC1, 0x39, 0x43, 0x00, 0x72, 0x4A, 0x46, 0xC0, 0x23, 0x44, 0x80, 0x84, 0xFC, 0x84, 0x80, 0xC3, 0x00, 0x43, 0x41, 0x20, 0xF8, 0x06, 0x1D, 0x84, 0x00, 0xC0, 0x18, 0x42, 0xB8, 0x48,
+    0x4B, 0x01, 0x48, 0x20, 0xFF, 0x10, 0x78, 0x10, 0x0A, 0x09, 0x08, 0x08, 0x09, 0x43, 0x06, 0xC5, 0x7C, 0x88, 0x05, 0x40, 0x10, 0x01, 0x40, 0x10, 0x17, 0x44, 0x01, 0xF1, 0xC9, 0x29, 0xF1, 0xC0,
+    0x03, 0x40, 0x07, 0x01, 0x83, 0x01, 0x0A, 0x42, 0x00, 0x00, 0xC3, 0x21, 0x44, 0x00, 0xE1, 0x12, 0x12, 0xE1, 0xC2, 0x04, 0x88, 0x00, 0x17, 0x44, 0x00, 0x09, 0x89, 0x79, 0x0F, 0xC0, 0x3B, 0x40,
+    0x11, 0x0D, 0x42, 0xD3, 0x92, 0x24, 0x85, 0x00, 0xC0, 0x0E, 0x43, 0xE1, 0x90, 0xF0, 0x81, 0x14, 0x43, 0x02, 0xFD, 0x00, 0xC0, 0x0A, 0x42, 0x08, 0xF8, 0x09, 0x04, 0x41, 0xFC, 0x10, 0x2B, 0x85,
+    0x00, 0x1B, 0x43, 0x73, 0x90, 0x30, 0x03, 0x14, 0x42, 0x6E, 0x13, 0x01, 0x13, 0x41, 0x03, 0x02, 0x2B, 0x43, 0x00, 0x00, 0xF0, 0x00, 0x1C, 0x43, 0x04, 0x84, 0x64, 0x07, 0xC8, 0x06, 0x44, 0x06,
+    0x03, 0x7F, 0x00, 0x00, 0xC0, 0xA7, 0x00, 0x43, 0x7C, 0x82, 0x82, 0x7C, 0x1C, 0x44, 0x02, 0x72, 0x8A, 0x8E, 0x00, 0xC2, 0x28, 0x40, 0xF9, 0x82, 0x28, 0x27, 0x84, 0x00, 0xC0, 0x0E, 0x43, 0xB9,
+    0x49, 0x49, 0xF9, 0x27, 0x40, 0x70, 0x10, 0x44, 0x61, 0x1F, 0x11, 0xF1, 0x11, 0xC0, 0x0A, 0x83, 0x00, 0x44, 0x10, 0x13, 0xF0, 0x11, 0x12, 0x27, 0x44, 0x24, 0xA3, 0xFC, 0x20, 0x20, 0x0D, 0xA2,
+    0x00, 0x26, 0x43, 0x6E, 0x92, 0x92, 0xFE, 0x33, 0x40, 0xE2, 0xC0, 0x27, 0x46, 0x80, 0x85, 0xFC, 0x84, 0x80, 0x42, 0x42, 0xC0, 0x03, 0x89, 0x00, 0x17, 0x43, 0x00, 0x09, 0xF8, 0x08, 0x01, 0x43,
+    0x09, 0x3E, 0xFE, 0x08, 0x19, 0x43, 0xE0, 0x18, 0x31, 0xC0, 0x0A, 0x96, 0x00, 0x13, 0x43, 0x10, 0x10, 0xFE, 0xF0, 0x1D, 0x47, 0x01, 0x01, 0xFD, 0x01, 0xC1, 0x00, 0x02, 0x01, 0x15, 0x88, 0x00,
+    0x41, 0x01, 0x01, 0x09, 0x42, 0x20, 0xE0, 0x20, 0x01, 0x41, 0x20, 0xE0, 0x32, 0x83, 0x00, 0x2C, 0x40, 0x00, 0x83, 0x20, 0x27, 0x43, 0xEC, 0x27, 0x22, 0xE1, 0x8E, 0x00, 0x0A, 0x46, 0x44, 0x27,
+    0xC0, 0x00, 0xC0, 0x20, 0x20, 0x01, 0x43, 0x99, 0x9F, 0x90, 0x80, 0x0A, 0x43, 0x44, 0x42, 0xC1, 0x40, 0xC0, 0x05, 0x43, 0x46, 0xF9, 0xF9, 0x4F, 0x86, 0x00, 0x41, 0x80, 0x60, 0x0E, 0x45, 0x40,
+    0x4F, 0xC0, 0x40, 0x41, 0x06, 0x05, 0x42, 0x10, 0x0C, 0x03, 0x09, 0x43, 0xE0, 0x30, 0x3F, 0x21, 0xC0, 0x06, 0x43, 0x50, 0x89, 0x07, 0x80, 0xC0, 0x3B, 0x43, 0x02, 0x1F, 0x27, 0x01, 0x0F, 0x40,
+    0xD8, 0x01, 0x40, 0xC0, 0x1F, 0x40, 0xEF, 0x24, 0x42, 0x10, 0x9F, 0x90, 0x32, 0x43, 0x43, 0x20, 0x1C, 0x03, 0x1D, 0x44, 0x31, 0x4D, 0x7F, 0x01, 0x01, 0x09, 0x40, 0x3F, 0x82, 0x25, 0x14, 0x43,
+    0x82, 0x4F, 0x3F, 0x02, 0xC1, 0x12, 0x40, 0xFF, 0x82, 0x84, 0x27, 0x45, 0x00, 0x09, 0x09, 0xF9, 0x09, 0x08, 0x2C, 0x44, 0x04, 0x84, 0x7F, 0x04, 0x04, 0xC0, 0x09, 0x40, 0x85, 0xC0, 0x16, 0x43,
+    0x00, 0xFF, 0x80, 0x60, 0xC0, 0x3B, 0x40, 0x07, 0x17, 0x44, 0x29, 0x29, 0xF9, 0x24, 0x20, 0xC0, 0x3A, 0x43, 0x10, 0xF6, 0x11, 0x10, 0x89, 0x00, 0xC0, 0x16, 0x42, 0xFF, 0x08, 0x10, 0x8C, 0x00,
+    0xC0, 0x09, 0x43, 0x87, 0x40, 0x20, 0x1C, 0xC1, 0x30, 0x43, 0xC0, 0xB1, 0x8C, 0xC0, 0x14, 0x40, 0xF0, 0xC0, 0x03, 0x89, 0x00, 0x17, 0x44, 0x00, 0x00, 0xFC, 0x01, 0xC0, 0x13, 0x40, 0x11, 0x25,
+    0x8A, 0x00, 0x43, 0xE0, 0x13, 0x10, 0xE0, 0x0E, 0x43, 0x00, 0xC0, 0x30, 0x60, 0x05, 0x42, 0xC3, 0x30, 0x00, 0xC0, 0x16, 0x40, 0xD0, 0x04, 0x82, 0x00, 0x43, 0xE0, 0x23, 0x25, 0xE4, 0x17, 0x42,
+    0x03, 0x82, 0x42, 0x16, 0x42, 0xC4, 0x82, 0xC1, 0x8B, 0x00, 0x35, 0x41, 0x00, 0x00, 0x38, 0x42, 0x31, 0x3C, 0x23, 0xC0, 0x22, 0x44, 0x40, 0x40, 0xCF, 0x40, 0x40, 0xC0, 0x01, 0x84, 0x00, 0x33,
+    0x44, 0x08, 0x08, 0x0F, 0x08, 0x08, 0xC0, 0x01, 0x84, 0x00, 0x3A, 0x42, 0x8A, 0x0F, 0x10, 0xC0, 0x3B, 0x43, 0x87, 0x43, 0x30, 0x0F, 0xAD, 0x00, 0x20, 0x82, 0x42, 0x40, 0xFE, 0x32, 0xA7, 0x00,
+    0x09, 0x44, 0xF8, 0x04, 0x02, 0x1C, 0x60, 0xC3, 0x21, 0x84, 0x00, 0x04, 0x83, 0x00, 0xC0, 0x15, 0x45, 0xF8, 0x07, 0x80, 0x00, 0xC1, 0x31, 0x15, 0x42, 0xE0, 0xDC, 0xF0, 0x06, 0x42, 0x20, 0xE0,
+    0x20, 0x35, 0x44, 0x74, 0x04, 0xFF, 0xF4, 0x84, 0x3D, 0x45, 0x00, 0x04, 0x84, 0x7F, 0x04, 0x04, 0x38, 0x40, 0x01, 0x31, 0x43, 0x02, 0x72, 0x8A, 0x8E, 0x0A, 0x41, 0x84, 0xFD, 0xC0, 0x29, 0x46,
+    0x00, 0xF9, 0x64, 0x14, 0xF8, 0x00, 0x08, 0x0C, 0x40, 0xF8, 0x82, 0x28, 0xC0, 0x29, 0x40, 0xFD, 0x02, 0x44, 0x2A, 0x29, 0xF8, 0x24, 0x20, 0x08, 0x83, 0x01, 0x0B, 0x42, 0x48, 0x48, 0x90, 0x37,
+    0x88, 0x00, 0x18, 0x43, 0x4E, 0x4B, 0x49, 0xC0, 0x01, 0x41, 0x06, 0x01, 0x0E, 0x41, 0xC3, 0x3E, 0x04, 0x84, 0x00, 0x42, 0x03, 0x02, 0x04, 0x37, 0x40, 0x90, 0x01, 0x84, 0x00, 0x05, 0x83, 0x00,
+    0x0F, 0x43, 0xC0, 0x88, 0xC6, 0x01, 0x13, 0x40, 0x08, 0x04, 0x42, 0xC0, 0x80, 0xC0, 0x86, 0x00, 0xC0, 0x03, 0x43, 0x40, 0x40, 0xF8, 0x40, 0xC2, 0x19, 0x43, 0x82, 0x9F, 0xA7, 0x81, 0x0F, 0x42,
+    0x18, 0xD7, 0x1F, 0x84, 0x00, 0xC0, 0x02, 0x41, 0xDF, 0x10, 0x1E, 0x83, 0x10, 0x0F, 0x43, 0x60, 0x3F, 0x10, 0x0C, 0x1C, 0x40, 0x80, 0x27, 0x43, 0x8E, 0x6D, 0x3F, 0x01, 0xC0, 0x12, 0x42, 0x7F,
+    0x04, 0x08,
+};
+// clang-format on
+#elif defined(OLED_DISPLAY_128X64)
+// 72 frames, 73800 bytes raw, 7162 bytes compressed
+#    define SCREENSAVER_FRAME_COUNT 72
+#    define SCREENSAVER_FRAME_SIZE  1024
+#    define SCREENSAVER_DATA_SIZE   7014
+
+// clang-format off
+// offset of the keyframe, then of the delta into each frame, and the end of the data
+static const uint16_t screensaver_offsets[SCREENSAVER_FRAME_COUNT + 2] PROGMEM = {
+    0, 529, 641, 751, 828, 913, 1012, 1117, 1198, 1276, 1366, 1463, 1533, 1616, 1694, 1754,
+    1819, 1916, 1946, 2094, 2148, 2210, 2267, 2335, 2390, 2480, 2522, 2623, 2708, 2799, 2894, 2953,
+    3029, 3099, 3223, 3264, 3357, 3395, 3451, 3574, 3631, 3727, 3865, 3955, 4025, 4135, 4227, 4327,
+    4423, 4491, 4583, 4725, 4822, 4948, 5063, 5152, 5238, 5368, 5513, 5624, 5706, 5833, 5911, 6001,
+    6096, 6204, 6300, 6430, 6469, 6570, 6644, 6797, 6896, 7014,
+};
+
+static const uint8_t screensaver_data[SCREENSAVER_DATA_SIZE] PROGMEM = {
+    0x89, 0x00, 0x43, 0x1C, 0x62, 0xA2, 0x9C, 0xA2, 0x00, 0x49, 0x1C, 0xC8, 0x3C, 0x00, 0x00, 0x74, 0x04, 0xFF, 0xF4, 0x84, 0x92, 0x00, 0x43, 0xFF, 0x40, 0x60, 0x18, 0x84, 0x00, 0x42, 0xFF, 0x08,
+    0x10, 0x87, 0x00, 0x4E, 0x38, 0x06, 0x0C, 0x70, 0x40, 0x04, 0x84, 0x7F, 0x04, 0x04, 0xF8, 0x04, 0x02, 0x1C, 0x60, 0x84, 0x00, 0x49, 0x69, 0x49, 0x92, 0x00, 0x04, 0x84, 0x7F, 0x04, 0x04, 0xC0,
+    0x89, 0x00, 0x43, 0x09, 0x89, 0x79, 0x0F, 0xA2, 0x00, 0x43, 0xCD, 0x38, 0x78, 0x84, 0x82, 0x00, 0x40, 0x01, 0x94, 0x00, 0x44, 0x38, 0x06, 0x0C, 0x70, 0x40, 0x84, 0x00, 0x42, 0xFC, 0x14, 0x1C,
+    0x8B, 0x00, 0x47, 0x09, 0x89, 0x79, 0x0F, 0x02, 0x72, 0x8A, 0x8E, 0x85, 0x00, 0x4A, 0x38, 0x08, 0x8E, 0x78, 0x80, 0x84, 0xFD, 0x84, 0x80, 0x42, 0x42, 0x88, 0x00, 0x49, 0xC0, 0xB1, 0x8C, 0xC0,
+    0x00, 0x84, 0x84, 0xFC, 0x84, 0x84, 0x9C, 0x00, 0x44, 0x08, 0x08, 0xF8, 0x08, 0x08, 0x98, 0x00, 0x43, 0x82, 0x62, 0x3E, 0xC4, 0x85, 0x00, 0x44, 0x12, 0x12, 0xF2, 0x12, 0x10, 0x89, 0x00, 0x48,
+    0xF9, 0x64, 0x14, 0xF8, 0x00, 0x08, 0x3E, 0xFE, 0x08, 0x85, 0x00, 0x44, 0xD3, 0x92, 0x24, 0x00, 0xF8, 0x82, 0x28, 0x41, 0x00, 0xF0, 0x89, 0x00, 0x47, 0xE0, 0x18, 0x31, 0xC0, 0x00, 0x10, 0xF0,
+    0x10, 0x9E, 0x00, 0x42, 0x90, 0x51, 0x30, 0x99, 0x00, 0x43, 0x49, 0xF0, 0xE0, 0x31, 0x84, 0x00, 0x44, 0x08, 0x88, 0xEE, 0x59, 0x80, 0x8B, 0x00, 0x48, 0xFD, 0x01, 0xC0, 0x00, 0x2A, 0x29, 0xF8,
+    0x24, 0x20, 0x84, 0x00, 0x43, 0x10, 0xF0, 0x11, 0x00, 0x83, 0x01, 0x41, 0xFC, 0x11, 0x89, 0x00, 0x49, 0x48, 0x48, 0x90, 0x01, 0x01, 0x52, 0x53, 0xF2, 0x48, 0x40, 0x9C, 0x00, 0x43, 0xE3, 0x12,
+    0x12, 0xE0, 0x98, 0x00, 0x42, 0xC0, 0x33, 0x04, 0x85, 0x00, 0x44, 0x41, 0x40, 0xF7, 0x40, 0x01, 0x8A, 0x00, 0x47, 0x96, 0xE3, 0xC1, 0x60, 0x00, 0x00, 0x06, 0x01, 0x86, 0x00, 0x42, 0x22, 0xC3,
+    0xFA, 0x84, 0x00, 0x41, 0xC3, 0x3E, 0x89, 0x00, 0x48, 0x03, 0x02, 0x04, 0x00, 0x10, 0x10, 0xDC, 0xD3, 0x30, 0x86, 0x00, 0x40, 0xF0, 0x82, 0x00, 0x82, 0x20, 0x40, 0xE0, 0x83, 0x00, 0x44, 0x10,
+    0x10, 0xD0, 0xD0, 0x30, 0x85, 0x00, 0x43, 0xE0, 0x23, 0x25, 0xE4, 0x97, 0x00, 0x44, 0x03, 0x82, 0x42, 0x27, 0xC0, 0x84, 0x00, 0x44, 0x06, 0x99, 0x9F, 0x90, 0x80, 0x8A, 0x00, 0x42, 0xC0, 0x87,
+    0xC9, 0x8B, 0x00, 0x43, 0x96, 0x91, 0x91, 0xF0, 0x84, 0x00, 0x40, 0x08, 0x84, 0x00, 0x42, 0xC0, 0x80, 0xC0, 0x86, 0x00, 0x43, 0xF8, 0x07, 0x00, 0xF0, 0x85, 0x00, 0x47, 0x58, 0x8F, 0xF4, 0x03,
+    0x00, 0x88, 0x64, 0x03, 0x85, 0x00, 0x43, 0x58, 0xFF, 0x20, 0x20, 0x85, 0x00, 0x43, 0x46, 0xF9, 0xF9, 0x4F, 0x8F, 0x00, 0x43, 0x10, 0x10, 0xF0, 0x20, 0x83, 0x00, 0x4E, 0x40, 0x4F, 0xC0, 0x40,
+    0x41, 0x06, 0x40, 0x40, 0xF8, 0x40, 0x40, 0x00, 0x10, 0xFC, 0x03, 0x89, 0x00, 0x44, 0xE0, 0x31, 0x3C, 0x23, 0xE0, 0x89, 0x00, 0x43, 0xF0, 0x90, 0x08, 0x07, 0x8B, 0x00, 0x43, 0xB1, 0x4C, 0x03,
+    0x80, 0x85, 0x00, 0x43, 0x50, 0x88, 0x07, 0x80, 0x85, 0x00, 0x48, 0x4C, 0x43, 0x43, 0xC0, 0x06, 0x25, 0x24, 0x2E, 0x20, 0x84, 0x00, 0x44, 0x82, 0x81, 0xFF, 0x81, 0xE1, 0x82, 0x80, 0x45, 0x00,
+    0x00, 0x50, 0x89, 0x07, 0x80, 0x85, 0x00, 0x82, 0x80, 0x85, 0x00, 0x44, 0x80, 0x8C, 0xF3, 0x81, 0x0E, 0x83, 0x00, 0x4C, 0x40, 0x40, 0xCF, 0x40, 0x40, 0x00, 0xE7, 0xE0, 0x1F, 0x0F, 0x08, 0x0C,
+    0x03, 0x8B, 0x00, 0x44, 0x01, 0x40, 0x50, 0xCC, 0x23, 0x89, 0x00, 0x42, 0x0F, 0x00, 0x01, 0x87, 0x00, 0xC0, 0x21, 0x44, 0x38, 0x06, 0x0C, 0x70, 0x40, 0x27, 0xA1, 0x00, 0x43, 0xCD, 0x38, 0x78,
+    0x84, 0xC2, 0x3A, 0x43, 0x00, 0x90, 0x51, 0x30, 0x99, 0x00, 0x43, 0x49, 0xF0, 0xE0, 0x31, 0x22, 0x44, 0x00, 0x10, 0xF0, 0x11, 0x00, 0x1E, 0x97, 0x00, 0x42, 0xE3, 0x12, 0x12, 0x19, 0x42, 0xC0,
+    0x33, 0x04, 0x85, 0x00, 0x0F, 0x43, 0x96, 0xE3, 0xC1, 0x60, 0x09, 0x43, 0x00, 0x22, 0xC3, 0xFA, 0x84, 0x00, 0x1A, 0x41, 0x00, 0xF0, 0x82, 0x00, 0x82, 0x20, 0x22, 0x88, 0x00, 0x1A, 0x41, 0x87,
+    0xC9, 0x8B, 0x00, 0x42, 0x96, 0x91, 0x91, 0x34, 0x82, 0x00, 0x0A, 0x88, 0x00, 0x42, 0x10, 0x10, 0xF0, 0x11, 0x40, 0xFC, 0xC0, 0x10, 0x82, 0x80, 0x0A, 0x40, 0x00, 0x82, 0x80, 0x19, 0x41, 0x0C,
+    0x03, 0xC0, 0x3E, 0x40, 0x8D, 0x09, 0x43, 0x7C, 0x82, 0x82, 0x7C, 0xC0, 0x3B, 0x40, 0xB0, 0xC2, 0x02, 0x43, 0x39, 0x48, 0x98, 0x01, 0x27, 0x43, 0xF1, 0xE1, 0x61, 0xF1, 0xC0, 0x0E, 0x43, 0x02,
+    0xC2, 0x32, 0x03, 0x1B, 0x42, 0xFE, 0x09, 0x80, 0x09, 0x40, 0x03, 0x01, 0x40, 0x03, 0x0B, 0x43, 0x53, 0x92, 0xD4, 0x30, 0x17, 0x8A, 0x00, 0x36, 0x48, 0x3F, 0x29, 0xE0, 0x00, 0x03, 0x02, 0x02,
+    0x03, 0x04, 0x13, 0x84, 0x00, 0x43, 0x0C, 0x02, 0x03, 0x04, 0x18, 0x41, 0x40, 0xF8, 0x1B, 0x87, 0x00, 0x05, 0x85, 0x00, 0x0E, 0x41, 0x38, 0x27, 0x1A, 0x42, 0xA0, 0x40, 0x00, 0x3C, 0x42, 0x80,
+    0xF0, 0x80, 0x84, 0x00, 0x05, 0x41, 0xE0, 0xE0, 0x82, 0x00, 0x1D, 0x42, 0x80, 0x81, 0x80, 0x2B, 0x44, 0xC4, 0x34, 0xFF, 0x04, 0x04, 0xC0, 0x3B, 0x41, 0x01, 0x01, 0x06, 0x43, 0xC5, 0x29, 0x3D,
+    0x43, 0x26, 0x42, 0x0C, 0x06, 0xFE, 0x24, 0x43, 0x00, 0x10, 0x10, 0xF0, 0xC0, 0x3B, 0x44, 0x20, 0xA1, 0xF9, 0x21, 0x01, 0xC0, 0x3A, 0x45, 0x03, 0x4C, 0x4F, 0x90, 0x00, 0x00, 0xC2, 0x2F, 0x40,
+    0x28, 0xC0, 0x34, 0x44, 0x80, 0xB0, 0xE8, 0xA7, 0xA0, 0x03, 0x41, 0x04, 0x04, 0x2A, 0x40, 0x81, 0x84, 0x00, 0x12, 0x88, 0x00, 0x27, 0x44, 0x00, 0x80, 0x8F, 0x88, 0x08, 0xC2, 0x17, 0x42, 0xC0,
+    0x30, 0x0F, 0x32, 0xA1, 0x00, 0xC4, 0x08, 0x44, 0x40, 0x53, 0xF0, 0x50, 0x53, 0x1B, 0x96, 0x00, 0x3A, 0x42, 0x43, 0x82, 0xF2, 0x0B, 0x42, 0x07, 0x04, 0x04, 0x0B, 0x43, 0xEC, 0x72, 0x03, 0xE4,
+    0x0A, 0x46, 0x40, 0x80, 0xF0, 0x00, 0x00, 0x80, 0x60, 0x86, 0x00, 0xC0, 0x04, 0x42, 0x0C, 0x03, 0x03, 0x05, 0x44, 0x00, 0xD0, 0x88, 0x87, 0xC0, 0x0A, 0x84, 0x00, 0x43, 0x10, 0x08, 0x06, 0x01,
+    0x2C, 0x91, 0x00, 0x05, 0x83, 0x00, 0x43, 0x20, 0x2C, 0x23, 0xE0, 0x1A, 0x43, 0x0F, 0x83, 0x81, 0x0F, 0xC1, 0x2B, 0x43, 0x88, 0x89, 0xF9, 0x80, 0xC0, 0x1A, 0x43, 0x7E, 0x88, 0x3C, 0x08, 0xC0,
+    0x11, 0x43, 0xC0, 0xB0, 0x8C, 0xC0, 0x24, 0x43, 0xA0, 0xF8, 0x23, 0x00, 0x22, 0x43, 0x38, 0x1D, 0x80, 0x78, 0x2E, 0x40, 0x01, 0x06, 0x43, 0x3E, 0x01, 0xC0, 0x3C, 0x85, 0x00, 0x3A, 0x42, 0xE4,
+    0x12, 0x11, 0x37, 0x43, 0x14, 0x12, 0x11, 0x10, 0xC0, 0x3B, 0x40, 0x42, 0x01, 0x40, 0x02, 0x85, 0x00, 0x30, 0x89, 0x00, 0x27, 0x42, 0xD0, 0xAC, 0x23, 0x09, 0x44, 0x00, 0x31, 0x28, 0xE7, 0x00,
+    0x3B, 0x44, 0x80, 0x80, 0xE0, 0x80, 0x80, 0x2B, 0x43, 0x27, 0x28, 0xE8, 0x07, 0x09, 0x44, 0x04, 0x44, 0x44, 0xC7, 0x24, 0x35, 0x43, 0x8D, 0x42, 0x20, 0x1C, 0x93, 0x00, 0x18, 0x84, 0x00, 0x09,
+    0x83, 0x00, 0xC1, 0x3B, 0x44, 0x04, 0xC4, 0x34, 0x0C, 0x04, 0x2F, 0x44, 0x80, 0x84, 0x84, 0xFC, 0x80, 0x08, 0x44, 0x04, 0xE4, 0x14, 0x1C, 0x00, 0x38, 0x40, 0x01, 0x33, 0x41, 0x3C, 0x00, 0x0B,
+    0x40, 0xF0, 0x01, 0x40, 0xF0, 0xC2, 0x0F, 0x42, 0xC2, 0x82, 0xC7, 0x85, 0x00, 0x1E, 0x47, 0x86, 0x41, 0xC1, 0x00, 0x80, 0x87, 0x84, 0x84, 0xC0, 0x0F, 0x43, 0x51, 0xCC, 0x43, 0x40, 0x86, 0x00,
+    0x12, 0x41, 0x8C, 0x63, 0x07, 0x43, 0xCF, 0x82, 0x83, 0xCE, 0x04, 0x40, 0x84, 0x09, 0x42, 0x90, 0x08, 0x86, 0xC0, 0x1D, 0x43, 0x06, 0x05, 0x04, 0x0E, 0x0E, 0x41, 0x06, 0x05, 0xC3, 0x2B, 0x42,
+    0x28, 0x28, 0xF8, 0xC0, 0x1F, 0x9C, 0x00, 0x82, 0x01, 0x32, 0x44, 0x28, 0x28, 0xF9, 0x24, 0x20, 0x27, 0x42, 0x50, 0x50, 0xF0, 0xC0, 0x04, 0x44, 0x01, 0x78, 0x07, 0x80, 0x79, 0x06, 0x41, 0x06,
+    0x01, 0xC0, 0x31, 0x43, 0x00, 0x98, 0x94, 0x93, 0x2E, 0x43, 0x9C, 0x92, 0x93, 0x84, 0x0A, 0x97, 0x00, 0x1B, 0x45, 0x00, 0xD1, 0x0C, 0x83, 0x40, 0x40, 0x36, 0x43, 0x80, 0x10, 0x8C, 0x03, 0x0A,
+    0x82, 0x40, 0x00, 0x40, 0x00, 0x83, 0x20, 0x2B, 0x44, 0x4F, 0xC3, 0x44, 0x48, 0x08, 0x30, 0x84, 0x00, 0xC0, 0x3A, 0x40, 0xCC, 0x34, 0x83, 0x00, 0xC0, 0x3B, 0x40, 0xF8, 0xC1, 0x02, 0x43, 0x08,
+    0xC8, 0x28, 0x38, 0x86, 0x00, 0xC0, 0x17, 0x44, 0xE2, 0x82, 0x43, 0x20, 0x20, 0x18, 0x42, 0x11, 0x12, 0x12, 0x09, 0x46, 0x00, 0x23, 0xA0, 0xE0, 0x23, 0x03, 0xE2, 0xC0, 0x0C, 0x45, 0x00, 0xC7,
+    0x81, 0xC2, 0x04, 0x04, 0x26, 0x43, 0x88, 0x87, 0x80, 0x80, 0xC0, 0x3C, 0x41, 0x80, 0x60, 0x29, 0x89, 0x00, 0x3A, 0x43, 0x45, 0x44, 0xCE, 0x20, 0x09, 0x41, 0x03, 0x1F, 0xC2, 0x34, 0x83, 0x00,
+    0xC0, 0x31, 0x44, 0x00, 0xF8, 0x70, 0x30, 0xF8, 0x05, 0x40, 0xD2, 0x34, 0x43, 0xE1, 0x91, 0xF1, 0x80, 0x04, 0x44, 0x08, 0x08, 0xF9, 0x08, 0x08, 0x31, 0x40, 0xC9, 0x01, 0x40, 0x01, 0x09, 0x43,
+    0xE0, 0x11, 0x09, 0x70, 0x2D, 0x40, 0x03, 0x01, 0x40, 0x03, 0x04, 0x84, 0x01, 0x1D, 0x43, 0x00, 0x87, 0xE0, 0x19, 0x06, 0x42, 0xFE, 0x09, 0x80, 0x16, 0x40, 0x20, 0xC0, 0x19, 0x42, 0x91, 0x90,
+    0x9F, 0x06, 0x44, 0x03, 0x02, 0x02, 0x03, 0x04, 0xC0, 0x09, 0x43, 0x86, 0xF9, 0x49, 0xCF, 0xC0, 0x3B, 0x43, 0x40, 0x8F, 0x0A, 0x89, 0xC0, 0x0D, 0x88, 0x00, 0x22, 0x44, 0x38, 0x06, 0x0C, 0x70,
+    0x40, 0x31, 0x84, 0x00, 0xC0, 0x04, 0x40, 0xFC, 0x39, 0x43, 0x0E, 0x80, 0x40, 0x38, 0x93, 0x00, 0x18, 0x84, 0x00, 0xC0, 0x09, 0x41, 0x09, 0xF8, 0x2F, 0x41, 0xFC, 0x00, 0x24, 0x9C, 0x00, 0xC0,
+    0x23, 0x41, 0xD0, 0xD0, 0x3B, 0x42, 0x87, 0x81, 0x82, 0x1A, 0x43, 0x82, 0xF2, 0x42, 0xC2, 0x19, 0x43, 0x8C, 0x62, 0xC3, 0x04, 0xC0, 0x43, 0xC8, 0x08, 0x8F, 0x48, 0x19, 0x43, 0x80, 0x6F, 0x0A,
+    0x09, 0x19, 0x44, 0x83, 0x00, 0x80, 0x07, 0x04, 0x09, 0x97, 0x00, 0x1B, 0x44, 0x00, 0xEF, 0x03, 0x04, 0x88, 0x27, 0x42, 0x83, 0x9F, 0x80, 0x2C, 0x40, 0xB4, 0xC0, 0x3C, 0x43, 0x04, 0xC4, 0xBF,
+    0xFD, 0x86, 0x00, 0xC0, 0x34, 0x40, 0x01, 0xC2, 0x0D, 0x45, 0x08, 0x89, 0x89, 0x70, 0x00, 0xF9, 0x08, 0x43, 0x23, 0x24, 0xFF, 0xE0, 0x1E, 0x43, 0x83, 0x60, 0x50, 0x93, 0xC0, 0x09, 0x45, 0x22,
+    0xA2, 0xE3, 0x22, 0x00, 0xE3, 0x08, 0x43, 0x08, 0x56, 0x95, 0xD7, 0x1E, 0x43, 0x03, 0x04, 0x04, 0x03, 0x33, 0x40, 0xF2, 0xC0, 0x3C, 0x41, 0x0C, 0x03, 0xC0, 0x29, 0x40, 0x8F, 0x2B, 0x43, 0x20,
+    0x90, 0xFC, 0x03, 0x85, 0x00, 0x39, 0x40, 0xFF, 0x82, 0x84, 0xC0, 0x2C, 0x40, 0xFF, 0x82, 0x84, 0xC0, 0x0A, 0x85, 0x00, 0xC0, 0x82, 0x00, 0x38, 0x40, 0x1C, 0x34, 0x82, 0x00, 0x0C, 0x40, 0x10,
+    0x3C, 0x42, 0xE1, 0x41, 0xE1, 0x2D, 0x42, 0x90, 0xE0, 0xC0, 0x0E, 0x44, 0x48, 0x4A, 0x4A, 0xFB, 0x02, 0x37, 0x42, 0x08, 0x06, 0x01, 0xC0, 0x43, 0x04, 0x84, 0x84, 0x87, 0x01, 0x40, 0xC8, 0xC0,
+    0x3D, 0x41, 0x00, 0x8F, 0xC0, 0x16, 0x43, 0x00, 0x07, 0xC8, 0x88, 0x1A, 0x42, 0x2F, 0x23, 0x21, 0xC2, 0x0D, 0x89, 0x00, 0x08, 0x44, 0x00, 0x09, 0x09, 0xC9, 0x38, 0xC0, 0x3C, 0x40, 0x8D, 0xC1,
+    0x24, 0x44, 0x03, 0x04, 0xFF, 0x08, 0x80, 0xC0, 0x3A, 0x45, 0x00, 0x53, 0x92, 0xD2, 0x33, 0x04, 0x9C, 0x00, 0x43, 0xC3, 0xBC, 0xE4, 0x23, 0xC0, 0x09, 0x43, 0x24, 0x24, 0x27, 0xE0, 0x10, 0x41,
+    0xF0, 0x00, 0x1A, 0x42, 0x11, 0x0D, 0x07, 0x32, 0x42, 0xCC, 0x83, 0xC0, 0x14, 0x43, 0x28, 0x24, 0x23, 0xE0, 0xC0, 0x23, 0x42, 0x11, 0x0C, 0x03, 0x13, 0x43, 0x4F, 0x41, 0x43, 0xCF, 0xC2, 0x21,
+    0x43, 0x70, 0x8C, 0x8A, 0x72, 0x0A, 0x43, 0x09, 0x89, 0x79, 0x0F, 0xC0, 0x00, 0x42, 0x80, 0x60, 0x1E, 0x94, 0x00, 0x14, 0x40, 0x8C, 0x0C, 0x40, 0x01, 0x3E, 0x83, 0x00, 0xC0, 0x3B, 0x42, 0xE0,
+    0x10, 0x10, 0x32, 0x84, 0x00, 0xC0, 0x3B, 0x41, 0x38, 0x20, 0x12, 0x40, 0xC0, 0xC0, 0x3C, 0x44, 0x2A, 0x2E, 0xE9, 0x00, 0x9F, 0xC0, 0x3D, 0x41, 0x00, 0x06, 0x13, 0x43, 0xCC, 0x38, 0x78, 0x84,
+    0x3E, 0x8A, 0x00, 0xC5, 0x13, 0x83, 0x00, 0xC0, 0x3B, 0x43, 0x20, 0xC0, 0xF8, 0x00, 0x01, 0x41, 0x4B, 0xC2, 0x37, 0x43, 0x48, 0x46, 0xC1, 0x40, 0x3E, 0x44, 0x00, 0x20, 0x28, 0x26, 0xC1, 0x2D,
+    0x42, 0xF1, 0x2D, 0xE7, 0x06, 0x42, 0x10, 0x0F, 0x01, 0xC0, 0x32, 0x42, 0x0F, 0x04, 0x0F, 0x28, 0x43, 0x47, 0xC8, 0x48, 0x47, 0x04, 0x43, 0x40, 0x51, 0x7C, 0xC3, 0x09, 0x89, 0x00, 0xC0, 0x0D,
+    0x44, 0x09, 0x09, 0xF9, 0x09, 0x08, 0xC0, 0x3B, 0x40, 0x8D, 0xC0, 0x29, 0x89, 0x00, 0x18, 0x43, 0x05, 0x84, 0x64, 0x1C, 0xC0, 0x18, 0x40, 0x38, 0x01, 0x85, 0x00, 0x19, 0x40, 0x01, 0x17, 0x43,
+    0xE4, 0x17, 0x10, 0xE0, 0x22, 0x83, 0x00, 0x00, 0x43, 0x81, 0x61, 0x51, 0x91, 0xC0, 0x0F, 0x43, 0x50, 0x93, 0xD5, 0x34, 0x9D, 0x00, 0x05, 0x47, 0x20, 0x20, 0xE0, 0x00, 0x43, 0x44, 0xC4, 0x43,
+    0x2C, 0x84, 0x00, 0x22, 0x9C, 0x00, 0x3A, 0x42, 0x20, 0x20, 0xE0, 0x0F, 0x43, 0x48, 0xFA, 0xCE, 0x09, 0x10, 0x42, 0x40, 0x80, 0x00, 0xC0, 0x26, 0x42, 0x5F, 0x4C, 0x4B, 0x20, 0x44, 0x80, 0x84,
+    0xFC, 0x84, 0x80, 0x05, 0x42, 0xE4, 0x94, 0x8C, 0x86, 0x00, 0xC0, 0x37, 0x40, 0xFC, 0xCA, 0x1B, 0x42, 0x40, 0x40, 0x87, 0x1D, 0x43, 0x4F, 0x84, 0x0F, 0x80, 0x35, 0x43, 0x09, 0x89, 0x79, 0x0F,
+    0x31, 0x83, 0x00, 0x43, 0x04, 0xC4, 0xBF, 0xFC, 0x15, 0x89, 0x00, 0x43, 0x09, 0x89, 0x79, 0x0F, 0x12, 0x44, 0x00, 0xC1, 0x31, 0x1F, 0xE2, 0x27, 0x89, 0x00, 0x0D, 0x40, 0x01, 0x22, 0x40, 0x01,
+    0x15, 0x40, 0x00, 0x08, 0x44, 0x3C, 0x04, 0x07, 0x84, 0x7C, 0xC0, 0x3B, 0x42, 0x08, 0xFA, 0x09, 0x37, 0x42, 0xC1, 0xE0, 0x18, 0x36, 0x44, 0x60, 0x33, 0xF0, 0x00, 0x03, 0x05, 0x43, 0xF9, 0x01,
+    0x01, 0xC1, 0x35, 0x42, 0x01, 0x00, 0x07, 0x02, 0x83, 0x00, 0x04, 0x40, 0x43, 0x2B, 0x43, 0xC0, 0xBF, 0xE0, 0x20, 0x00, 0x84, 0x00, 0x43, 0x47, 0x42, 0xC3, 0x40, 0x3B, 0x42, 0x80, 0x40, 0xC0,
+    0x05, 0x40, 0xC0, 0x30, 0x48, 0x80, 0xF0, 0x40, 0xC0, 0x00, 0xD0, 0x8F, 0x81, 0x40, 0x2C, 0x84, 0x00, 0x0E, 0x40, 0x4A, 0x01, 0x41, 0x80, 0x7F, 0x35, 0x43, 0x0C, 0x03, 0x07, 0x08, 0x2B, 0x44,
+    0x00, 0x40, 0x40, 0xC0, 0x20, 0x0D, 0x42, 0x4F, 0x49, 0x49, 0x01, 0x41, 0x01, 0x10, 0xC1, 0x21, 0x42, 0x69, 0x49, 0x92, 0xC2, 0x0B, 0x43, 0xF9, 0x70, 0x30, 0xF8, 0xC0, 0x18, 0x88, 0x00, 0x1C,
+    0x40, 0x01, 0xC0, 0x17, 0x43, 0x00, 0xE0, 0x80, 0x40, 0x28, 0x45, 0x72, 0x3A, 0x03, 0xF2, 0x48, 0x4B, 0xC0, 0x39, 0x45, 0x28, 0x24, 0x23, 0xC0, 0x04, 0xC4, 0xC1, 0x0E, 0x9C, 0x00, 0x2B, 0x43,
+    0x07, 0xE8, 0x08, 0x07, 0xC0, 0x39, 0x99, 0x00, 0xC0, 0x16, 0x84, 0x00, 0x19, 0x89, 0x00, 0xC0, 0x37, 0x40, 0x20, 0xC2, 0x23, 0x41, 0xC0, 0x37, 0xC0, 0x3C, 0x43, 0x03, 0x02, 0x02, 0x07, 0x0A,
+    0x40, 0x24, 0x2C, 0x42, 0x0D, 0x07, 0xF0, 0x00, 0x84, 0x00, 0xC0, 0x08, 0x40, 0x79, 0x2B, 0x42, 0x50, 0x88, 0x07, 0x02, 0x42, 0x80, 0x00, 0x80, 0x31, 0x83, 0x00, 0x0D, 0x40, 0x0F, 0x01, 0x41,
+    0x4F, 0xC0, 0xC0, 0x43, 0x08, 0xFF, 0xA4, 0x9C, 0xC2, 0x0E, 0x43, 0xC0, 0xB1, 0x8C, 0xC0, 0x09, 0x44, 0x3C, 0x04, 0x07, 0x84, 0x7C, 0x31, 0x88, 0x00, 0x34, 0x40, 0x01, 0x0B, 0x41, 0x02, 0x01,
+    0x34, 0x40, 0x58, 0xC3, 0x1A, 0x83, 0x00, 0x04, 0x40, 0x84, 0xC0, 0x35, 0x43, 0xC0, 0x80, 0x80, 0xC0, 0x03, 0x41, 0x86, 0x7D, 0x36, 0x40, 0xC3, 0x20, 0x40, 0xC8, 0xC2, 0x30, 0x43, 0x1C, 0x62,
+    0xA2, 0x9C, 0x03, 0x84, 0x00, 0xC0, 0x2D, 0x84, 0x00, 0x40, 0xF8, 0x16, 0x8C, 0x00, 0xC0, 0x15, 0x40, 0xC8, 0x01, 0x40, 0x00, 0x18, 0x42, 0x00, 0xE0, 0x10, 0xC0, 0x01, 0x88, 0x00, 0xC0, 0x36,
+    0x82, 0x80, 0x86, 0x00, 0x18, 0x43, 0xC2, 0x22, 0xA7, 0xC0, 0xC0, 0x36, 0x48, 0x40, 0x4F, 0xFA, 0x49, 0x40, 0x07, 0x0B, 0x08, 0x07, 0x3B, 0x84, 0x00, 0x34, 0x43, 0x00, 0x40, 0x58, 0xC7, 0x39,
+    0x43, 0x80, 0x8E, 0x92, 0xE6, 0xC1, 0x00, 0x44, 0x40, 0x42, 0x42, 0x7E, 0x40, 0x39, 0x94, 0x00, 0xC1, 0x0F, 0x41, 0xC2, 0x3D, 0xC0, 0x3C, 0x40, 0x03, 0xC2, 0x1A, 0x41, 0x44, 0x44, 0x2B, 0x42,
+    0x91, 0x8D, 0x87, 0x86, 0x00, 0xC0, 0x07, 0x41, 0x90, 0x7C, 0x2B, 0x43, 0x48, 0x88, 0x0F, 0x88, 0x3B, 0x43, 0x80, 0x18, 0x07, 0x80, 0x20, 0x44, 0x00, 0x0F, 0x80, 0x70, 0x0F, 0x19, 0x43, 0x88,
+    0x88, 0xF8, 0x80, 0x2B, 0x44, 0x00, 0x1C, 0x83, 0x72, 0x0E, 0xC0, 0x3A, 0x41, 0x00, 0x1D, 0xC1, 0x06, 0x85, 0x00, 0x14, 0x43, 0xF0, 0xE0, 0x61, 0xF0, 0x3E, 0x8A, 0x00, 0x08, 0x85, 0x00, 0x09,
+    0x41, 0x88, 0x88, 0x0C, 0x89, 0x00, 0x40, 0x03, 0x01, 0x40, 0x03, 0x3E, 0x44, 0x00, 0x00, 0x80, 0xE0, 0x18, 0x0F, 0x83, 0x10, 0x1A, 0x42, 0x90, 0xD0, 0x30, 0xC2, 0x22, 0x44, 0xC7, 0x0B, 0x88,
+    0x47, 0x40, 0x83, 0x00, 0xC0, 0x36, 0x44, 0x0F, 0x03, 0x04, 0x08, 0x08, 0x82, 0x20, 0x40, 0x00, 0xC0, 0x21, 0x8E, 0x00, 0xC0, 0x31, 0x40, 0x8C, 0xC0, 0x1B, 0x43, 0x0E, 0x80, 0x40, 0x38, 0xC0,
+    0x3B, 0x40, 0x01, 0xC0, 0x20, 0x44, 0x43, 0xF8, 0x20, 0xF0, 0x20, 0xC0, 0x3B, 0x41, 0x01, 0x0E, 0x28, 0x89, 0x00, 0xC0, 0x35, 0x43, 0xC0, 0x00, 0x80, 0x40, 0x12, 0x44, 0x42, 0x42, 0x7E, 0x42,
+    0x42, 0xC1, 0x22, 0x44, 0x1C, 0x83, 0x72, 0x0E, 0x00, 0x01, 0x41, 0x42, 0x42, 0xC0, 0x36, 0x40, 0x01, 0xC0, 0x02, 0x94, 0x00, 0xC0, 0x25, 0x84, 0x00, 0x40, 0xF8, 0xC0, 0x2B, 0x83, 0x00, 0x09,
+    0x43, 0x70, 0x38, 0x00, 0xF0, 0x0B, 0x98, 0x00, 0x07, 0x44, 0x10, 0x10, 0xD7, 0xD0, 0x30, 0x3B, 0x47, 0x80, 0xF0, 0x40, 0xC0, 0x03, 0x42, 0x82, 0xF7, 0x85, 0x00, 0x0F, 0x42, 0x80, 0x60, 0xC0,
+    0x9E, 0x00, 0x42, 0x98, 0x87, 0x80, 0xC0, 0x01, 0x43, 0xCC, 0x03, 0x83, 0x40, 0xC0, 0x2B, 0x43, 0x00, 0x91, 0x8C, 0x83, 0x0C, 0x42, 0xE3, 0x84, 0x88, 0x04, 0x43, 0x89, 0xF9, 0x4F, 0x40, 0x26,
+    0x43, 0x88, 0x88, 0xF8, 0x80, 0x00, 0x89, 0x00, 0x26, 0x43, 0x7C, 0xB2, 0x8A, 0x7C, 0xC0, 0x1D, 0x44, 0x04, 0x04, 0xFC, 0x04, 0x04, 0x1D, 0x8E, 0x00, 0xC2, 0x0E, 0x42, 0x11, 0xF0, 0x10, 0xC0,
+    0x0F, 0x43, 0x48, 0x4B, 0x48, 0xF8, 0x28, 0x42, 0x02, 0x03, 0x02, 0x15, 0x89, 0x00, 0x2F, 0x82, 0x04, 0x40, 0x07, 0x0C, 0x41, 0xCE, 0x30, 0x31, 0x82, 0x90, 0xC0, 0x06, 0x42, 0x02, 0x01, 0x1F,
+    0xC0, 0x0B, 0x42, 0x0C, 0x83, 0x63, 0x85, 0x00, 0x3C, 0x40, 0x03, 0x37, 0x44, 0x04, 0x03, 0xFF, 0x80, 0x80, 0x84, 0x00, 0xC4, 0x30, 0x43, 0xC0, 0xBE, 0x82, 0xE0, 0x1E, 0x43, 0x24, 0x24, 0x25,
+    0xE0, 0xC0, 0x18, 0x40, 0xC0, 0x01, 0x41, 0x00, 0x01, 0x1D, 0x42, 0x48, 0x4C, 0xFB, 0x8A, 0x00, 0xC0, 0x17, 0x83, 0x00, 0xC0, 0x2D, 0x83, 0x00, 0x09, 0x82, 0x20, 0x0C, 0x97, 0x00, 0x14, 0x40,
+    0x0F, 0x01, 0x40, 0x40, 0x12, 0x8A, 0x00, 0x08, 0x43, 0x5C, 0x93, 0xD0, 0x30, 0x06, 0x42, 0x40, 0xF0, 0x40, 0x19, 0x40, 0x80, 0x01, 0x40, 0x80, 0x9D, 0x00, 0x09, 0x44, 0x0F, 0x03, 0x04, 0x08,
+    0x08, 0x12, 0x43, 0x80, 0x00, 0x00, 0x80, 0x85, 0x00, 0x09, 0x43, 0x8C, 0x82, 0x83, 0x04, 0x18, 0x47, 0x8D, 0x42, 0x20, 0x1C, 0x60, 0x58, 0x46, 0xE0, 0xC1, 0x0A, 0x89, 0x00, 0x26, 0x43, 0x1C,
+    0x83, 0x72, 0x0E, 0xC0, 0x19, 0x43, 0xF9, 0x64, 0x14, 0xF8, 0x1D, 0x40, 0x01, 0x02, 0x8F, 0x00, 0x22, 0x42, 0x90, 0x50, 0x31, 0x8B, 0x00, 0x18, 0x41, 0x01, 0x01, 0x25, 0x40, 0xF8, 0x19, 0x93,
+    0x00, 0x00, 0x42, 0x4B, 0x4A, 0xFA, 0x27, 0x44, 0x08, 0x0A, 0xEB, 0x6A, 0x18, 0x3A, 0x40, 0x48, 0x35, 0x42, 0x87, 0x62, 0x03, 0x86, 0x00, 0x41, 0x0C, 0x03, 0xC0, 0x1F, 0x43, 0xE2, 0x21, 0x3F,
+    0xE0, 0x0E, 0x43, 0x06, 0xC5, 0x04, 0x8E, 0xC0, 0x28, 0x43, 0x06, 0x09, 0x09, 0x0F, 0xC1, 0x26, 0x83, 0x42, 0xC4, 0x05, 0x43, 0x04, 0xC4, 0x7C, 0x88, 0xC0, 0x3A, 0x44, 0x00, 0xC3, 0x30, 0x00,
+    0x03, 0x1E, 0x44, 0x44, 0x44, 0xF7, 0x40, 0x40, 0x3E, 0x89, 0x00, 0x17, 0x83, 0x00, 0x16, 0x41, 0x18, 0x07, 0xC0, 0x01, 0x42, 0xC0, 0xA0, 0x20, 0x0F, 0x84, 0x00, 0x08, 0x43, 0x40, 0x40, 0xC0,
+    0x00, 0x0B, 0x97, 0x00, 0xC0, 0x0A, 0x41, 0x00, 0x00, 0xC3, 0x2B, 0x88, 0x00, 0x26, 0x44, 0x08, 0x09, 0xF8, 0x08, 0x08, 0x32, 0x44, 0x20, 0xFC, 0x11, 0x78, 0x10, 0x12, 0x42, 0xE0, 0x90, 0xF0,
+    0x2E, 0x40, 0x01, 0x02, 0x8E, 0x00, 0x22, 0x42, 0x48, 0x48, 0xFF, 0xC0, 0x0B, 0x41, 0xF8, 0x08, 0xC0, 0x1A, 0x44, 0x4C, 0x43, 0xF0, 0x40, 0x40, 0xC0, 0x2F, 0x44, 0xE6, 0x25, 0x3C, 0x2E, 0xE0,
+    0x86, 0x00, 0x41, 0x18, 0x07, 0xC0, 0x1E, 0x43, 0xC6, 0xE9, 0x09, 0xCF, 0x0E, 0x44, 0x01, 0x00, 0x10, 0x0C, 0x03, 0x9D, 0x00, 0x35, 0x83, 0x00, 0x04, 0x43, 0x60, 0x58, 0x46, 0xE0, 0x99, 0x00,
+    0x3B, 0x46, 0xCC, 0x38, 0x78, 0x84, 0x00, 0x1F, 0xFF, 0xC0, 0x3D, 0x40, 0x01, 0xC1, 0x1B, 0x43, 0xC0, 0x31, 0x29, 0xC8, 0x30, 0x44, 0x30, 0x18, 0xF8, 0x00, 0x00, 0xC0, 0x05, 0x43, 0x01, 0x02,
+    0x02, 0x01, 0x31, 0x41, 0xC0, 0x33, 0x00, 0x9E, 0x00, 0xC0, 0x2A, 0x41, 0x40, 0x40, 0xC0, 0x39, 0x83, 0x00, 0xC0, 0x2D, 0x83, 0x00, 0x09, 0x42, 0x80, 0xF0, 0x40, 0x39, 0x44, 0x00, 0xC1, 0xB1,
+    0x1F, 0xE2, 0xC0, 0x14, 0x44, 0x60, 0x5F, 0x41, 0x70, 0x80, 0xC0, 0x02, 0x44, 0x08, 0x0A, 0xFE, 0x8A, 0x8A, 0x32, 0x40, 0xB0, 0x11, 0x44, 0x14, 0x14, 0xFC, 0x12, 0x10, 0x30, 0x40, 0x08, 0xC0,
+    0x09, 0x40, 0x03, 0x02, 0x88, 0x00, 0x27, 0x43, 0x08, 0x89, 0x88, 0x70, 0xC0, 0x0A, 0x40, 0x30, 0x01, 0x85, 0x00, 0x27, 0x43, 0x02, 0x02, 0x03, 0x02, 0x01, 0x8C, 0x00, 0x44, 0x20, 0x20, 0xE3,
+    0x20, 0x20, 0xC0, 0x2C, 0x42, 0x00, 0x00, 0xF0, 0x8B, 0x00, 0x42, 0x40, 0x87, 0xF0, 0x1F, 0x41, 0x80, 0x78, 0x0C, 0x41, 0x71, 0x1F, 0x1A, 0x42, 0x40, 0xD8, 0x47, 0x15, 0x88, 0x00, 0x30, 0x43,
+    0x06, 0x05, 0x04, 0x0E, 0x0A, 0x43, 0xD0, 0xE8, 0x06, 0xC1, 0x18, 0x44, 0x08, 0x08, 0x0F, 0x08, 0x08, 0x13, 0x41, 0x00, 0xC0, 0x87, 0x00, 0xC0, 0x1C, 0x44, 0x09, 0x09, 0xF9, 0x09, 0x08, 0xC0,
+    0x3B, 0x40, 0xFF, 0xC0, 0x1B, 0x44, 0x09, 0x08, 0xFE, 0x08, 0x08, 0xC0, 0x15, 0x41, 0x91, 0x70, 0x8A, 0x00, 0x18, 0x41, 0x33, 0x28, 0xC0, 0x16, 0x42, 0x4B, 0xFA, 0x02, 0xC6, 0x21, 0x83, 0x00,
+    0x43, 0x04, 0xF4, 0x1C, 0x04, 0xC0, 0x3B, 0x40, 0x01, 0x11, 0x45, 0x08, 0x0A, 0xFE, 0x8A, 0x8A, 0x00, 0x1C, 0x84, 0x00, 0xC0, 0x17, 0x4E, 0x00, 0x12, 0x12, 0x92, 0x70, 0x00, 0x70, 0x0C, 0x18,
+    0xE0, 0x80, 0x85, 0x84, 0x84, 0xBC, 0xC0, 0x32, 0x40, 0xFE, 0xC1, 0x14, 0x89, 0x00, 0x05, 0x43, 0x79, 0x02, 0x82, 0x79, 0x1D, 0x43, 0x6A, 0x12, 0x03, 0xE2, 0xC0, 0x0B, 0x40, 0xD0, 0x0C, 0x42,
+    0x08, 0x04, 0x03, 0x1E, 0x42, 0x04, 0x02, 0x01, 0x03, 0x8C, 0x00, 0x0C, 0x95, 0x00, 0xC0, 0x0D, 0x41, 0x50, 0x90, 0x19, 0x41, 0x80, 0x78, 0xC0, 0x00, 0x42, 0x8F, 0x48, 0x48, 0xC0, 0x1C, 0x43,
+    0x0F, 0x80, 0x70, 0x0F, 0x9E, 0x00, 0x43, 0x43, 0x42, 0x7E, 0x40, 0xC0, 0x18, 0x41, 0x0B, 0xFE, 0x11, 0x40, 0x1C, 0xC1, 0x34, 0x42, 0xF8, 0x0B, 0xF8, 0xC0, 0x3C, 0x42, 0x03, 0x01, 0x03, 0xC5,
+    0x2E, 0x88, 0x00, 0x2B, 0x42, 0x94, 0x94, 0xFC, 0x2D, 0x42, 0xFE, 0x42, 0xFE, 0x9F, 0x00, 0xC0, 0x1C, 0x40, 0x0A, 0x21, 0x43, 0x04, 0x07, 0x84, 0x7C, 0xC0, 0x3C, 0x41, 0x02, 0x01, 0xC3, 0x27,
+    0x8A, 0x00, 0x26, 0x44, 0x84, 0xF2, 0x41, 0xE0, 0x40, 0xC0, 0x09, 0x82, 0x80, 0x2E, 0x42, 0x03, 0x1C, 0x01, 0x00, 0x8E, 0x00, 0xC0, 0x30, 0x82, 0x80, 0x8A, 0x00, 0x04, 0x43, 0x82, 0xA2, 0xE2,
+    0x9C, 0x05, 0x85, 0x42, 0x07, 0x44, 0x00, 0xCC, 0x38, 0x78, 0x84, 0x30, 0x43, 0x80, 0xFF, 0x40, 0x30, 0xC0, 0x00, 0x42, 0xFF, 0x08, 0x10, 0x82, 0x00, 0x34, 0x40, 0x01, 0x1C, 0x8E, 0x00, 0x34,
+    0x85, 0x00, 0xC0, 0x04, 0x42, 0x24, 0x26, 0xFD, 0x15, 0x42, 0x10, 0xF0, 0x10, 0x01, 0x46, 0x10, 0xD0, 0x70, 0x10, 0xF0, 0x52, 0x71, 0x11, 0x41, 0xF8, 0x08, 0xC0, 0x06, 0x42, 0x02, 0x02, 0x03,
+    0x14, 0x47, 0x02, 0x02, 0x03, 0x02, 0x02, 0x00, 0x04, 0x03, 0xC1, 0x1A, 0x42, 0xE8, 0x24, 0xE3, 0x01, 0x43, 0x8C, 0xF3, 0x40, 0xE0, 0xC0, 0x30, 0x48, 0x06, 0x95, 0x94, 0x2E, 0x00, 0x00, 0x0F,
+    0x04, 0x0F, 0x02, 0x42, 0xC3, 0x5C, 0x01, 0x39, 0x94, 0x00, 0x21, 0x43, 0x00, 0x06, 0x04, 0x09, 0x85, 0x00, 0x3E, 0x41, 0x00, 0x00, 0xC1, 0x2B, 0x42, 0x94, 0x94, 0xFC, 0xC4, 0x10, 0x43, 0xE2,
+    0x12, 0x13, 0xE0, 0x22, 0x42, 0x23, 0xFD, 0xE3, 0xC0, 0x16, 0x42, 0x03, 0x05, 0x04, 0x21, 0x43, 0x08, 0x06, 0x05, 0x07, 0xC1, 0x01, 0x88, 0x00, 0x27, 0x44, 0xC0, 0x03, 0x9C, 0x41, 0x40, 0xC0,
+    0x09, 0x43, 0x40, 0x80, 0x00, 0x80, 0x2C, 0x44, 0x0F, 0x03, 0x04, 0x08, 0x08, 0x8D, 0x00, 0xC1, 0x04, 0x43, 0x20, 0x10, 0xFC, 0x03, 0x14, 0x43, 0x09, 0x09, 0xF9, 0x09, 0x30, 0x43, 0x7D, 0xB2,
+    0x8A, 0x7C, 0x04, 0x43, 0x00, 0x1C, 0xC8, 0x3C, 0x9F, 0x00, 0x06, 0x40, 0x01, 0x10, 0x46, 0x08, 0x3E, 0xFE, 0x08, 0x00, 0x84, 0x85, 0x3C, 0x40, 0x09, 0x12, 0x8E, 0x00, 0x18, 0x41, 0x12, 0xF1,
+    0x1F, 0x43, 0x38, 0x1F, 0x80, 0x78, 0x35, 0x8A, 0x00, 0x3A, 0x47, 0x7C, 0x02, 0x81, 0x78, 0x00, 0xFA, 0xFB, 0x02, 0x99, 0x00, 0x22, 0x43, 0x40, 0xC3, 0x45, 0x44, 0x3B, 0x41, 0x88, 0xF7, 0x3E,
+    0x40, 0x0F, 0xC1, 0x11, 0x40, 0xE5, 0x01, 0x40, 0xE0, 0x1D, 0x43, 0xA6, 0x44, 0x09, 0x80, 0x21, 0x84, 0x00, 0x03, 0x44, 0x40, 0x42, 0x42, 0x7E, 0x40, 0x2C, 0x40, 0xFC, 0x82, 0x94, 0x2D, 0x42,
+    0x94, 0x94, 0xFC, 0xC1, 0x06, 0x43, 0xF0, 0x48, 0x78, 0xC0, 0x0E, 0x43, 0x24, 0x64, 0xE4, 0x1C, 0x09, 0x45, 0x84, 0x85, 0x84, 0xFC, 0x00, 0x00, 0xC0, 0x18, 0x43, 0x11, 0xF0, 0x10, 0x01, 0x10,
+    0x40, 0x01, 0x05, 0x85, 0x00, 0x00, 0x41, 0x1C, 0x81, 0xC0, 0x19, 0x48, 0xF2, 0x12, 0x1F, 0x12, 0xF2, 0x00, 0x24, 0xC3, 0xF8, 0x13, 0x44, 0x00, 0xF8, 0x00, 0x00, 0xC0, 0x04, 0x43, 0x20, 0x22,
+    0xFF, 0xE2, 0x19, 0x43, 0xFA, 0x02, 0x03, 0xC2, 0x38, 0x46, 0x08, 0x06, 0x01, 0x00, 0x06, 0x01, 0x01, 0x1D, 0x43, 0x08, 0x86, 0xF5, 0x47, 0x19, 0x42, 0x87, 0xF2, 0x43, 0x1F, 0x43, 0x78, 0x4F,
+    0xC0, 0x40, 0x37, 0x41, 0x84, 0x6F, 0xC0, 0x01, 0x42, 0x10, 0x0C, 0x03, 0x28, 0x89, 0x00, 0x03, 0x42, 0x04, 0x03, 0x1F, 0x1F, 0x42, 0x8F, 0x83, 0x84, 0x3A, 0x43, 0x20, 0x10, 0xFC, 0x03, 0xC0,
+    0x2C, 0x42, 0x84, 0xFC, 0x84, 0x0B, 0x43, 0xC5, 0x29, 0x3D, 0x43, 0xC0, 0x05, 0x43, 0x0E, 0x80, 0x41, 0x38, 0x31, 0x40, 0x84, 0x16, 0x42, 0x08, 0xF8, 0x08, 0x2E, 0x40, 0x01, 0xC0, 0x0B, 0x84,
+    0x01, 0x18, 0x8F, 0x00, 0x3A, 0x44, 0x54, 0x52, 0xF1, 0x48, 0x60, 0x31, 0x40, 0xE0, 0x20, 0x44, 0xC4, 0xBC, 0xE7, 0x20, 0x00, 0x0D, 0x43, 0x46, 0x45, 0xC7, 0x40, 0x0F, 0x41, 0xE0, 0x2C, 0xC0,
+    0x15, 0x44, 0x80, 0x79, 0x4D, 0xC7, 0x40, 0x0E, 0x42, 0x10, 0x0F, 0x01, 0xC0, 0x28, 0x43, 0x01, 0xF0, 0x0C, 0x03, 0xC1, 0x21, 0x40, 0x08, 0x83, 0x00, 0xC0, 0x18, 0x43, 0x60, 0xF0, 0x0C, 0x00,
+    0xC0, 0x3B, 0x43, 0x04, 0xF7, 0x34, 0x0C, 0x27, 0x42, 0x50, 0x50, 0xF1, 0x0F, 0x43, 0x08, 0xC9, 0x28, 0x38, 0x3C, 0x42, 0xE6, 0x11, 0x10, 0x28, 0x42, 0x02, 0x02, 0x03, 0x10, 0x41, 0x21, 0xFE,
+    0x3E, 0x43, 0x43, 0xFD, 0x44, 0x40, 0x1C, 0x43, 0x80, 0x61, 0xCE, 0x00, 0xC0, 0x19, 0x42, 0x7C, 0x53, 0xDF, 0x1E, 0x44, 0xE3, 0x70, 0x00, 0xE7, 0x04, 0x04, 0x83, 0x42, 0x21, 0x43, 0xC8, 0x28,
+    0xFE, 0x08, 0x8B, 0x00, 0xC0, 0x30, 0x41, 0x85, 0xFD, 0x24, 0x43, 0x05, 0xF4, 0x1C, 0x04, 0x37, 0x41, 0x3E, 0xFE, 0xC0, 0x01, 0x40, 0x09, 0x30, 0x42, 0x21, 0x20, 0xE0, 0x06, 0x41, 0x02, 0x01,
+    0xC0, 0x02, 0x41, 0xC1, 0x3D, 0x2E, 0x43, 0x02, 0x02, 0x03, 0x02, 0x1E, 0x41, 0xA1, 0x63, 0x0B, 0x84, 0x00, 0x17, 0x40, 0x03, 0x1B, 0x8F, 0x00, 0x18, 0x42, 0xE0, 0x28, 0x66, 0x01, 0x43, 0x96,
+    0x91, 0x91, 0x90, 0x03, 0x43, 0x00, 0x47, 0x44, 0xC4, 0x0B, 0x41, 0x80, 0x60, 0x82, 0x00, 0x36, 0x40, 0x80, 0x24, 0x43, 0x08, 0x08, 0x09, 0x0E, 0x02, 0x41, 0x10, 0x0F, 0xC1, 0x00, 0x43, 0x50,
+    0x48, 0xC6, 0x01, 0x15, 0x41, 0xDF, 0x80, 0x2A, 0x44, 0x00, 0x88, 0x88, 0xF8, 0x80, 0x0E, 0x93, 0x00, 0xC0, 0x04, 0x44, 0x00, 0x87, 0x40, 0x20, 0x1C, 0x0E, 0x41, 0x84, 0xFC, 0xC0, 0x2A, 0x83,
+    0x10, 0x03, 0x40, 0x84, 0x84, 0x00, 0x34, 0x44, 0x00, 0xF9, 0x64, 0x14, 0xF8, 0x37, 0x40, 0x10, 0x01, 0x40, 0x00, 0x05, 0x41, 0x50, 0x70, 0x39, 0x40, 0x89, 0xC0, 0x0A, 0x43, 0xC0, 0x42, 0x72,
+    0xC3, 0xC0, 0x3B, 0x43, 0x01, 0x08, 0x04, 0x03, 0x2D, 0x43, 0xD7, 0x22, 0x03, 0xC0, 0x8F, 0x00, 0x34, 0x43, 0x24, 0x30, 0xBF, 0x61, 0x32, 0x42, 0xC8, 0x04, 0x82, 0xC0, 0x05, 0x44, 0x04, 0x02,
+    0x1F, 0x01, 0x06, 0x43, 0x84, 0xFC, 0x84, 0x00, 0x14, 0x44, 0xFC, 0x30, 0x48, 0x84, 0x84, 0x34, 0x43, 0xC5, 0x29, 0x3D, 0x43, 0x1E, 0x43, 0x20, 0x10, 0xFC, 0x03, 0x05, 0x40, 0x42, 0x17, 0x43,
+    0x82, 0xA2, 0xE2, 0x9C, 0x35, 0x40, 0x04, 0x23, 0x40, 0x01, 0x31, 0x44, 0x3C, 0x04, 0x07, 0x84, 0x7C, 0xC0, 0x36, 0x47, 0x38, 0x1F, 0x80, 0x78, 0x00, 0x90, 0x52, 0x31, 0xC0, 0x14, 0x43, 0xC0,
+    0x42, 0x72, 0xC3, 0x1E, 0x42, 0x24, 0xA2, 0x61, 0x01, 0x42, 0x43, 0x72, 0xC2, 0x23, 0x42, 0xF3, 0x10, 0xF0, 0x2D, 0x43, 0x41, 0x08, 0x04, 0x03, 0xC0, 0x0A, 0x42, 0x07, 0x02, 0x07, 0x1A, 0x8E,
+    0x00, 0xC0, 0x30, 0x42, 0x00, 0x80, 0x60, 0x03, 0x42, 0x0C, 0x06, 0xFE, 0x87, 0x00, 0x03, 0x85, 0x00, 0xC1, 0x25, 0x93, 0x00, 0xC1, 0x31, 0x42, 0x39, 0x48, 0x98, 0x06, 0x43, 0x0A, 0x09, 0x08,
+    0x08, 0x0E, 0x84, 0x00, 0xC0, 0x1C, 0x40, 0xC2, 0x02, 0x86, 0x00, 0x83, 0x01, 0x0E, 0x40, 0x40, 0xC1, 0x08, 0x42, 0xC8, 0x84, 0xC3, 0x06, 0x84, 0x00, 0xC0, 0x1D, 0x47, 0x48, 0x49, 0xFE, 0x40,
+    0x40, 0x80, 0x70, 0xCF, 0x0A, 0x42, 0x11, 0x0C, 0x03, 0x05, 0x43, 0x00, 0x90, 0x90, 0x20, 0x05, 0x44, 0x80, 0xA0, 0xE3, 0xBC, 0xA1, 0xC0, 0x14, 0x42, 0x0C, 0x13, 0x1F, 0x01, 0x40, 0x03, 0x01,
+    0x41, 0x07, 0x54, 0x1B, 0x41, 0x00, 0x00, 0x1C, 0x42, 0x8C, 0x06, 0xFE, 0x86, 0x00, 0x04, 0x83, 0x08, 0xC5, 0x2C, 0x43, 0x24, 0x25, 0x25, 0xE0, 0xC0, 0x3B, 0x43, 0xF8, 0x04, 0x03, 0xC0, 0x22,
+    0x44, 0xE1, 0x28, 0x3C, 0x23, 0xE0, 0xC0, 0x09, 0x43, 0xC7, 0x22, 0x27, 0xC0, 0x2C, 0x44, 0x01, 0x00, 0x10, 0x0C, 0x03, 0xC0, 0x09, 0x43, 0x07, 0x08, 0x08, 0x07, 0x1A, 0x8D, 0x00, 0x26, 0x40,
+    0x82, 0x01, 0x41, 0x86, 0x80, 0xC0, 0x03, 0x42, 0x00, 0x00, 0xE0, 0xC1, 0x0D, 0x44, 0x04, 0x04, 0xFC, 0x04, 0x04, 0xC0, 0x22, 0x42, 0xFC, 0x14, 0x1D, 0x15, 0x42, 0x10, 0x10, 0xF0, 0x2D, 0x92,
+    0x00, 0x3B, 0x83, 0x09, 0x2C, 0x40, 0xC8, 0x1B, 0x43, 0xE0, 0x91, 0xF1, 0x80, 0xC0, 0x00, 0x84, 0x00, 0x35, 0x43, 0xFB, 0x00, 0x00, 0xC3, 0xC0, 0x01, 0x41, 0x60, 0xC0, 0xC0, 0x1A, 0x43, 0x9C,
+    0x93, 0x9F, 0x80, 0x27, 0x44, 0x91, 0x9C, 0x93, 0x90, 0x80, 0x08, 0x44, 0x40, 0x4F, 0xC4, 0x4F, 0x40, 0xC0, 0x00, 0x43, 0x00, 0x10, 0x0C, 0x03, 0x28, 0x41, 0x10, 0x0F, 0x0A, 0x42, 0x00, 0x00,
+    0xCF, 0x1F, 0x43, 0xAF, 0x23, 0xA4, 0x68, 0xC0, 0x0D, 0x43, 0x8D, 0x42, 0x20, 0x1C, 0xC0, 0x00, 0x85, 0x00, 0xC1, 0x11, 0x44, 0x10, 0x8A, 0x52, 0x7A, 0x86, 0xC0, 0x3B, 0x43, 0x71, 0x6E, 0xF8,
+    0x08, 0xC0, 0x0F, 0x43, 0x06, 0xF9, 0x08, 0x80, 0x0A, 0x42, 0x49, 0x49, 0x91, 0x0C, 0x41, 0xE3, 0x20, 0x0A, 0x42, 0x44, 0x73, 0xC1, 0xC0, 0x10, 0x44, 0x43, 0xFA, 0x22, 0x23, 0xE5, 0x09, 0x42,
+    0x03, 0x02, 0x04, 0x06, 0x42, 0x00, 0xF8, 0x06, 0x01, 0x42, 0x94, 0x97, 0x94, 0xC0, 0x1E, 0x47, 0x92, 0x91, 0x9F, 0x81, 0x01, 0xC0, 0x90, 0xCC, 0x0A, 0x49, 0x20, 0x31, 0xED, 0x27, 0x20, 0x00,
+    0x58, 0x4F, 0xFC, 0x43, 0x18, 0x83, 0x00, 0x18, 0x44, 0x97, 0x98, 0x98, 0x97, 0x80, 0x27, 0x42, 0x80, 0x90, 0x8C, 0x01, 0x42, 0x11, 0x0C, 0x03, 0x0A, 0x44, 0x04, 0xE4, 0x07, 0x04, 0xE4, 0x01,
+    0x47, 0x93, 0x5F, 0x40, 0x00, 0x23, 0x20, 0x20, 0xE7, 0x13, 0x42, 0xA0, 0x40, 0x00, 0x1A, 0x41, 0x10, 0x0F, 0x1B, 0x8D, 0x00, 0x83, 0x00, 0xC0, 0x18, 0x98, 0x00, 0x22, 0x43, 0x04, 0xF4, 0x1C,
+    0x04, 0xC0, 0x3A, 0x44, 0xC0, 0xB1, 0x8C, 0xC0, 0x00, 0xC0, 0x3D, 0x40, 0x11, 0x22, 0x92, 0x00, 0xC0, 0x18, 0x44, 0x00, 0x74, 0x93, 0x91, 0xF0, 0x0F, 0x42, 0x20, 0xFC, 0xE0, 0xC0, 0x1F, 0x83,
+    0x00, 0x03, 0x44, 0x00, 0xC3, 0x84, 0xC4, 0x07, 0xC0, 0x22, 0x44, 0x00, 0x91, 0x6D, 0xC7, 0x00, 0x09, 0x40, 0xE0, 0x01, 0x45, 0xE0, 0x00, 0x50, 0xFF, 0x21, 0x20, 0xC0, 0x27, 0x45, 0x00, 0xE3,
+    0x00, 0x00, 0xE7, 0x04, 0x0C, 0x49, 0x00, 0x82, 0x01, 0x1F, 0x81, 0x81, 0x20, 0x30, 0xEF, 0x40, 0x2C, 0x43, 0x0F, 0xE3, 0x24, 0x08, 0x03, 0x44, 0x18, 0x07, 0xC4, 0x3C, 0x04, 0x22, 0x43, 0x1C,
+    0x83, 0x72, 0x0E, 0x14, 0x43, 0x09, 0x89, 0x79, 0x0F, 0x36, 0x84, 0x00, 0x40, 0x21, 0x11, 0x42, 0xFF, 0x08, 0x10, 0x82, 0x00, 0x0D, 0x43, 0xC1, 0x31, 0x1F, 0xE2, 0x14, 0x40, 0x01, 0xC0, 0x12,
+    0x40, 0xB0, 0x11, 0x43, 0x1A, 0x84, 0x40, 0x38, 0xC0, 0x05, 0x43, 0x1A, 0x84, 0x40, 0x38, 0xC0, 0x3B, 0x40, 0x01, 0xC1, 0x2F, 0x43, 0xF7, 0x04, 0x04, 0xF0, 0xC0, 0x28, 0x43, 0xD1, 0x8D, 0x87,
+    0xC0, 0x05, 0x43, 0x40, 0x50, 0xFF, 0x40, 0x05, 0x41, 0xF8, 0x27, 0x0F, 0x44, 0x00, 0xEF, 0x74, 0x0F, 0xE0, 0xC0, 0x05, 0x40, 0x91, 0x01, 0x41, 0x80, 0x80, 0x09, 0x44, 0x4F, 0x83, 0x01, 0x8F,
+    0x00, 0x04, 0x44, 0x2C, 0x33, 0x3F, 0xE0, 0x50, 0x17, 0x43, 0x10, 0xC8, 0x86, 0x01, 0x13, 0x43, 0xC0, 0x50, 0x4F, 0xC0, 0xC2, 0x04, 0x44, 0x03, 0xE2, 0x1A, 0x06, 0x02, 0x02, 0x43, 0xC8, 0x28,
+    0xFE, 0x08, 0x0B, 0x98, 0x00, 0x09, 0x84, 0x00, 0x0E, 0x83, 0x00, 0x0E, 0x44, 0x04, 0x84, 0x64, 0x1C, 0x00, 0x21, 0x41, 0x01, 0x01, 0x0C, 0x40, 0xF8, 0x22, 0x40, 0xF4, 0x12, 0x41, 0xFC, 0x90,
+    0x01, 0x43, 0x38, 0x1C, 0x81, 0x78, 0x09, 0x41, 0x39, 0x1C, 0xC0, 0x2E, 0x44, 0xF0, 0x14, 0x1E, 0x11, 0xF0, 0x21, 0x40, 0x40, 0x92, 0x00, 0x3A, 0x44, 0x10, 0x13, 0xD2, 0xD4, 0x30, 0x27, 0x47,
+    0xC0, 0xBC, 0xE3, 0x20, 0x00, 0x80, 0xF0, 0x40, 0xC0, 0x0B, 0x41, 0x18, 0x07, 0x0D, 0x41, 0xF8, 0xCF, 0x85, 0x00, 0x13, 0x42, 0xF1, 0x7D, 0x07, 0xC0, 0x1E, 0x48, 0x10, 0x2C, 0x2B, 0x2F, 0xE0,
+    0x40, 0x40, 0xC0, 0x00, 0x0F, 0x84, 0x00, 0xC0, 0x26, 0x44, 0x24, 0x1F, 0xF2, 0x12, 0x10, 0x21, 0x44, 0x00, 0x82, 0x42, 0x32, 0x0E, 0xC0, 0x15, 0x40, 0x01, 0x23, 0x44, 0x84, 0x84, 0xFC, 0x84,
+    0x84, 0x04, 0x44, 0x00, 0xDC, 0x24, 0x24, 0xFC, 0x27, 0x42, 0x38, 0x90, 0x78, 0x37, 0x84, 0x00, 0x43, 0x1D, 0x00, 0x80, 0x70, 0x05, 0x83, 0x08, 0x06, 0x42, 0x1D, 0x81, 0x79, 0x27, 0x41, 0x02,
+    0x01, 0x38, 0x41, 0x00, 0xF8, 0x01, 0x43, 0xC0, 0x42, 0x71, 0xC0, 0xC3, 0x11, 0x42, 0x8F, 0xF4, 0x03, 0xC0, 0x3C, 0x41, 0x83, 0x43, 0x0B, 0x41, 0x81, 0xFF, 0x01, 0x43, 0x00, 0xF0, 0x8F, 0x80,
+    0x3A, 0x89, 0x00, 0x11, 0x43, 0x38, 0x08, 0x8E, 0x78, 0x33, 0x44, 0x02, 0xE2, 0x1A, 0x06, 0x02, 0xC0, 0x03, 0x40, 0x01, 0xC1, 0x03, 0x98, 0x00, 0xC0, 0x0D, 0x43, 0x10, 0x12, 0xFF, 0xF0, 0x15,
+    0x41, 0x90, 0xF0, 0x14, 0x44, 0x08, 0x09, 0xF8, 0x08, 0x08, 0x06, 0x82, 0x00, 0xC0, 0x43, 0x04, 0x03, 0x02, 0x03, 0x2C, 0x84, 0x01, 0x05, 0x44, 0x40, 0xF8, 0x20, 0x20, 0xE1, 0x3A, 0x92, 0x00,
+    0xC0, 0x18, 0x42, 0x11, 0x0C, 0xF3, 0x8B, 0x00, 0x05, 0x42, 0xE0, 0xA0, 0xA0, 0xC0, 0x1D, 0x84, 0x00, 0x04, 0x42, 0x0C, 0xE3, 0x80, 0x30, 0x42, 0x94, 0x94, 0xFC, 0xC0, 0x01, 0x44, 0xC4, 0x34,
+    0xFF, 0x04, 0x04, 0xC0, 0x2A, 0x44, 0x80, 0x84, 0xFC, 0x85, 0x80, 0x0B, 0x40, 0x15, 0xC0, 0x15, 0x43, 0x83, 0x63, 0x3E, 0xC4, 0x32, 0x42, 0x51, 0x50, 0xF0, 0x86, 0x00, 0x04, 0x84, 0x00, 0x34,
+    0x40, 0x01, 0x01, 0x82, 0x01, 0x31, 0x41, 0x72, 0xC3, 0x0C, 0x42, 0x48, 0xF8, 0x00, 0x2C, 0x43, 0xE3, 0x12, 0x13, 0xE0, 0x36, 0x83, 0x00, 0xC0, 0x00, 0x43, 0x03, 0x04, 0x04, 0x03, 0x36, 0x82,
+    0x90, 0x40, 0x80, 0x0A, 0x40, 0xF8, 0x01, 0x40, 0xF0, 0x09, 0x43, 0x00, 0x80, 0x70, 0x0F, 0x0A, 0x43, 0x51, 0x4C, 0xC3, 0x40, 0x22, 0x43, 0xC7, 0x28, 0x28, 0xC7, 0x85, 0x00, 0x31, 0x42, 0x10,
+    0x08, 0x07, 0x0A, 0x43, 0x06, 0x25, 0x24, 0x2E, 0x0A, 0x42, 0x10, 0xEF, 0x81, 0x23, 0x43, 0xC7, 0x48, 0x48, 0xC7, 0x05, 0x42, 0xEF, 0xE3, 0x04, 0xC0, 0x04, 0x83, 0x08, 0x1D, 0x43, 0x6E, 0x92,
+    0x92, 0xFE, 0x8A, 0x00, 0xC0, 0x0E, 0x43, 0x09, 0x09, 0xC9, 0x38, 0x83, 0x00, 0x1B, 0x40, 0x84, 0x0B, 0x42, 0xC0, 0x31, 0x0F, 0xC0, 0x0C, 0x40, 0x91, 0xC1, 0x15, 0x97, 0x00, 0x22, 0x4A, 0x00,
+    0x24, 0xE2, 0x21, 0x00, 0x00, 0x4C, 0x4B, 0xC8, 0x48, 0x40, 0x02, 0x44, 0x20, 0x24, 0xE2, 0x21, 0x20, 0x31, 0x40, 0xF8, 0x01, 0x40, 0xC0, 0x22, 0x44, 0x01, 0x28, 0x24, 0x23, 0x20, 0x0F, 0x47,
+    0x04, 0xF7, 0x04, 0x00, 0x00, 0x90, 0x98, 0x97, 0x05, 0x42, 0xF0, 0x07, 0x00, 0x1B, 0x42, 0xC4, 0xA4, 0x23, 0x36, 0x84, 0x00, 0x43, 0xC4, 0x84, 0xC4, 0x04, 0x35, 0x85, 0x00, 0x43, 0x07, 0x08,
+    0x08, 0x07, 0x09, 0x43, 0x07, 0x88, 0x68, 0x07, 0x29, 0x45, 0x80, 0x80, 0x00, 0x00, 0xB1, 0x4C, 0x01, 0x85, 0x00, 0x09, 0x43, 0x4C, 0x43, 0x43, 0xC0, 0x1D, 0x41, 0x90, 0x88, 0x03, 0x42, 0x80,
+    0x40, 0x40, 0x0D, 0x44, 0x04, 0xC3, 0x5F, 0x40, 0xC0, 0x0D, 0x44, 0x1E, 0x02, 0x03, 0xC2, 0x3E, 0xC0, 0x3C, 0x40, 0xE3, 0x1F, 0x43, 0x12, 0x32, 0xF2, 0x0E, 0x05, 0x89, 0x00, 0x12, 0x42, 0xFD,
+    0x14, 0x1C, 0xC1, 0x0A, 0x43, 0x70, 0x10, 0x1C, 0xF0, 0xC0, 0x01, 0x43, 0x25, 0x24, 0x24, 0xE0, 0x36, 0x41, 0x02, 0x01, 0x34, 0x42, 0x24, 0xE3, 0x20, 0x84, 0x00, 0x05, 0x42, 0x70, 0x94, 0x93,
+    0xC0, 0x06, 0x42, 0xF1, 0x11, 0xF1, 0x24, 0x42, 0x94, 0x97, 0x94, 0xC0, 0x14, 0x42, 0x07, 0x02, 0x07, 0x32, 0x43, 0x11, 0x1C, 0xF3, 0x20, 0x0A, 0x43, 0x91, 0x9D, 0x97, 0x80, 0x05, 0x43, 0x17,
+    0x18, 0xF8, 0x27, 0x36, 0x84, 0x00, 0x26, 0x43, 0x0C, 0xE3, 0x81, 0x8E, 0x0A, 0x43, 0x80, 0x90, 0x8C, 0x03, 0x05, 0x43, 0x0C, 0x03, 0x01, 0x0E, 0x26, 0x84, 0x00, 0xC5, 0x43, 0x31, 0xE0, 0xE0,
+    0x10, 0x1D, 0x43, 0xF1, 0x50, 0x50, 0x51, 0xC0, 0x00, 0x85, 0x00, 0x12, 0x43, 0x73, 0x90, 0x91, 0xF2, 0x1D, 0x40, 0x03, 0x82, 0x02, 0x0A, 0x97, 0x00, 0x1D, 0x43, 0x00, 0xC0, 0xB8, 0xE0, 0x13,
+    0x43, 0x20, 0x23, 0xA4, 0xE4, 0x2D, 0x42, 0xD0, 0x20, 0x00, 0xC0, 0x0B, 0x42, 0x17, 0x18, 0xF8, 0x23, 0x43, 0x47, 0xF8, 0x28, 0x27, 0x38, 0x41, 0xC8, 0x87, 0x2E, 0x83, 0x00, 0x43, 0x4C, 0x43,
+    0x41, 0xCE, 0x08, 0x45, 0x00, 0xC2, 0x41, 0x5F, 0xC1, 0x01, 0xC0, 0x0D, 0x43, 0xFC, 0x14, 0x1C, 0x00, 0x04, 0x44, 0x00, 0x04, 0xF4, 0x1C, 0x04, 0x0A, 0x44, 0x04, 0x84, 0x7F, 0x04, 0x04, 0x12,
+    0x40, 0x84, 0xC0, 0x0C, 0x43, 0x00, 0x94, 0x94, 0xFC, 0x16, 0x40, 0xFD, 0xC0, 0x06, 0x44, 0x08, 0x08, 0xF8, 0x08, 0x08, 0x0E, 0x43, 0x12, 0x12, 0x13, 0xFE, 0x05, 0x41, 0x82, 0x62, 0xC0, 0x21,
+    0x40, 0x01, 0x10, 0x43, 0x11, 0x11, 0xFF, 0xF1, 0x1D, 0x43, 0x24, 0x26, 0x25, 0xFC, 0x24, 0x44, 0x51, 0x51, 0xF1, 0x49, 0x40, 0xC0, 0x11, 0x82, 0x02, 0x40, 0x03, 0x24, 0x42, 0x10, 0xDC, 0xD3,
+    0x18, 0x43, 0x00, 0x03, 0x04, 0xF4, 0xC0, 0x3C, 0x43, 0x0C, 0x03, 0xC0, 0x30, 0x0A, 0x42, 0x11, 0x8D, 0x67, 0x86, 0x00, 0xC0, 0x26, 0x43, 0x02, 0xE1, 0x9F, 0x80, 0x09, 0x43, 0x04, 0x83, 0x9F,
+    0x80, 0x86, 0x00, 0x0D, 0x43, 0x02, 0xE1, 0x3F, 0x01, 0x18, 0x83, 0x00, 0x40, 0x04, 0x92, 0x00, 0xC3, 0x08, 0x89, 0x00, 0x13, 0x44, 0x12, 0x12, 0xF2, 0x12, 0x10, 0xC0, 0x1F, 0x40, 0x80, 0x1A,
+    0x41, 0x02, 0x01, 0xC2, 0x0A, 0x44, 0x10, 0x10, 0xD7, 0xD0, 0x30, 0x19, 0x44, 0x43, 0x44, 0xFC, 0x43, 0x40, 0x12, 0x98, 0x00, 0x43, 0x97, 0x92, 0x97, 0xF0, 0x2C, 0x42, 0x58, 0xFF, 0x20, 0x1B,
+    0x43, 0x10, 0xFF, 0x2F, 0x08, 0x12, 0x43, 0xC0, 0x00, 0x80, 0x40, 0x14, 0x42, 0x10, 0x08, 0x07, 0x32, 0x42, 0x82, 0x81, 0x9F, 0x8A, 0x00, 0x03, 0x89, 0x00, 0x22, 0x43, 0x0F, 0x80, 0x70, 0x0F,
+    0x18, 0x43, 0xFF, 0x40, 0x60, 0x18, 0x00, 0x84, 0x00, 0x2C, 0x40, 0x20, 0x20, 0x84, 0x00, 0x04, 0x40, 0x13, 0xC2, 0x3D, 0x44, 0x10, 0x10, 0xF1, 0x10, 0x10, 0xC0, 0x3C, 0x40, 0x03, 0x1A, 0x42,
+    0x23, 0xA2, 0x62, 0x15, 0x43, 0x72, 0x3A, 0x03, 0xF0, 0x0A, 0x44, 0x49, 0x49, 0xC9, 0x49, 0x40, 0x18, 0x84, 0x00, 0x34, 0x42, 0x07, 0x04, 0x04, 0x15, 0x42, 0x08, 0x04, 0x03, 0x0B, 0x41, 0x90,
+    0x98, 0x1B, 0x42, 0xC0, 0x80, 0x80, 0xC1, 0x09, 0x40, 0x20, 0x22, 0x44, 0x8C, 0x83, 0xF1, 0x8E, 0x80, 0x1C, 0x93, 0x00, 0xC0, 0x3A, 0x84, 0x00, 0x13, 0x44, 0xF8, 0x04, 0x02, 0x1C, 0x60, 0x03,
+    0x43, 0x12, 0x32, 0xF2, 0x0E, 0x2C, 0x40, 0xFC, 0xC0, 0x05, 0x40, 0x12, 0xC2, 0x3D, 0x43, 0xC3, 0x32, 0x63, 0x80, 0xC0, 0x14, 0x43, 0x24, 0x27, 0x24, 0xE0, 0x83, 0x00, 0x1E, 0x44, 0xC1, 0x00,
+    0x80, 0x43, 0x42, 0xC0, 0x13, 0x42, 0x88, 0x64, 0x03, 0x23, 0x43, 0x1F, 0x13, 0xF4, 0x28, 0x08, 0x44, 0xC0, 0x67, 0xE8, 0x08, 0x07, 0x05, 0x98, 0x00, 0x18, 0x43, 0x50, 0x88, 0x07, 0x80, 0x1A,
+    0x42, 0xFF, 0x80, 0x80, 0x21, 0x42, 0x00, 0xEF, 0x20, 0x86, 0x00, 0x41, 0xE0, 0xE0, 0xA0, 0x00, 0x09, 0x43, 0x1C, 0x62, 0xA2, 0x9C, 0x35, 0x43, 0x38, 0x08, 0x8E, 0x78, 0x85, 0x00, 0x09, 0x83,
+    0x42, 0x28, 0x89, 0x00, 0x08, 0x98, 0x00, 0x13, 0x40, 0xF9, 0x0C, 0x84, 0x00, 0x40, 0xFC, 0x2D, 0x40, 0x40, 0x16, 0x82, 0x84, 0x30, 0x40, 0x08, 0x3A, 0x42, 0x10, 0xF0, 0x10, 0x86, 0x00, 0x21,
+    0x88, 0x00, 0x12, 0x44, 0x08, 0x88, 0xEE, 0x59, 0x80, 0x32, 0x43, 0x52, 0x53, 0xF2, 0x48, 0x1E, 0x42, 0xFB, 0x00, 0x80, 0x05, 0x42, 0x50, 0x50, 0xF0, 0x18, 0x44, 0x01, 0x00, 0x07, 0x00, 0x01,
+    0xC0, 0x14, 0x43, 0x0C, 0x07, 0x02, 0x01, 0x31, 0x41, 0x88, 0x64, 0xC0, 0x3C, 0x43, 0x06, 0x05, 0x04, 0x0E, 0x0A, 0x41, 0xF0, 0x90, 0xC0, 0x3D, 0x42, 0x0F, 0x00, 0x01, 0x30, 0x42, 0x1C, 0xC8,
+    0x3C, 0x8F, 0x00, 0xC0, 0x2C, 0x42, 0x85, 0xFC, 0x84, 0x90, 0x00, 0xC0, 0x21, 0x88, 0x00, 0xC0, 0x36, 0x40, 0x38, 0x03, 0x40, 0x30, 0x38, 0x44, 0x00, 0x12, 0xD1, 0x70, 0x10, 0xC0, 0x3A, 0x43,
+    0x00, 0x74, 0x3B, 0x00, 0x0B, 0x43, 0x21, 0xF9, 0xF9, 0x21, 0x89, 0x00, 0xC0, 0x09, 0x41, 0x87, 0x64, 0x25, 0x42, 0x98, 0x94, 0x93, 0x1A, 0x84, 0x00, 0x33, 0x4A, 0x06, 0x05, 0x04, 0x0E, 0x00,
+    0x00, 0x47, 0x48, 0xF8, 0x47, 0x40, 0x3B, 0x43, 0x40, 0x80, 0x00, 0x80, 0x2D, 0x42, 0x43, 0x41, 0x8E, 0x89, 0x00, 0x44, 0xE7, 0xE0, 0x1F, 0x0F, 0x08, 0x04, 0x97, 0x00, 0xC0, 0x2B, 0x44, 0xF8,
+    0x04, 0x02, 0x1C, 0x60, 0x04, 0x42, 0x69, 0x49, 0x92, 0x85, 0x00, 0x40, 0xC0, 0x09, 0x43, 0x09, 0x89, 0x79, 0x0F, 0xC0, 0x44, 0x38, 0x06, 0x0C, 0x70, 0x40, 0x23, 0x40, 0x30, 0x0C, 0x84, 0x00,
+    0x40, 0x01, 0xC0, 0x07, 0x84, 0x00, 0x26, 0x40, 0xE8, 0x04, 0x40, 0x50, 0xC0, 0x0B, 0x44, 0x00, 0x00, 0xC0, 0x3C, 0x00, 0xC1, 0x0F, 0x43, 0x6C, 0x13, 0x00, 0xE0, 0xC0, 0x05, 0x44, 0x4C, 0x47,
+    0xFA, 0x41, 0x40, 0x0D, 0x45, 0x90, 0x91, 0x90, 0xF0, 0x03, 0x02, 0x1C, 0x42, 0x84, 0x62, 0x01, 0xC0, 0x06, 0x44, 0x07, 0x00, 0x1F, 0x0F, 0x08, 0x0D, 0x44, 0x08, 0x18, 0x18, 0xFF, 0x20, 0x83,
+    0x00, 0x18, 0x44, 0xE6, 0x25, 0x3C, 0x2E, 0xE0, 0xC0, 0x40, 0xE1, 0x01, 0x40, 0x9F, 0x8A, 0x00, 0x09, 0x44, 0x80, 0x8C, 0xF3, 0x81, 0x0E, 0x1C, 0x44, 0x01, 0x00, 0x10, 0x0C, 0x03, 0xC3, 0x18,
+    0x96, 0x00, 0xC0, 0x29, 0x42, 0x1C, 0x80, 0x78, 0x0E, 0x83, 0x00, 0xC0, 0x3B, 0x43, 0x70, 0x90, 0x90, 0xF0, 0x0A, 0x88, 0x00, 0x12, 0x43, 0x41, 0x40, 0xF7, 0x40, 0xC0, 0x20, 0x41, 0xB8, 0xE0,
+    0x18, 0x42, 0x06, 0x09, 0x0F, 0xC0, 0x03, 0x89, 0x00, 0x2A, 0x43, 0x38, 0x08, 0x8E, 0x78, 0xC0, 0x07, 0x40, 0xF8, 0x25, 0x41, 0x1F, 0xFF, 0x06, 0x45, 0x38, 0x08, 0x8E, 0x78, 0x00, 0x01, 0x0D,
+    0x43, 0xC0, 0xB1, 0x8C, 0xC0, 0xC0, 0x1E, 0x40, 0x01, 0x08, 0x40, 0x1B, 0x0D, 0x86, 0x00, 0x40, 0x01, 0x19, 0x88, 0x00, 0x23, 0x82, 0x00, 0x2D, 0x42, 0x40, 0x70, 0xC0, 0x1E, 0x42, 0x20, 0xE0,
+    0x20, 0x28, 0x40, 0xF0, 0x21, 0x83, 0x41, 0xC0, 0x3B, 0x82, 0x90, 0x37, 0x43, 0x47, 0xF0, 0xFF, 0x4F, 0x17, 0x44, 0x46, 0x45, 0xC4, 0x4E, 0x40, 0xC0, 0x01, 0x84, 0x00, 0x17, 0x42, 0x10, 0x09,
+    0x07, 0x1A, 0x40, 0x0F, 0x16, 0x43, 0x40, 0x50, 0xCC, 0x23, 0xC2, 0x04, 0x88, 0x00, 0x17, 0x44, 0x00, 0x09, 0x89, 0x79, 0x0F, 0xC0, 0x3B, 0x40, 0x11, 0x0D, 0x42, 0xD3, 0x92, 0x24, 0x85, 0x00,
+    0xC0, 0x0E, 0x43, 0xE1, 0x90, 0xF0, 0x81, 0x14, 0x43, 0x02, 0xFD, 0x00, 0xC0, 0x0A, 0x42, 0x08, 0xF8, 0x09, 0x04, 0x41, 0xFC, 0x10, 0x2B, 0x85, 0x00, 0x1B, 0x43, 0x73, 0x90, 0x30, 0x03, 0x14,
+    0x42, 0x6E, 0x13, 0x01, 0x13, 0x41, 0x03, 0x02, 0x2B, 0x43, 0x00, 0x00, 0xF0, 0x00, 0x1C, 0x43, 0x04, 0x84, 0x64, 0x07, 0x0D, 0xA2, 0x00, 0x26, 0x43, 0x6E, 0x92, 0x92, 0xFE, 0x33, 0x40, 0xE2,
+    0xC0, 0x27, 0x46, 0x80, 0x85, 0xFC, 0x84, 0x80, 0x42, 0x42, 0xC0, 0x03, 0x89, 0x00, 0x17, 0x43, 0x00, 0x09, 0xF8, 0x08, 0x01, 0x43, 0x09, 0x3E, 0xFE, 0x08, 0x19, 0x43, 0xE0, 0x18, 0x31, 0xC0,
+    0x0A, 0x96, 0x00, 0x13, 0x43, 0x10, 0x10, 0xFE, 0xF0, 0x1D, 0x47, 0x01, 0x01, 0xFD, 0x01, 0xC1, 0x00, 0x02, 0x01, 0x15, 0x88, 0x00, 0x41, 0x01, 0x01, 0x09, 0x42, 0x20, 0xE0, 0x20, 0x01, 0x41,
+    0x20, 0xE0, 0x32, 0x83, 0x00, 0x2C, 0x40, 0x00, 0x83, 0x20, 0x27, 0x43, 0xEC, 0x27, 0x22, 0xE1, 0x8E, 0x00, 0x0A, 0x46, 0x44, 0x27, 0xC0, 0x00, 0xC0, 0x20, 0x20, 0x01, 0x43, 0x99, 0x9F, 0x90,
+    0x80, 0x0A, 0x43, 0x44, 0x42, 0xC1, 0x40, 0xC0, 0x05, 0x43, 0x46, 0xF9, 0xF9, 0x4F, 0x86, 0x00, 0x41, 0x80, 0x60, 0x0E, 0x45, 0x40, 0x4F, 0xC0, 0x40, 0x41, 0x06, 0x05, 0x42, 0x10, 0x0C, 0x03,
+    0x09, 0x43, 0xE0, 0x30, 0x3F, 0x21, 0xC0, 0x06, 0x43, 0x50, 0x89, 0x07, 0x80, 0xC0, 0x16, 0x42, 0xFF, 0x08, 0x10, 0x8C, 0x00, 0xC0, 0x09, 0x43, 0x87, 0x40, 0x20, 0x1C, 0xC1, 0x30, 0x43, 0xC0,
+    0xB1, 0x8C, 0xC0, 0x14, 0x40, 0xF0, 0xC0, 0x03, 0x89, 0x00, 0x17, 0x44, 0x00, 0x00, 0xFC, 0x01, 0xC0, 0x13, 0x40, 0x11, 0x25, 0x8A, 0x00, 0x43, 0xE0, 0x13, 0x10, 0xE0, 0x0E, 0x43, 0x00, 0xC0,
+    0x30, 0x60, 0x05, 0x42, 0xC3, 0x30, 0x00, 0xC0, 0x16, 0x40, 0xD0, 0x04, 0x82, 0x00, 0x43, 0xE0, 0x23, 0x25, 0xE4, 0x17, 0x42, 0x03, 0x82, 0x42, 0x16, 0x42, 0xC4, 0x82, 0xC1, 0x8B, 0x00, 0x35,
+    0x41, 0x00, 0x00, 0x38, 0x42, 0x31, 0x3C, 0x23, 0xC0, 0x22, 0x44, 0x40, 0x40, 0xCF, 0x40, 0x40, 0x35, 0x44, 0x74, 0x04, 0xFF, 0xF4, 0x84, 0x3D, 0x45, 0x00, 0x04, 0x84, 0x7F, 0x04, 0x04, 0x38,
+    0x40, 0x01, 0x31, 0x43, 0x02, 0x72, 0x8A, 0x8E, 0x0A, 0x41, 0x84, 0xFD, 0xC0, 0x29, 0x46, 0x00, 0xF9, 0x64, 0x14, 0xF8, 0x00, 0x08, 0x0C, 0x40, 0xF8, 0x82, 0x28, 0xC0, 0x29, 0x40, 0xFD, 0x02,
+    0x44, 0x2A, 0x29, 0xF8, 0x24, 0x20, 0x08, 0x83, 0x01, 0x0B, 0x42, 0x48, 0x48, 0x90, 0x37, 0x88, 0x00, 0x18, 0x43, 0x4E, 0x4B, 0x49, 0xC0, 0x01, 0x41, 0x06, 0x01, 0x0E, 0x41, 0xC3, 0x3E, 0x04,
+    0x84, 0x00, 0x42, 0x03, 0x02, 0x04, 0x37, 0x40, 0x90, 0x01, 0x84, 0x00, 0x05, 0x83, 0x00, 0x0F, 0x43, 0xC0, 0x88, 0xC6, 0x01, 0x13, 0x40, 0x08, 0x04, 0x42, 0xC0, 0x80, 0xC0, 0x86, 0x00, 0xC0,
+    0x03, 0x43, 0x40, 0x40, 0xF8, 0x40,
+};
+// clang-format on
+#endif
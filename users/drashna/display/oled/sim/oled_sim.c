@@ -0,0 +1,326 @@
+// Copyright 2024 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @brief Host emulator for the OLED layouts.
+ *
+ * Links the real OLED code (oled_stuff.c) against a host copy of the OLED driver's buffer handling, and replays a
+ * trace of keyboard state changes on a virtual clock. The driver task runs every tick, like it does from the main
+ * loop, and only the blocks marked dirty reach the panel. Captures are written as plain PBM images of the panel, the
+ * same format as the OLED_CAPTURE keycode prints, so that they can be compared against reference images.
+ */
+
+#include "sim_host.h"
+#include "drashna.h"
+#include <errno.h>
+#include <getopt.h>
+#include <limits.h>
+
+#define SIM_TICK_US      1000
+#define SIM_TAIL_MS      1000
+#define SIM_KEYLOG_WIDTH 64
+
+typedef enum {
+    SIM_FIELD_WPM = 0,
+    SIM_FIELD_LAYER,
+    SIM_FIELD_DEFAULT_LAYER,
+    SIM_FIELD_MODS,
+    SIM_FIELD_LEDS,
+    SIM_FIELD_KEYMAP_CONFIG,
+    SIM_FIELD_USERSPACE_CONFIG,
+    SIM_FIELD_USER_STATE,
+    SIM_FIELD_SCAN_RATE,
+    SIM_FIELD_KEYLOG,
+    SIM_FIELD_CAPTURE,
+    SIM_FIELD_COUNT,
+} sim_field_t;
+
+static const char *const sim_field_names[SIM_FIELD_COUNT] = {
+    [SIM_FIELD_WPM]              = "wpm",
+    [SIM_FIELD_LAYER]            = "layer",
+    [SIM_FIELD_DEFAULT_LAYER]    = "default_layer",
+    [SIM_FIELD_MODS]             = "mods",
+    [SIM_FIELD_LEDS]             = "leds",
+    [SIM_FIELD_KEYMAP_CONFIG]    = "keymap_config",
+    [SIM_FIELD_USERSPACE_CONFIG] = "userspace_config",
+    [SIM_FIELD_USER_STATE]       = "user_state",
+    [SIM_FIELD_SCAN_RATE]        = "scan_rate",
+    [SIM_FIELD_KEYLOG]           = "keylog",
+    [SIM_FIELD_CAPTURE]          = "capture",
+};
+
+typedef struct {
+    uint64_t    time_us;
+    sim_field_t field;
+    uint32_t    value;
+    char        string[SIM_KEYLOG_WIDTH]; // keys typed, or the capture name
+} sim_event_t;
+
+static sim_event_t    *sim_events      = NULL;
+static size_t          sim_event_count = 0;
+static oled_rotation_t sim_rotation    = OLED_ROTATION_0;
+static const char     *sim_capture_dir = NULL;
+static const char     *sim_prefix      = "";
+static uint32_t        sim_captures    = 0;
+static uint32_t        sim_bad_frames  = 0;
+
+// stands in for the keymap, which is where the rotation comes from on the keyboard
+oled_rotation_t oled_init_keymap(oled_rotation_t rotation, bool has_run) {
+    return has_run ? rotation : sim_rotation;
+}
+
+/**
+ * @brief Reads a trace of state changes
+ *
+ * Each line is "<time_ms> <field> <value>", where the field is one of sim_field_names. Numeric values can be in any
+ * base that strtoul() accepts, keylog is the keys typed so far (with '_' for a space), and capture is the name of the
+ * image to write. Blank lines and lines starting with # are ignored. Times must not go backwards.
+ *
+ * @param file trace to read
+ * @return true trace was read
+ * @return false trace is malformed
+ */
+static bool sim_read_trace(FILE *file) {
+    char     line[256];
+    size_t   capacity = 0;
+    uint32_t line_no  = 0;
+
+    while (fgets(line, sizeof(line), file)) {
+        char          field[32], arg[SIM_KEYLOG_WIDTH];
+        unsigned long time_ms;
+        int           args;
+
+        line_no++;
+        if (line[strspn(line, " \t\r\n")] == '\0' || line[strspn(line, " \t")] == '#') {
+            continue;
+        }
+        args = sscanf(line, " %lu %31s %63s", &time_ms, field, arg);
+        if (args < 3) {
+            fprintf(stderr, "Trace line %u: expected \"<time_ms> <field> <value>\"\n", line_no);
+            return false;
+        }
+
+        sim_event_t event = {.time_us = (uint64_t)time_ms * 1000, .field = SIM_FIELD_COUNT};
+        for (sim_field_t i = 0; i < SIM_FIELD_COUNT; i++) {
+            if (!strcmp(field, sim_field_names[i])) {
+                event.field = i;
+            }
+        }
+        if (event.field == SIM_FIELD_COUNT) {
+            fprintf(stderr, "Trace line %u: unknown field \"%s\"\n", line_no, field);
+            return false;
+        }
+        if (sim_event_count && event.time_us < sim_events[sim_event_count - 1].time_us) {
+            fprintf(stderr, "Trace line %u: time goes backwards\n", line_no);
+            return false;
+        }
+        if (event.field == SIM_FIELD_KEYLOG || event.field == SIM_FIELD_CAPTURE) {
+            strcpy(event.string, arg);
+        } else {
+            char *end;
+            errno       = 0;
+            event.value = (uint32_t)strtoul(arg, &end, 0);
+            if (errno || *end) {
+                fprintf(stderr, "Trace line %u: bad value \"%s\"\n", line_no, arg);
+                return false;
+            }
+        }
+
+        if (sim_event_count == capacity) {
+            capacity   = capacity ? capacity * 2 : 64;
+            sim_events = realloc(sim_events, capacity * sizeof(*sim_events));
+            if (!sim_events) {
+                fprintf(stderr, "Out of memory\n");
+                return false;
+            }
+        }
+        sim_events[sim_event_count++] = event;
+    }
+    return true;
+}
+
+/**
+ * @brief Writes the panel as a plain PBM image, the same as oled_capture_print_frame() prints the buffer
+ *
+ */
+static bool sim_write_capture(const char *name) {
+    char path[PATH_MAX];
+    snprintf(path, sizeof(path), "%s/%s%s.pbm", sim_capture_dir, sim_prefix, name);
+
+    FILE *file = fopen(path, "w");
+    if (!file) {
+        fprintf(stderr, "Failed to write %s: %s\n", path, strerror(errno));
+        return false;
+    }
+    uint16_t width  = sim_oled_width();
+    uint16_t height = (OLED_MATRIX_SIZE / width) * 8;
+    fprintf(file, "P1\n%u %u\n", width, height);
+    for (uint16_t y = 0; y < height; y++) {
+        const uint8_t *page = &sim_oled.panel[(y / 8) * width];
+        for (uint16_t x = 0; x < width; x++) {
+            fputc((page[x] & (1 << (y % 8))) ? '1' : '0', file);
+        }
+        fputc('\n', file);
+    }
+    fclose(file);
+    return true;
+}
+
+/**
+ * @brief Flushes everything that is dirty, checks that the panel matches the buffer, and writes the capture
+ *
+ */
+static bool sim_capture(const char *name) {
+    oled_render_dirty(true);
+
+    uint16_t unflushed = sim_oled_unflushed_bytes();
+    if (unflushed) {
+        fprintf(stderr, "%lums %s: %u bytes of the buffer were changed without marking them dirty\n",
+                (unsigned long)timer_read32(), name, unflushed);
+        sim_bad_frames++;
+    }
+    sim_captures++;
+    return !sim_capture_dir || sim_write_capture(name);
+}
+
+static bool sim_apply_event(const sim_event_t *event) {
+    switch (event->field) {
+        case SIM_FIELD_WPM:
+            sim_keyboard.wpm = MIN(event->value, 255);
+            break;
+        case SIM_FIELD_LAYER:
+            layer_state = event->value;
+            break;
+        case SIM_FIELD_DEFAULT_LAYER:
+            default_layer_state = event->value;
+            break;
+        case SIM_FIELD_MODS:
+            sim_keyboard.mods = event->value;
+            break;
+        case SIM_FIELD_LEDS:
+            sim_keyboard.leds = event->value;
+            break;
+        case SIM_FIELD_KEYMAP_CONFIG:
+            keymap_config.raw = event->value;
+            break;
+        case SIM_FIELD_USERSPACE_CONFIG:
+            userspace_config.raw = event->value;
+            break;
+        case SIM_FIELD_USER_STATE:
+            user_state.raw = event->value;
+            break;
+        case SIM_FIELD_SCAN_RATE:
+            sim_keyboard.scan_rate = event->value;
+            return true; // not an input
+        case SIM_FIELD_KEYLOG:
+            sim_keyboard_set_keylog(event->string);
+            break;
+        case SIM_FIELD_CAPTURE:
+            return sim_capture(event->string);
+        default:
+            return true;
+    }
+    sim_keyboard.last_activity_us = sim_keyboard.clock_us;
+    return true;
+}
+
+static void sim_usage(const char *name) {
+    fprintf(stderr,
+            "Usage: %s [options] <trace|->\n"
+            "  -r         render the right half (default left)\n"
+            "  -o <n>     rotation, 0-3 for 0, 90, 180 and 270 degrees (default 0)\n"
+            "  -c <dir>   write the captures to dir, as <prefix><name>.pbm\n"
+            "  -p <str>   prefix for the capture file names\n"
+            "  -e <ms>    end time (default 1s after the last event)\n"
+            "  -s <seed>  seed for rand(), which the glitch effects use (default 1)\n"
+            "  -v         print the dirty blocks of every frame\n",
+            name);
+}
+
+int main(int argc, char **argv) {
+    uint64_t end_us  = 0;
+    bool     is_left = true;
+    unsigned seed    = 1;
+    int      opt;
+
+    while ((opt = getopt(argc, argv, "ro:c:p:e:s:v")) != -1) {
+        switch (opt) {
+            case 'r':
+                is_left = false;
+                break;
+            case 'o':
+                sim_rotation = (oled_rotation_t)(strtoul(optarg, NULL, 0) & 3);
+                break;
+            case 'c':
+                sim_capture_dir = optarg;
+                break;
+            case 'p':
+                sim_prefix = optarg;
+                break;
+            case 'e':
+                end_us = strtoull(optarg, NULL, 0) * 1000;
+                break;
+            case 's':
+                seed = strtoul(optarg, NULL, 0);
+                break;
+            case 'v':
+                sim_oled.verbose = true;
+                break;
+            default:
+                sim_usage(argv[0]);
+                return 2;
+        }
+    }
+    if (optind != argc - 1) {
+        sim_usage(argv[0]);
+        return 2;
+    }
+
+    FILE *trace = strcmp(argv[optind], "-") ? fopen(argv[optind], "r") : stdin;
+    if (!trace) {
+        fprintf(stderr, "Failed to open %s: %s\n", argv[optind], strerror(errno));
+        return 2;
+    }
+    bool trace_ok = sim_read_trace(trace);
+    if (trace != stdin) {
+        fclose(trace);
+    }
+    if (!trace_ok) {
+        return 2;
+    }
+    if (!end_us) {
+        end_us = (sim_event_count ? sim_events[sim_event_count - 1].time_us : 0) + SIM_TAIL_MS * 1000;
+    }
+
+    srand(seed);
+    sim_keyboard_init(is_left);
+    oled_init(OLED_ROTATION_0);
+
+    size_t next_event = 0;
+    for (; sim_keyboard.clock_us < end_us; sim_keyboard.clock_us += SIM_TICK_US) {
+        // a capture at this time sees everything rendered before it, but none of this tick's changes
+        while (next_event < sim_event_count && sim_events[next_event].time_us <= sim_keyboard.clock_us) {
+            if (!sim_apply_event(&sim_events[next_event++])) {
+                return 2;
+            }
+        }
+        sim_keyboard_task();
+        housekeeping_task_oled();
+        oled_task();
+    }
+    if (!sim_capture("end")) {
+        return 2;
+    }
+
+    printf("OLED %ux%u, %s half, rotation %u: %lu frames, %lu dirty blocks (avg %.2f, max %u per frame), %lu blocks "
+           "flushed, %lu captures\n",
+           OLED_DISPLAY_WIDTH, OLED_DISPLAY_HEIGHT, is_left ? "left" : "right", sim_rotation * 90,
+           (unsigned long)sim_oled.frames, (unsigned long)sim_oled.dirty_blocks,
+           sim_oled.frames ? (double)sim_oled.dirty_blocks / sim_oled.frames : 0.0, sim_oled.max_dirty,
+           (unsigned long)sim_oled.flushed_blocks, (unsigned long)sim_captures);
+    if (sim_bad_frames) {
+        printf("%lu captures had changes that never reached the panel\n", (unsigned long)sim_bad_frames);
+        return 1;
+    }
+    return 0;
+}
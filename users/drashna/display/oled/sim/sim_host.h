@@ -0,0 +1,49 @@
+// Copyright 2024 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "oled_driver.h"
+
+/**
+ * @brief Keyboard state that the trace drives, see sim_keyboard.c
+ *
+ */
+typedef struct {
+    uint64_t clock_us;         // virtual clock, advanced by the simulator
+    uint64_t last_activity_us; // last input, for the screensaver and the OLED timeout
+    bool     is_left;
+    uint8_t  wpm;
+    uint8_t  mods;
+    uint8_t  leds;
+    uint32_t scan_rate;
+} sim_keyboard_t;
+
+extern sim_keyboard_t sim_keyboard;
+
+void sim_keyboard_init(bool is_left);
+void sim_keyboard_task(void);
+void sim_keyboard_set_keylog(const char *text);
+
+/**
+ * @brief What the driver has sent to the panel, see sim_oled_driver.c
+ *
+ * The panel only gets the blocks that were marked dirty, so anything written to the buffer without being marked
+ * dirty shows up as a difference between the two.
+ */
+typedef struct {
+    uint8_t         panel[OLED_MATRIX_SIZE];
+    uint32_t        frames;          // passes of oled_task_user()
+    uint32_t        dirty_blocks;    // blocks newly marked dirty, over all of the frames
+    uint16_t        max_dirty;       // most blocks newly marked dirty in one frame
+    uint32_t        flushed_blocks;  // blocks sent to the panel
+    OLED_BLOCK_TYPE last_frame_dirty; // blocks newly marked dirty by the last frame
+    bool            verbose;          // print the dirty blocks of every frame that changes something
+} sim_oled_t;
+
+extern sim_oled_t sim_oled;
+
+uint16_t sim_oled_width(void);
+uint16_t sim_oled_unflushed_bytes(void);
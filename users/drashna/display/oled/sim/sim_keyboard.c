@@ -0,0 +1,225 @@
+// Copyright 2024 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @brief Stubs for the keyboard state that the OLED code displays, on the simulator's virtual clock.
+ *
+ * Everything here is driven by the trace (see oled_sim.c), so a run is repeatable.
+ */
+
+#include "sim_host.h"
+#include "drashna.h"
+#include "display/display.h"
+
+#define SIM_DEFERRED_EXECUTORS 4
+
+sim_keyboard_t sim_keyboard = {0};
+
+keymap_config_t       keymap_config       = {0};
+userspace_config_t    userspace_config    = {0};
+user_runtime_config_t user_state          = {0};
+layer_state_t         layer_state         = 0;
+layer_state_t         default_layer_state = 1;
+
+#ifdef DISPLAY_KEYLOGGER_ENABLE
+bool keylogger_has_changed                                  = true;
+char display_keylogger_string[DISPLAY_KEYLOGGER_LENGTH + 1] = {0};
+#endif // DISPLAY_KEYLOGGER_ENABLE
+
+static struct {
+    uint32_t               trigger_ms;
+    deferred_exec_callback callback;
+    void                  *cb_arg;
+} sim_deferred[SIM_DEFERRED_EXECUTORS];
+
+uint16_t timer_read(void) {
+    return (uint16_t)(sim_keyboard.clock_us / 1000);
+}
+
+uint32_t timer_read32(void) {
+    return (uint32_t)(sim_keyboard.clock_us / 1000);
+}
+
+uint16_t timer_elapsed(uint16_t last) {
+    return (uint16_t)(timer_read() - last);
+}
+
+uint32_t timer_elapsed32(uint32_t last) {
+    return timer_read32() - last;
+}
+
+// the clock doesn't move while the OLED code runs, so a time sliced layout always renders in one pass
+uint32_t timer_read_precise(void) {
+    return (uint32_t)sim_keyboard.clock_us;
+}
+
+uint32_t timer_elapsed_precise_us(uint32_t start) {
+    return timer_read_precise() - start;
+}
+
+uint32_t last_input_activity_elapsed(void) {
+    return (uint32_t)((sim_keyboard.clock_us - sim_keyboard.last_activity_us) / 1000);
+}
+
+bool layer_state_is(uint8_t layer) {
+    return layer_state & ((layer_state_t)1 << layer);
+}
+
+uint8_t get_highest_layer(layer_state_t state) {
+    uint8_t layer = 0;
+    while (state >>= 1) {
+        layer++;
+    }
+    return layer;
+}
+
+uint8_t get_mods(void) {
+    return sim_keyboard.mods;
+}
+
+uint8_t get_oneshot_mods(void) {
+    return 0;
+}
+
+bool is_oneshot_enabled(void) {
+    return keymap_config.oneshot_enable;
+}
+
+led_t host_keyboard_led_state(void) {
+    return (led_t){.raw = sim_keyboard.leds};
+}
+
+bool is_keyboard_master(void) {
+    return sim_keyboard.is_left;
+}
+
+bool is_keyboard_left(void) {
+    return sim_keyboard.is_left;
+}
+
+bool is_device_suspended(void) {
+    return false;
+}
+
+bool get_keyboard_lock(void) {
+    return user_state.host_driver_disabled;
+}
+
+uint32_t get_matrix_scan_rate(void) {
+    return sim_keyboard.scan_rate;
+}
+
+uint8_t get_current_wpm(void) {
+    return sim_keyboard.wpm;
+}
+
+void eeconfig_update_user_config(const uint32_t *data) {}
+
+deferred_token defer_exec(uint32_t delay_ms, deferred_exec_callback callback, void *cb_arg) {
+    for (uint8_t i = 0; i < SIM_DEFERRED_EXECUTORS; i++) {
+        if (!sim_deferred[i].callback) {
+            sim_deferred[i].trigger_ms = timer_read32() + delay_ms;
+            sim_deferred[i].callback   = callback;
+            sim_deferred[i].cb_arg     = cb_arg;
+            return i + 1;
+        }
+    }
+    return 0;
+}
+
+static const char *get_numeric_str(char *buf, uint8_t buf_len, uint32_t curr_num, char curr_pad) {
+    buf[buf_len - 1] = '\0';
+    for (uint8_t i = 0; i < buf_len - 1; ++i) {
+        char c               = '0' + curr_num % 10;
+        buf[buf_len - 2 - i] = (c == '0' && i == 0) ? '0' : (curr_num > 0 ? c : curr_pad);
+        curr_num /= 10;
+    }
+    return buf;
+}
+
+const char *get_u8_str(uint8_t curr_num, char curr_pad) {
+    static char buf[4];
+    return get_numeric_str(buf, sizeof(buf), curr_num, curr_pad);
+}
+
+const char *get_u16_str(uint16_t curr_num, char curr_pad) {
+    static char buf[6];
+    return get_numeric_str(buf, sizeof(buf), curr_num, curr_pad);
+}
+
+// copied from drashna.c
+const char *get_layer_name_string(layer_state_t state, bool alt_name, bool is_default) {
+    switch (get_highest_layer(state)) {
+        case _QWERTY:
+            return alt_name ? "Num Pad" : is_default ? "QWERTY" : "Base";
+        case _COLEMAK:
+            return "Colemak";
+        case _COLEMAK_DH:
+            return "Colemak-DH";
+        case _DVORAK:
+            return "Dvorak";
+        case _GAMEPAD:
+            return "Gamepad";
+        case _DIABLO:
+            return "Diablo";
+        case _DIABLOII:
+            return "Diablo II";
+        case _MOUSE:
+            return alt_name ? "Macros" : "Mouse";
+        case _MEDIA:
+            return "Media";
+        case _LOWER:
+            return "Lower";
+        case _RAISE:
+            return "Raise";
+        case _ADJUST:
+            return "Adjust";
+        default:
+            return "Unknown";
+    }
+}
+
+/**
+ * @brief Sets the keylogger to the end of a string, the same as typing it would
+ *
+ * @param text keys typed, with '_' for a space
+ */
+void sim_keyboard_set_keylog(const char *text) {
+#ifdef DISPLAY_KEYLOGGER_ENABLE
+    size_t length = strlen(text), skip = length > DISPLAY_KEYLOGGER_LENGTH ? length - DISPLAY_KEYLOGGER_LENGTH : 0;
+    size_t pad    = DISPLAY_KEYLOGGER_LENGTH - (length - skip);
+
+    memset(display_keylogger_string, ' ', pad);
+    for (size_t i = skip; i < length; i++) {
+        display_keylogger_string[pad + i - skip] = text[i] == '_' ? ' ' : text[i];
+    }
+    display_keylogger_string[DISPLAY_KEYLOGGER_LENGTH] = '\0';
+    keylogger_has_changed                              = true;
+#endif // DISPLAY_KEYLOGGER_ENABLE
+}
+
+void sim_keyboard_init(bool is_left) {
+    sim_keyboard.is_left             = is_left;
+    userspace_config.oled_brightness = 255;
+    userspace_config.rgb_layer_change = true;
+    keymap_config.oneshot_enable     = true;
+    sim_keyboard_set_keylog("");
+}
+
+/**
+ * @brief Runs the deferred executors that are due, like the deferred exec task does
+ *
+ */
+void sim_keyboard_task(void) {
+    uint32_t now = timer_read32();
+    for (uint8_t i = 0; i < SIM_DEFERRED_EXECUTORS; i++) {
+        if (sim_deferred[i].callback && (int32_t)(now - sim_deferred[i].trigger_ms) >= 0) {
+            uint32_t delay_ms = sim_deferred[i].callback(sim_deferred[i].trigger_ms, sim_deferred[i].cb_arg);
+            if (delay_ms) {
+                sim_deferred[i].trigger_ms += delay_ms;
+            } else {
+                sim_deferred[i].callback = NULL;
+            }
+        }
+    }
+}
@@ -0,0 +1,284 @@
+// Copyright 2024 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @brief Host reimplementation of the buffer side of QMK's OLED driver.
+ *
+ * The buffer, cursor and dirty block handling follow quantum/oled/oled_driver.c, so that the OLED code sees the same
+ * buffer and dirty state as on the keyboard. Instead of going out over I2C, the dirty blocks are copied into a panel
+ * buffer, at most OLED_UPDATE_PROCESS_LIMIT blocks per pass, like the driver does.
+ */
+
+#include "sim_host.h"
+#include "quantum.h"
+#include OLED_FONT_H
+
+uint8_t         oled_buffer[OLED_MATRIX_SIZE];
+uint8_t        *oled_cursor;
+OLED_BLOCK_TYPE oled_dirty          = 0;
+oled_rotation_t oled_rotation       = OLED_ROTATION_0;
+uint8_t         oled_rotation_width = OLED_DISPLAY_WIDTH;
+
+static bool     oled_initialized    = false;
+static bool     oled_active         = false;
+static uint8_t  oled_brightness     = 255;
+static uint16_t oled_update_timeout = 0;
+
+sim_oled_t sim_oled = {0};
+
+__attribute__((weak)) bool oled_task_user(void) {
+    return true;
+}
+
+__attribute__((weak)) oled_rotation_t oled_init_user(oled_rotation_t rotation) {
+    return rotation;
+}
+
+bool oled_init(oled_rotation_t rotation) {
+    oled_rotation = oled_init_user(rotation);
+    if (!(oled_rotation & OLED_ROTATION_90)) {
+        oled_rotation_width = OLED_DISPLAY_WIDTH;
+    } else {
+        oled_rotation_width = OLED_DISPLAY_HEIGHT;
+    }
+    oled_clear();
+    oled_initialized = true;
+    oled_active      = true;
+    return true;
+}
+
+void oled_clear(void) {
+    memset(oled_buffer, 0, sizeof(oled_buffer));
+    oled_cursor = &oled_buffer[0];
+    oled_dirty  = OLED_ALL_BLOCKS_MASK;
+}
+
+/**
+ * @brief Sends the dirty blocks to the panel
+ *
+ * @param all send every dirty block, rather than up to OLED_UPDATE_PROCESS_LIMIT
+ */
+void oled_render_dirty(bool all) {
+    oled_dirty &= OLED_ALL_BLOCKS_MASK;
+    if (!oled_dirty) {
+        return;
+    }
+
+    uint8_t update_start  = 0;
+    uint8_t num_processed = 0;
+    while (oled_dirty && (all || num_processed++ < OLED_UPDATE_PROCESS_LIMIT)) {
+        while (!(oled_dirty & ((OLED_BLOCK_TYPE)1 << update_start))) {
+            ++update_start;
+        }
+        memcpy(&sim_oled.panel[update_start * OLED_BLOCK_SIZE], &oled_buffer[update_start * OLED_BLOCK_SIZE],
+               OLED_BLOCK_SIZE);
+        sim_oled.flushed_blocks++;
+        oled_dirty &= ~((OLED_BLOCK_TYPE)1 << update_start);
+    }
+
+    oled_on();
+}
+
+void oled_set_cursor(uint8_t col, uint8_t line) {
+    uint16_t index = line * oled_rotation_width + col * OLED_FONT_WIDTH;
+
+    // Out of bounds?
+    if (index >= OLED_MATRIX_SIZE) {
+        index = 0;
+    }
+
+    oled_cursor = &oled_buffer[index];
+}
+
+void oled_advance_page(bool clearPageRemainder) {
+    uint16_t index     = oled_cursor - &oled_buffer[0];
+    uint8_t  remaining = oled_rotation_width - (index % oled_rotation_width);
+
+    if (clearPageRemainder) {
+        // Remaining Char count
+        remaining = remaining / OLED_FONT_WIDTH;
+
+        // Write empty character until next line
+        while (remaining--) {
+            oled_write_char(' ', false);
+        }
+    } else {
+        // Next page index out of bounds?
+        if (index + remaining >= OLED_MATRIX_SIZE) {
+            index     = 0;
+            remaining = 0;
+        }
+
+        oled_cursor = &oled_buffer[index + remaining];
+    }
+}
+
+void oled_advance_char(void) {
+    uint16_t nextIndex      = oled_cursor - &oled_buffer[0] + OLED_FONT_WIDTH;
+    uint8_t  remainingSpace = oled_rotation_width - (nextIndex % oled_rotation_width);
+
+    // Do we have enough space on the current line for the next character
+    if (remainingSpace < OLED_FONT_WIDTH) {
+        nextIndex += remainingSpace;
+    }
+
+    // Did we go out of bounds
+    if (nextIndex >= OLED_MATRIX_SIZE) {
+        nextIndex = 0;
+    }
+
+    // Update cursor position
+    oled_cursor = &oled_buffer[nextIndex];
+}
+
+void oled_write_char(const char data, bool invert) {
+    // Advance to the next line if newline
+    if (data == '\n') {
+        oled_advance_page(true);
+        return;
+    }
+
+    if (data == '\r') {
+        oled_advance_page(false);
+        return;
+    }
+
+    // copy the current render buffer to check for dirty after
+    static uint8_t oled_temp_buffer[OLED_FONT_WIDTH];
+    memcpy(&oled_temp_buffer, oled_cursor, OLED_FONT_WIDTH);
+
+    _Static_assert(sizeof(font) >= ((OLED_FONT_END + 1 - OLED_FONT_START) * OLED_FONT_WIDTH),
+                   "OLED_FONT_END references outside array");
+
+    // set the render buffer data
+    uint8_t cast_data = (uint8_t)data; // font based on unsigned type for index
+    if (cast_data < OLED_FONT_START || cast_data > OLED_FONT_END) {
+        memset(oled_cursor, 0x00, OLED_FONT_WIDTH);
+    } else {
+        const uint8_t *glyph = &font[(cast_data - OLED_FONT_START) * OLED_FONT_WIDTH];
+        memcpy_P(oled_cursor, glyph, OLED_FONT_WIDTH);
+    }
+
+    // Invert if needed
+    if (invert) {
+        for (uint8_t i = 0; i < OLED_FONT_WIDTH; i++) {
+            oled_cursor[i] = ~oled_cursor[i];
+        }
+    }
+
+    // Dirty check
+    if (memcmp(&oled_temp_buffer, oled_cursor, OLED_FONT_WIDTH)) {
+        uint16_t index = oled_cursor - &oled_buffer[0];
+        oled_dirty |= ((OLED_BLOCK_TYPE)1 << (index / OLED_BLOCK_SIZE));
+        // Edgecase check if the written data spans the 2 chunks
+        oled_dirty |= ((OLED_BLOCK_TYPE)1 << ((index + OLED_FONT_WIDTH - 1) / OLED_BLOCK_SIZE));
+    }
+
+    // Finally move to the next char
+    oled_advance_char();
+}
+
+void oled_write(const char *data, bool invert) {
+    const char *end = data + strlen(data);
+    while (data < end) {
+        oled_write_char(*data, invert);
+        data++;
+    }
+}
+
+void oled_write_ln(const char *data, bool invert) {
+    oled_write(data, invert);
+    oled_advance_page(true);
+}
+
+void oled_write_raw(const char *data, uint16_t size) {
+    uint16_t cursor_start_index = oled_cursor - &oled_buffer[0];
+    if ((size + cursor_start_index) > OLED_MATRIX_SIZE) {
+        size = OLED_MATRIX_SIZE - cursor_start_index;
+    }
+    for (uint16_t i = cursor_start_index; i < cursor_start_index + size; i++) {
+        uint8_t c = *data++;
+        if (oled_buffer[i] == c) {
+            continue;
+        }
+        oled_buffer[i] = c;
+        oled_dirty |= ((OLED_BLOCK_TYPE)1 << (i / OLED_BLOCK_SIZE));
+    }
+}
+
+bool oled_on(void) {
+    oled_active = true;
+    return oled_active;
+}
+
+bool oled_off(void) {
+    oled_active = false;
+    return !oled_active;
+}
+
+bool oled_is_on(void) {
+    return oled_active;
+}
+
+uint8_t oled_set_brightness(uint8_t level) {
+    oled_brightness = level;
+    return oled_brightness;
+}
+
+uint8_t oled_get_brightness(void) {
+    return oled_brightness;
+}
+
+/**
+ * @brief One pass of the driver task: the OLED code (every OLED_UPDATE_INTERVAL on split boards), then the flush
+ *
+ */
+void oled_task(void) {
+    if (!oled_initialized) {
+        return;
+    }
+
+#if OLED_UPDATE_INTERVAL > 0 && defined(SPLIT_KEYBOARD)
+    if (timer_elapsed(oled_update_timeout) >= OLED_UPDATE_INTERVAL) {
+        oled_update_timeout = timer_read();
+#endif
+        OLED_BLOCK_TYPE dirty_before = oled_dirty;
+        oled_set_cursor(0, 0);
+        oled_task_user();
+
+        OLED_BLOCK_TYPE dirty  = oled_dirty & ~dirty_before;
+        uint16_t        blocks = 0;
+        for (OLED_BLOCK_TYPE bits = dirty; bits; bits &= bits - 1) {
+            blocks++;
+        }
+        sim_oled.frames++;
+        sim_oled.dirty_blocks += blocks;
+        sim_oled.max_dirty        = MAX(sim_oled.max_dirty, blocks);
+        sim_oled.last_frame_dirty = dirty;
+        if (sim_oled.verbose && blocks) {
+            printf("%8lums frame %lu: %u dirty blocks, mask 0x%0*llx\n", (unsigned long)timer_read32(),
+                   (unsigned long)sim_oled.frames, blocks, (int)(OLED_BLOCK_COUNT / 4), (unsigned long long)dirty);
+        }
+#if OLED_UPDATE_INTERVAL > 0 && defined(SPLIT_KEYBOARD)
+    }
+#endif
+
+    oled_render_dirty(false);
+}
+
+uint16_t sim_oled_width(void) {
+    return oled_rotation_width;
+}
+
+/**
+ * @brief Counts the bytes where the panel and the buffer differ, once everything dirty has been flushed
+ *
+ * @return uint16_t bytes that were written to the buffer without marking their block dirty
+ */
+uint16_t sim_oled_unflushed_bytes(void) {
+    uint16_t count = 0;
+    for (uint16_t i = 0; i < OLED_MATRIX_SIZE; i++) {
+        count += sim_oled.panel[i] != oled_buffer[i];
+    }
+    return count;
+}
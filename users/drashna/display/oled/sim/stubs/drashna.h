@@ -0,0 +1,94 @@
+// Copyright 2024 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @brief Host stand-in for the userspace state that the OLED code uses.
+ *
+ * The layers, config unions and keycodes need to match drashna.h and keyrecords/process_records.h, so that the
+ * layouts render the same as on the keyboard.
+ */
+
+#pragma once
+
+#include "quantum.h"
+
+enum userspace_layers {
+    _QWERTY             = 0,
+    _NUMLOCK            = 0,
+    FIRST_DEFAULT_LAYER = 0,
+    _COLEMAK_DH,
+    _COLEMAK,
+    _DVORAK,
+    LAST_DEFAULT_LAYER = _DVORAK,
+    _GAMEPAD,
+    _DIABLO,
+    _DIABLOII,
+    _MOUSE,
+    _MEDIA,
+    _LOWER,
+    _RAISE,
+    _ADJUST,
+};
+
+// only the keycodes that the OLED code handles, the values don't matter on the host
+enum userspace_custom_keycodes {
+    OLED_LOCK = 0x7E00,
+    OLED_BRIGHTNESS_INC,
+    OLED_BRIGHTNESS_DEC,
+    OLED_ROTATE_CW,
+    OLED_ROTATE_CCW,
+    OLED_CAPTURE,
+    OLED_PROFILER,
+};
+
+typedef union {
+    uint32_t raw;
+    struct {
+        bool     rgb_layer_change     : 1;
+        bool     is_overwatch         : 1;
+        bool     nuke_switch          : 1;
+        bool     swapped_numbers      : 1;
+        bool     rgb_matrix_idle_anim : 1;
+        bool     reserved1            : 1;
+        bool     matrix_scan_print    : 1;
+        bool     align_reserved       : 1;
+        uint8_t  oled_brightness      : 8;
+        bool     oled_lock            : 1;
+        bool     enable_acceleration  : 1;
+        uint32_t reserved             : 13;
+        bool     check                : 1;
+    };
+} userspace_config_t;
+
+_Static_assert(sizeof(userspace_config_t) == sizeof(uint32_t), "Userspace EECONFIG out of spec.");
+
+extern userspace_config_t userspace_config;
+
+typedef union {
+    uint32_t raw;
+    struct {
+        bool     audio_enable         : 1;
+        bool     audio_clicky_enable  : 1;
+        bool     tap_toggling         : 1;
+        uint8_t  unicode_mode         : 3;
+        bool     swap_hands           : 1;
+        bool     host_driver_disabled : 1;
+        uint8_t  unicode_typing_mode  : 3;
+        bool     is_caps_word         : 1;
+        uint32_t reserved             : 20;
+    };
+} user_runtime_config_t;
+
+_Static_assert(sizeof(user_runtime_config_t) == sizeof(uint32_t), "Userspace Runtime config out of spec.");
+
+extern user_runtime_config_t user_state;
+
+void        eeconfig_update_user_config(const uint32_t *data);
+bool        get_keyboard_lock(void);
+const char *get_layer_name_string(layer_state_t state, bool alt_name, bool is_default);
+bool        is_device_suspended(void);
+uint32_t    get_matrix_scan_rate(void);
+uint32_t    timer_read_precise(void);
+uint32_t    timer_elapsed_precise_us(uint32_t start);
+
+#include "display/oled/oled_stuff.h"
@@ -0,0 +1,86 @@
+// Copyright 2024 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @brief Host stand-in for QMK's OLED driver header, with the same buffer geometry for each display size.
+ *
+ * The buffer side of the driver is reimplemented in sim_oled_driver.c, and the panel is just a second buffer that
+ * the dirty blocks are copied into.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#if defined(OLED_DISPLAY_128X64)
+#    define OLED_DISPLAY_WIDTH  128
+#    define OLED_DISPLAY_HEIGHT 64
+#    define OLED_MATRIX_SIZE    (OLED_DISPLAY_HEIGHT / 8 * OLED_DISPLAY_WIDTH) // 1024 (compile time mathed)
+#    define OLED_BLOCK_TYPE     uint16_t
+#    define OLED_BLOCK_COUNT    (sizeof(OLED_BLOCK_TYPE) * 8) // 16 (compile time mathed)
+#    define OLED_BLOCK_SIZE     (OLED_MATRIX_SIZE / OLED_BLOCK_COUNT) // 64 (compile time mathed)
+#elif defined(OLED_DISPLAY_128X128)
+#    define OLED_DISPLAY_WIDTH  128
+#    define OLED_DISPLAY_HEIGHT 128
+#    define OLED_MATRIX_SIZE    (OLED_DISPLAY_HEIGHT / 8 * OLED_DISPLAY_WIDTH) // 2048 (compile time mathed)
+#    define OLED_BLOCK_TYPE     uint32_t
+#    define OLED_BLOCK_COUNT    (sizeof(OLED_BLOCK_TYPE) * 8) // 32 (compile time mathed)
+#    define OLED_BLOCK_SIZE     (OLED_MATRIX_SIZE / OLED_BLOCK_COUNT) // 64 (compile time mathed)
+#else // 128x32
+#    define OLED_DISPLAY_WIDTH  128
+#    define OLED_DISPLAY_HEIGHT 32
+#    define OLED_MATRIX_SIZE    (OLED_DISPLAY_HEIGHT / 8 * OLED_DISPLAY_WIDTH) // 512 (compile time mathed)
+#    define OLED_BLOCK_TYPE     uint8_t
+#    define OLED_BLOCK_COUNT    (sizeof(OLED_BLOCK_TYPE) * 8) // 8 (compile time mathed)
+#    define OLED_BLOCK_SIZE     (OLED_MATRIX_SIZE / OLED_BLOCK_COUNT) // 64 (compile time mathed)
+#endif
+
+#define OLED_ALL_BLOCKS_MASK (((((OLED_BLOCK_TYPE)1 << (OLED_BLOCK_COUNT - 1)) - 1) << 1) | 1)
+
+#ifndef OLED_UPDATE_PROCESS_LIMIT
+#    define OLED_UPDATE_PROCESS_LIMIT 1
+#endif
+#ifndef OLED_FONT_START
+#    define OLED_FONT_START 0
+#endif
+#ifndef OLED_FONT_END
+#    define OLED_FONT_END 223
+#endif
+#ifndef OLED_FONT_WIDTH
+#    define OLED_FONT_WIDTH 6
+#endif
+#ifndef OLED_FONT_HEIGHT
+#    define OLED_FONT_HEIGHT 8
+#endif
+
+typedef enum {
+    OLED_ROTATION_0   = 0,
+    OLED_ROTATION_90  = 1,
+    OLED_ROTATION_180 = 2,
+    OLED_ROTATION_270 = 3,
+} oled_rotation_t;
+
+bool            oled_init(oled_rotation_t rotation);
+oled_rotation_t oled_init_user(oled_rotation_t rotation);
+bool            oled_task_user(void);
+void            oled_task(void);
+void            oled_clear(void);
+void            oled_render_dirty(bool all);
+void            oled_set_cursor(uint8_t col, uint8_t line);
+void            oled_advance_page(bool clearPageRemainder);
+void            oled_advance_char(void);
+void            oled_write_char(const char data, bool invert);
+void            oled_write(const char *data, bool invert);
+void            oled_write_ln(const char *data, bool invert);
+void            oled_write_raw(const char *data, uint16_t size);
+bool            oled_on(void);
+bool            oled_off(void);
+bool            oled_is_on(void);
+uint8_t         oled_set_brightness(uint8_t level);
+uint8_t         oled_get_brightness(void);
+
+// progmem is just memory on the host, like on ARM
+#define oled_write_P(data, invert)    oled_write(data, invert)
+#define oled_write_ln_P(data, invert) oled_write_ln(data, invert)
+#define oled_write_raw_P(data, size)  oled_write_raw(data, size)
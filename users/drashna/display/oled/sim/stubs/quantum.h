@@ -0,0 +1,125 @@
+// Copyright 2024 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @brief Host stand-in for the parts of QMK core that the OLED code uses.
+ *
+ * The keyboard state behind these lives in sim_keyboard.c, on the simulator's virtual clock.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define PACKED __attribute__((packed))
+#ifndef MIN
+#    define MIN(a, b) ((a) < (b) ? (a) : (b))
+#endif
+#ifndef MAX
+#    define MAX(a, b) ((a) > (b) ? (a) : (b))
+#endif
+#define ARRAY_SIZE(array) (sizeof((array)) / sizeof((array)[0]))
+#define xprintf           printf
+
+// progmem is just memory on the host
+#define PROGMEM
+#define PSTR(s)                  s
+#define pgm_read_byte(address)   (*(const uint8_t *)(address))
+#define pgm_read_word(address)   (*(const uint16_t *)(address))
+#define memcpy_P(dest, src, len) memcpy(dest, src, len)
+
+uint16_t timer_read(void);
+uint32_t timer_read32(void);
+uint16_t timer_elapsed(uint16_t last);
+uint32_t timer_elapsed32(uint32_t last);
+uint32_t last_input_activity_elapsed(void);
+
+typedef uint32_t layer_state_t;
+
+extern layer_state_t layer_state;
+extern layer_state_t default_layer_state;
+
+bool    layer_state_is(uint8_t layer);
+uint8_t get_highest_layer(layer_state_t state);
+
+enum {
+    KC_LCTL = 0xE0,
+    KC_LSFT,
+    KC_LALT,
+    KC_LGUI,
+    KC_RCTL,
+    KC_RSFT,
+    KC_RALT,
+    KC_RGUI,
+};
+
+#define MOD_BIT(code)  (1 << ((code) & 0x07))
+#define MOD_MASK_CTRL  (MOD_BIT(KC_LCTL) | MOD_BIT(KC_RCTL))
+#define MOD_MASK_SHIFT (MOD_BIT(KC_LSFT) | MOD_BIT(KC_RSFT))
+#define MOD_MASK_ALT   (MOD_BIT(KC_LALT) | MOD_BIT(KC_RALT))
+#define MOD_MASK_GUI   (MOD_BIT(KC_LGUI) | MOD_BIT(KC_RGUI))
+
+uint8_t get_mods(void);
+uint8_t get_oneshot_mods(void);
+bool    is_oneshot_enabled(void);
+
+typedef union {
+    uint8_t raw;
+    struct {
+        bool    num_lock    : 1;
+        bool    caps_lock   : 1;
+        bool    scroll_lock : 1;
+        bool    compose     : 1;
+        bool    kana        : 1;
+        uint8_t reserved    : 3;
+    };
+} led_t;
+
+led_t host_keyboard_led_state(void);
+
+typedef struct {
+    bool     pressed;
+    uint16_t time;
+} keyevent_t;
+
+typedef struct {
+    keyevent_t event;
+} keyrecord_t;
+
+typedef union {
+    uint16_t raw;
+    struct {
+        bool swap_control_capslock    : 1;
+        bool capslock_to_control      : 1;
+        bool swap_lalt_lgui           : 1;
+        bool swap_ralt_rgui           : 1;
+        bool no_gui                   : 1;
+        bool swap_grave_esc           : 1;
+        bool swap_backslash_backspace : 1;
+        bool nkro                     : 1;
+        bool swap_lctl_lgui           : 1;
+        bool swap_rctl_rgui           : 1;
+        bool oneshot_enable           : 1;
+        bool swap_escape_capslock     : 1;
+        bool autocorrect_enable       : 1;
+    };
+} keymap_config_t;
+
+extern keymap_config_t keymap_config;
+
+bool is_keyboard_master(void);
+bool is_keyboard_left(void);
+
+typedef uint8_t deferred_token;
+typedef uint32_t (*deferred_exec_callback)(uint32_t trigger_time, void *cb_arg);
+
+deferred_token defer_exec(uint32_t delay_ms, deferred_exec_callback callback, void *cb_arg);
+
+uint8_t     get_current_wpm(void);
+const char *get_u8_str(uint8_t curr_num, char curr_pad);
+const char *get_u16_str(uint16_t curr_num, char curr_pad);
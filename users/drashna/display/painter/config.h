@@ -0,0 +1,22 @@
+// Copyright 2024 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+// text and images are rendered into the scratch surface, and then copied out of it
+#if defined(PAINTER_TEXT_CACHE_ENABLE) || defined(PAINTER_PALETTE_ENABLE)
+#    define PAINTER_SCRATCH_SURFACE_ENABLE
+#    ifndef PAINTER_SCRATCH_SURFACE_WIDTH
+#        define PAINTER_SCRATCH_SURFACE_WIDTH 128
+#    endif // PAINTER_SCRATCH_SURFACE_WIDTH
+#    ifndef PAINTER_SCRATCH_SURFACE_HEIGHT
+#        define PAINTER_SCRATCH_SURFACE_HEIGHT 32
+#    endif // PAINTER_SCRATCH_SURFACE_HEIGHT
+#endif     // PAINTER_TEXT_CACHE_ENABLE || PAINTER_PALETTE_ENABLE
+
+// the widget regions and the scratch surface are both in use while a widget is drawn
+#if defined(PAINTER_WIDGETS_SURFACE_ENABLE) && defined(PAINTER_SCRATCH_SURFACE_ENABLE)
+#    ifndef RGB565_SURFACE_NUM_DEVICES
+#        define RGB565_SURFACE_NUM_DEVICES 2
+#    endif // RGB565_SURFACE_NUM_DEVICES
+#endif     // PAINTER_WIDGETS_SURFACE_ENABLE && PAINTER_SCRATCH_SURFACE_ENABLE
@@ -7,8 +7,11 @@
 #include "qp_comms.h"
 #include "display/painter/painter.h"
 #include "display/painter/ili9341_display.h"
+#include "display/painter/painter_widgets.h"
+#include "display/painter/painter_palette.h"
 #ifdef CUSTOM_SPLIT_TRANSPORT_SYNC
 #    include "split/transport_sync.h"
+#    include "split/transport_stats.h"
 #endif
 #ifdef RTC_ENABLE
 #    include "features/rtc/rtc.h"
@@ -32,6 +35,8 @@ painter_image_handle_t lock_scrl_on, lock_scrl_off;
 painter_image_handle_t windows_logo, apple_logo, linux_logo;
 painter_image_handle_t mouse_icon;
 
+static void init_widgets_ili9341(uint16_t width, uint16_t height);
+
 /**
  * @brief Draws the initial frame on the screen
  *
@@ -52,7 +57,8 @@ void render_frame(painter_device_t display) {
     }
     uint8_t title_xpos = (width - title_width) / 2;
     qp_drawtext_recolor(ili9341_display, title_xpos, 2, font_thintel,
-                        truncate_text(title, title_width, font_thintel, false, false), 0, 0, 0, 0, 0, 255);
+                        truncate_text(title, title_width, font_thintel, false, false, title, sizeof(title)), 0, 0, 0,
+                        0, 0, 255);
 }
 
 /**
@@ -60,9 +66,9 @@ void render_frame(painter_device_t display) {
  *
  */
 void init_display_ili9341(void) {
-    font_thintel = qp_load_font_mem(font_thintel15);
-    font_mono    = qp_load_font_mem(font_ProggyTiny15);
-    font_oled    = qp_load_font_mem(font_oled_font);
+    font_thintel = painter_load_font_mem(font_thintel15);
+    font_mono    = painter_load_font_mem(font_ProggyTiny15);
+    font_oled    = painter_load_font_mem(font_oled_font);
 
     // ters1 = qp_load_image_mem(gfx_ters1);
     lock_caps_on  = qp_load_image_mem(gfx_lock_caps_ON);
@@ -104,6 +110,7 @@ void init_display_ili9341(void) {
     if (is_keyboard_master()) {
         frame = qp_load_image_mem(gfx_frame);
         render_frame(ili9341_display);
+        init_widgets_ili9341(width, height);
     } else {
         frame = qp_load_image_mem(gfx_samurai_cyberpunk_minimal_dark_8k_b3_240x320);
         qp_drawimage_recolor(ili9341_display, 0, 0, frame, 0, 0, 255, 0, 0, 0);
@@ -112,610 +119,579 @@ void init_display_ili9341(void) {
     qp_power(ili9341_display, true);
 }
 
-void ili9341_display_power(bool on) {
-    qp_power(ili9341_display, on);
-}
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Status widgets
+//
+// Each widget is keyed on the state that it shows (and the hue, if it is drawn in it), and is only drawn when that
+// changes. See painter_widgets.c.
 
-__attribute__((weak)) void ili9341_draw_user(void) {
-    bool hue_redraw = false;
-#if defined(RGBLIGHT_ENABLE) || defined(RGB_MATRIX_ENABLE)
-    static uint16_t last_hue = {0xFFFF};
-    uint8_t         curr_hue = rgblight_get_hue();
-    if (last_hue != curr_hue) {
-        last_hue   = curr_hue;
-        hue_redraw = true;
-    }
+#ifdef CUSTOM_SPLIT_TRANSPORT_SYNC
+#    define ILI9341_TRANSPORT_WIDGETS (TRANSPORT_STATS_COUNT + 1)
 #else
-    static uint32_t last_update = 0;
-    if (timer_elapsed32(last_update) > 125) {
-        last_update = timer_read32();
-        hue_redraw  = true;
-    }
-#endif
+#    define ILI9341_TRANSPORT_WIDGETS 0
+#endif // CUSTOM_SPLIT_TRANSPORT_SYNC
+#ifdef LAYER_MAP_ENABLE
+#    define ILI9341_LAYER_MAP_WIDGETS LAYER_MAP_ROWS
+#else
+#    define ILI9341_LAYER_MAP_WIDGETS 0
+#endif // LAYER_MAP_ENABLE
+#define ILI9341_WIDGETS_MAX (24 + ILI9341_TRANSPORT_WIDGETS + ILI9341_LAYER_MAP_WIDGETS)
 
-    uint16_t width;
-    uint16_t height;
-    qp_get_geometry(ili9341_display, &width, &height, NULL, NULL, NULL);
+static painter_widget_t       ili9341_widgets[ILI9341_WIDGETS_MAX];
+static painter_widget_state_t ili9341_widget_states[ILI9341_WIDGETS_MAX];
+static uint8_t                ili9341_widget_count = 0;
+static uint8_t                ili9341_hue          = 0;
 
-#if defined(RGB_MATRIX_ENABLE) || defined(RGBLIGHT_ENABLE)
-    bool            rgb_effect_redraw = false;
-    static uint16_t last_effect       = 0xFFFF;
-#    if defined(RGB_MATRIX_ENABLE)
-    uint8_t curr_effect = rgb_matrix_get_mode();
-#    else
-    uint8_t curr_effect = rgblight_get_mode();
-#    endif
-    if (last_effect != curr_effect) {
-        last_effect       = curr_effect;
-        rgb_effect_redraw = true;
-    }
-#endif
-
-    if (is_keyboard_master()) {
-        char     buf[50] = {0};
-        uint16_t ypos    = 18;
-        uint16_t xpos    = 5;
+/**
+ * @brief Draws text in the current hue, at the start of the widget
+ *
+ * @param display display to draw to
+ * @param widget widget being drawn
+ * @param text text to draw
+ * @return uint16_t x position after the text
+ */
+static uint16_t draw_hue_text(painter_device_t display, const painter_widget_t* widget, const char* text) {
+    return painter_widget_drawtext(display, widget, widget->x, font_oled, text, ili9341_hue, 255, 255);
+}
 
-        bool        render_menu(painter_device_t display, uint16_t width, uint16_t height);
-        static bool menu_on_screen = false;
-        bool        menu_temp      = render_menu(ili9341_display, width, height);
-        if (menu_temp != menu_on_screen) {
-            menu_on_screen = menu_temp;
-            if (!menu_on_screen) {
-                render_frame(ili9341_display);
-                qp_flush(ili9341_display);
-            }
-            return;
+/**
+ * @brief Draws a row of labels, highlighting the ones whose bit is set in flags
+ *
+ * @param display display to draw to
+ * @param widget widget being drawn
+ * @param x x position to start at
+ * @param labels labels to draw
+ * @param count number of labels
+ * @param flags bit for each label
+ * @return uint16_t x position after the labels
+ */
+static uint16_t draw_flags(painter_device_t display, const painter_widget_t* widget, uint16_t x,
+                           const char* const* labels, uint8_t count, uint8_t flags) {
+    for (uint8_t i = 0; i < count; i++) {
+        if (i > 0) {
+            x += 5;
         }
-
-        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // LED Lock Indicators
+        x = painter_widget_drawlabel(display, widget, x, font_oled, labels[i], (flags & (1 << i)) ? 153 : 255, 255,
+                                     255);
+    }
+    return x;
+}
 
 #ifdef QP_LOCK_LOGO_ENABLE
-        static led_t last_led_state = {0};
-        if (hue_redraw || last_led_state.raw != host_keyboard_led_state().raw) {
-            last_led_state.raw = host_keyboard_led_state().raw;
-            qp_drawimage_recolor(ili9341_display, xpos, ypos, last_led_state.caps_lock ? lock_caps_on : lock_caps_off,
-                                 curr_hue, 255, last_led_state.caps_lock ? 255 : 32, curr_hue, 255, 0);
-            xpos += lock_caps_on->width + 4;
-            qp_drawimage_recolor(ili9341_display, xpos, ypos, last_led_state.num_lock ? lock_num_on : lock_num_off,
-                                 curr_hue, 255, last_led_state.num_lock ? 255 : 32, curr_hue, 255, 0);
-            xpos += lock_num_on->width + 4;
-            qp_drawimage_recolor(ili9341_display, xpos, ypos, last_led_state.scroll_lock ? lock_scrl_on : lock_scrl_off,
-                                 curr_hue, 255, last_led_state.scroll_lock ? 255 : 32, curr_hue, 255, 0);
-        }
+static uint32_t lock_images_key(const painter_widget_t* widget) {
+    return painter_widget_key_mix(host_keyboard_led_state().raw, ili9341_hue);
+}
 
-        ypos += lock_caps_on->height + 4;
+static uint16_t lock_images_draw(painter_device_t display, const painter_widget_t* widget) {
+    led_t    led_state = host_keyboard_led_state();
+    uint16_t xpos      = widget->x;
+    painter_palette_drawimage_recolor(display, xpos, widget->y, led_state.caps_lock ? lock_caps_on : lock_caps_off,
+                                      ili9341_hue, 255, led_state.caps_lock ? 255 : 32, ili9341_hue, 255, 0);
+    xpos += lock_caps_on->width + 4;
+    painter_palette_drawimage_recolor(display, xpos, widget->y, led_state.num_lock ? lock_num_on : lock_num_off,
+                                      ili9341_hue, 255, led_state.num_lock ? 255 : 32, ili9341_hue, 255, 0);
+    xpos += lock_num_on->width + 4;
+    painter_palette_drawimage_recolor(display, xpos, widget->y, led_state.scroll_lock ? lock_scrl_on : lock_scrl_off,
+                                      ili9341_hue, 255, led_state.scroll_lock ? 255 : 32, ili9341_hue, 255, 0);
+    return xpos + lock_scrl_on->width;
+}
 #endif // QP_LOCK_LOGO_ENABLE
 
-        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        //  WPM
-
-        static uint16_t max_wpm_xpos = 0;
 #ifdef WPM_ENABLE
+static uint32_t wpm_key(const painter_widget_t* widget) {
+    return painter_widget_key_mix(get_current_wpm(), ili9341_hue);
+}
 
-        bool            wpm_redraw      = false;
-        static uint32_t last_wpm_update = 0;
-        if (timer_elapsed32(last_wpm_update) > 125) {
-            last_wpm_update = timer_read32();
-            wpm_redraw      = true;
-        }
-
-        if (hue_redraw || wpm_redraw) {
-            xpos = 5;
-            snprintf(buf, sizeof(buf), "WPM: %3u", get_current_wpm());
-            xpos +=
-                qp_drawtext_recolor(ili9341_display, xpos, ypos, font_oled, buf, curr_hue, 255, 255, curr_hue, 255, 0);
-            if (max_wpm_xpos < xpos) {
-                max_wpm_xpos = xpos;
-            }
-            qp_rect(ili9341_display, xpos, ypos, max_wpm_xpos, ypos + font_oled->line_height, 0, 0, 0, true);
-        }
+static uint16_t wpm_draw(painter_device_t display, const painter_widget_t* widget) {
+    char buf[16] = {0};
+    snprintf(buf, sizeof(buf), "WPM: %3u", get_current_wpm());
+    return draw_hue_text(display, widget, buf);
+}
 #endif // WPM_ENABLE
 
-        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Matrix Scan rate
-
-        bool            scan_redraw      = false;
-        static uint32_t last_scan_update = 0;
-        if (timer_elapsed32(last_scan_update) > 125) {
-            last_scan_update = timer_read32();
-            scan_redraw      = true;
-        }
-        static uint16_t max_scans_xpos = 0;
-        if (hue_redraw || scan_redraw) {
-            xpos = max_wpm_xpos == 0 ? 5 : max_wpm_xpos + 10;
-            snprintf(buf, sizeof(buf), "SCANS: %4lu", get_matrix_scan_rate());
-            xpos +=
-                qp_drawtext_recolor(ili9341_display, xpos, ypos, font_oled, buf, curr_hue, 255, 255, curr_hue, 255, 0);
-            if (max_scans_xpos < xpos) {
-                max_scans_xpos = xpos;
-            }
-            qp_rect(ili9341_display, xpos, ypos, max_scans_xpos, ypos + font_oled->line_height, 0, 0, 0, true);
-        }
+static uint32_t scan_rate_key(const painter_widget_t* widget) {
+    return painter_widget_key_mix(get_matrix_scan_rate(), ili9341_hue);
+}
 
-        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Pointing Device CPI
+static uint16_t scan_rate_draw(painter_device_t display, const painter_widget_t* widget) {
+    char buf[16] = {0};
+    snprintf(buf, sizeof(buf), "SCANS: %4lu", get_matrix_scan_rate());
+    return draw_hue_text(display, widget, buf);
+}
 
 #ifdef POINTING_DEVICE_ENABLE
-        static uint16_t last_cpi   = {0xFFFF};
-        uint16_t        curr_cpi   = charybdis_get_pointer_sniping_enabled() ? charybdis_get_pointer_sniping_dpi()
-                                                                             : charybdis_get_pointer_default_dpi();
-        bool            cpi_redraw = false;
-        if (last_cpi != curr_cpi) {
-            last_cpi   = curr_cpi;
-            cpi_redraw = true;
-        }
-        static uint16_t max_cpi_xpos = 0;
-        if (hue_redraw || cpi_redraw) {
-            xpos = max_scans_xpos + 10;
-            snprintf(buf, sizeof(buf), "CPI: %5u", curr_cpi);
-            xpos +=
-                qp_drawtext_recolor(ili9341_display, xpos, ypos, font_oled, buf, curr_hue, 255, 255, curr_hue, 255, 0);
-            if (max_cpi_xpos < xpos) {
-                max_cpi_xpos = xpos;
-            }
-            qp_rect(ili9341_display, xpos, ypos, max_cpi_xpos, ypos + font_oled->line_height, 0, 0, 0, true);
-        }
-        // if (hue_redraw) {
-        //     xpos = 160;
-        //     qp_rect(ili9341_display, xpos, ypos, xpos + 10, ypos + 10, 0, 0, 200, true);
-        //     qp_drawimage(ili9341_display, xpos, ypos, mouse_icon);
-        // }
-
-        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Pointing Device Drag Scroll
-
-        bool            ds_state_redraw = false;
-        static uint32_t last_ds_state   = 0xFFFFFFFF;
-        if (last_ds_state != charybdis_get_pointer_dragscroll_enabled()) {
-            last_ds_state   = charybdis_get_pointer_dragscroll_enabled();
-            ds_state_redraw = true;
-        }
+static uint16_t get_pointer_cpi(void) {
+    return charybdis_get_pointer_sniping_enabled() ? charybdis_get_pointer_sniping_dpi()
+                                                   : charybdis_get_pointer_default_dpi();
+}
 
-        ypos += font_oled->line_height + 4;
-        if (ds_state_redraw) {
-            static int max_dss_xpos = 0;
-            xpos                    = 5;
-            const char* buf         = "DRAG SCROLL";
-            xpos += qp_drawtext_recolor(ili9341_display, xpos, ypos, font_oled, buf,
-                                        charybdis_get_pointer_dragscroll_enabled() ? 153 : 255, 255, 255,
-                                        charybdis_get_pointer_dragscroll_enabled() ? 153 : 255, 255, 0);
-            if (max_dss_xpos < xpos) {
-                max_dss_xpos = xpos;
-            }
-            qp_rect(ili9341_display, xpos, ypos, max_dss_xpos, ypos + font_oled->line_height, 0, 0, 0, true);
-        }
+static uint32_t cpi_key(const painter_widget_t* widget) {
+    return painter_widget_key_mix(get_pointer_cpi(), ili9341_hue);
+}
+
+static uint16_t cpi_draw(painter_device_t display, const painter_widget_t* widget) {
+    char buf[16] = {0};
+    snprintf(buf, sizeof(buf), "CPI: %5u", get_pointer_cpi());
+    return draw_hue_text(display, widget, buf);
+}
+
+static uint32_t drag_scroll_key(const painter_widget_t* widget) {
+    return charybdis_get_pointer_dragscroll_enabled();
+}
 
-        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Pointing Device Auto Mouse Layer
+static uint16_t drag_scroll_draw(painter_device_t display, const painter_widget_t* widget) {
+    uint8_t hue = charybdis_get_pointer_dragscroll_enabled() ? 153 : 255;
+    return painter_widget_drawlabel(display, widget, widget->x, font_oled, "DRAG SCROLL", hue, 255, 255);
+}
 
 #    ifdef POINTING_DEVICE_AUTO_MOUSE_ENABLE
-        bool           am_state_redraw = false;
-        static uint8_t last_am_state   = 0xFF;
-        if (last_am_state != get_auto_mouse_enable()) {
-            last_am_state   = get_auto_mouse_enable();
-            am_state_redraw = true;
-        }
+static uint32_t auto_mouse_key(const painter_widget_t* widget) {
+    return get_auto_mouse_enable();
+}
 
-        if (am_state_redraw) {
-            static int max_ams_xpos = 0;
-            xpos += 10;
-            const char* buf = "Auto Layer";
-            xpos += qp_drawtext_recolor(ili9341_display, xpos, ypos, font_oled, buf, get_auto_mouse_enable() ? 34 : 255,
-                                        255, 255, charybdis_get_pointer_sniping_enabled() ? 34 : 255, 255, 0);
-            if (max_ams_xpos < xpos) {
-                max_ams_xpos = xpos;
-            }
-            qp_rect(ili9341_display, xpos, ypos, max_ams_xpos, ypos + font_oled->line_height, 0, 0, 0, true);
-        }
-#    endif
+static uint16_t auto_mouse_draw(painter_device_t display, const painter_widget_t* widget) {
+    uint8_t hue = get_auto_mouse_enable() ? 34 : 255;
+    return painter_widget_drawlabel(display, widget, widget->x, font_oled, "Auto Layer", hue, 255, 255);
+}
+#    endif // POINTING_DEVICE_AUTO_MOUSE_ENABLE
 
-        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Pointing Device Sniping mode
+static uint32_t sniping_key(const painter_widget_t* widget) {
+    return charybdis_get_pointer_sniping_enabled();
+}
 
-        bool           sp_state_redraw = false;
-        static uint8_t last_sp_state   = 0xFF;
-        if (last_sp_state != charybdis_get_pointer_sniping_enabled()) {
-            last_sp_state   = charybdis_get_pointer_sniping_enabled();
-            sp_state_redraw = true;
-        }
-        if (sp_state_redraw) {
-            static int max_sps_xpos = 0;
-            xpos += 10;
-            const char* buf = "Sniping";
-            xpos += qp_drawtext_recolor(ili9341_display, xpos, ypos, font_oled, buf,
-                                        charybdis_get_pointer_sniping_enabled() ? 153 : 255, 255, 255,
-                                        charybdis_get_pointer_sniping_enabled() ? 153 : 255, 255, 0);
-            if (max_sps_xpos < xpos) {
-                max_sps_xpos = xpos;
-            }
-            qp_rect(ili9341_display, xpos, ypos, max_sps_xpos, ypos + font_oled->line_height, 0, 0, 0, true);
-        }
+static uint16_t sniping_draw(painter_device_t display, const painter_widget_t* widget) {
+    uint8_t hue = charybdis_get_pointer_sniping_enabled() ? 153 : 255;
+    return painter_widget_drawlabel(display, widget, widget->x, font_oled, "Sniping", hue, 255, 255);
+}
 #endif // POINTING_DEVICE_ENABLE
 
-        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Keymap config (nkro, autocorrect, oneshots)
-
-        ypos += font_oled->line_height + 4;
-        static keymap_config_t last_keymap_config = {0};
-        if (hue_redraw || last_keymap_config.raw != keymap_config.raw) {
-            last_keymap_config.raw  = keymap_config.raw;
-            static int max_bpm_xpos = 0;
-            xpos                    = 5;
-            qp_drawimage(ili9341_display, xpos, ypos, last_keymap_config.swap_lctl_lgui ? apple_logo : windows_logo);
-            xpos += windows_logo->width + 5;
-            xpos += qp_drawtext_recolor(ili9341_display, xpos, ypos, font_oled, (const char*)"NKRO",
-                                        last_keymap_config.nkro ? 153 : 255, 255, 255, 0, 0, 0) +
-                    5;
-            xpos += qp_drawtext_recolor(ili9341_display, xpos, ypos, font_oled, (const char*)"CRCT",
-                                        last_keymap_config.autocorrect_enable ? 153 : 255, 255, 255, 0, 0, 0) +
-                    5;
-            xpos += qp_drawtext_recolor(ili9341_display, xpos, ypos, font_oled, (const char*)"1SHT",
-                                        last_keymap_config.oneshot_enable ? 153 : 255, 255, 255, 0, 0, 0);
-            if (max_bpm_xpos < xpos) {
-                max_bpm_xpos = xpos;
-            }
-            qp_rect(ili9341_display, xpos, ypos, max_bpm_xpos, ypos + font_oled->line_height, 0, 0, 0, true);
-        }
+static uint32_t keymap_config_key(const painter_widget_t* widget) {
+    return keymap_config.nkro | (keymap_config.autocorrect_enable << 1) | (keymap_config.oneshot_enable << 2) |
+           (keymap_config.swap_lctl_lgui << 3);
+}
 
-        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Device Config (Audio, Audio Clicky, Host Driver lock, Swap Hands)
-
-        ypos += font_oled->line_height + 4;
-        static user_runtime_config_t last_user_state = {0};
-        if (hue_redraw || last_user_state.raw != user_state.raw) {
-            last_user_state.raw          = user_state.raw;
-            static uint16_t max_upm_xpos = 0;
-            xpos                         = windows_logo->width + 10;
-            xpos += qp_drawtext_recolor(ili9341_display, xpos, ypos, font_oled, (const char*)"AUDIO",
-                                        last_user_state.audio_enable ? 153 : 255, 255, 255, 0, 0, 0) +
-                    5;
-            xpos += qp_drawtext_recolor(ili9341_display, xpos, ypos, font_oled, (const char*)"CLCK",
-                                        last_user_state.audio_clicky_enable ? 153 : 255, 255, 255, 0, 0, 0) +
-                    5;
-            xpos += qp_drawtext_recolor(ili9341_display, xpos, ypos, font_oled, (const char*)"HOST",
-                                        !last_user_state.host_driver_disabled ? 153 : 255, 255, 255, 0, 0, 0) +
-                    5;
-            xpos += qp_drawtext_recolor(ili9341_display, xpos, ypos, font_oled, (const char*)"SWAP",
-                                        last_user_state.swap_hands ? 153 : 255, 255, 255, 0, 0, 0);
-            if (max_upm_xpos < xpos) {
-                max_upm_xpos = xpos;
-            }
-            qp_rect(ili9341_display, xpos, ypos, max_upm_xpos, ypos + font_oled->line_height, 0, 0, 0, true);
-        }
+static uint16_t keymap_config_draw(painter_device_t display, const painter_widget_t* widget) {
+    static const char* const labels[] = {"NKRO", "CRCT", "1SHT"};
+    uint8_t                  flags    = keymap_config_key(widget);
+    qp_drawimage(display, widget->x, widget->y, keymap_config.swap_lctl_lgui ? apple_logo : windows_logo);
+    return draw_flags(display, widget, widget->x + windows_logo->width + 5, labels, ARRAY_SIZE(labels), flags);
+}
 
-        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // LED Lock indicator (text)
-
-        ypos += font_oled->line_height + 4;
-        static led_t last_led_state = {0};
-        if (hue_redraw || last_led_state.raw != host_keyboard_led_state().raw) {
-            last_led_state.raw           = host_keyboard_led_state().raw;
-            static uint16_t max_led_xpos = 0;
-            xpos                         = 5;
-            xpos += qp_drawtext_recolor(ili9341_display, xpos, ypos, font_oled, (const char*)"Locks:", 153, 255, 255,
-                                        255, 255, 0) +
-                    5;
-            xpos += qp_drawtext_recolor(ili9341_display, xpos, ypos, font_oled, (const char*)"CAPS",
-                                        last_led_state.caps_lock ? 153 : 255, 255, 255, 255, 255, 0) +
-                    5;
-            xpos += qp_drawtext_recolor(ili9341_display, xpos, ypos, font_oled, (const char*)"SCRL",
-                                        last_led_state.scroll_lock ? 153 : 255, 255, 255, 255, 255, 0) +
-                    5;
-            xpos += qp_drawtext_recolor(ili9341_display, xpos, ypos, font_oled, (const char*)"NUM",
-                                        last_led_state.num_lock ? 153 : 255, 255, 255, 255, 255, 0);
-            if (max_led_xpos < xpos) {
-                max_led_xpos = xpos;
-            }
-            qp_rect(ili9341_display, xpos, ypos, max_led_xpos, ypos + font_oled->line_height, 0, 0, 0, true);
-        }
+static uint32_t user_state_key(const painter_widget_t* widget) {
+    return user_state.audio_enable | (user_state.audio_clicky_enable << 1) | (!user_state.host_driver_disabled << 2) |
+           (user_state.swap_hands << 3);
+}
 
-        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Mods
-
-        ypos += font_oled->line_height + 4;
-        static uint8_t last_mods    = {0};
-        uint8_t        current_mods = get_mods() | get_weak_mods() | get_oneshot_mods();
-        if (hue_redraw || last_mods != current_mods) {
-            last_mods                    = current_mods;
-            static uint16_t max_mod_xpos = 0;
-            xpos                         = 5;
-            xpos += qp_drawtext_recolor(ili9341_display, xpos, ypos, font_oled, (const char*)"Modifiers:", 153, 255,
-                                        255, 255, 255, 0) +
-                    5;
-            xpos += qp_drawtext_recolor(ili9341_display, xpos, ypos, font_oled, (const char*)"Shift",
-                                        last_mods & MOD_MASK_SHIFT ? 153 : 255, 255, 255, 255, 255, 0) +
-                    5;
-            xpos += qp_drawtext_recolor(ili9341_display, xpos, ypos, font_oled, (const char*)"Control",
-                                        last_mods & MOD_MASK_CTRL ? 153 : 255, 255, 255, 255, 255, 0) +
-                    5;
-            xpos += qp_drawtext_recolor(ili9341_display, xpos, ypos, font_oled, (const char*)"Alt",
-                                        last_mods & MOD_MASK_ALT ? 153 : 255, 255, 255, 255, 255, 0) +
-                    5;
-            xpos += qp_drawtext_recolor(ili9341_display, xpos, ypos, font_oled, (const char*)"GUI",
-                                        last_mods & MOD_MASK_GUI ? 153 : 255, 255, 255, 255, 255, 0) +
-                    5;
-            if (max_mod_xpos < xpos) {
-                max_mod_xpos = xpos;
-            }
-            qp_rect(ili9341_display, xpos, ypos, max_mod_xpos, ypos + font_oled->line_height, 0, 0, 0, true);
-        }
+static uint16_t user_state_draw(painter_device_t display, const painter_widget_t* widget) {
+    static const char* const labels[] = {"AUDIO", "CLCK", "HOST", "SWAP"};
+    return draw_flags(display, widget, widget->x, labels, ARRAY_SIZE(labels), user_state_key(widget));
+}
 
-        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        //  RGB Light Settings
-
-#if defined(RGBLIGHT_ENABLE)
-        ypos += font_oled->line_height + 4;
-        if (hue_redraw || rgb_effect_redraw) {
-            static uint16_t max_rgb_xpos = 0;
-            xpos                         = 5;
-            snprintf(buf, sizeof(buf), "RGB Light Mode: %s", rgblight_name(curr_effect));
-            for (uint16_t i = 16; i < sizeof(buf); ++i) {
-                if (buf[i] == 0)
-                    break;
-                else if (buf[i] == '_')
-                    buf[i] = ' ';
-                else if (buf[i - 1] == ' ')
-                    buf[i] = toupper(buf[i]);
-                else if (buf[i - 1] != ' ')
-                    buf[i] = tolower(buf[i]);
-            }
+static uint32_t locks_key(const painter_widget_t* widget) {
+    led_t led_state = host_keyboard_led_state();
+    return led_state.caps_lock | (led_state.scroll_lock << 1) | (led_state.num_lock << 2);
+}
 
-            xpos +=
-                qp_drawtext_recolor(ili9341_display, xpos, ypos, font_oled, buf, curr_hue, 255, 255, curr_hue, 255, 0);
-            if (max_rgb_xpos < xpos) {
-                max_rgb_xpos = xpos;
-            }
-            qp_rect(ili9341_display, xpos, ypos, max_rgb_xpos, ypos + font_oled->line_height, 0, 0, 0, true);
-
-            ypos += font_oled->line_height + 4;
-            static uint16_t max_hsv_xpos = 0;
-            xpos                         = 5;
-            snprintf(buf, sizeof(buf), "RGB Light HSV: %3d, %3d, %3d", rgblight_get_hue(), rgblight_get_sat(),
-                     rgblight_get_val());
-            xpos +=
-                qp_drawtext_recolor(ili9341_display, xpos, ypos, font_oled, buf, curr_hue, 255, 255, curr_hue, 255, 0);
-            if (max_hsv_xpos < xpos) {
-                max_hsv_xpos = xpos;
-            }
-            qp_rect(ili9341_display, xpos, ypos, max_hsv_xpos, ypos + font_oled->line_height, 0, 0, 0, true);
-            qp_rect(ili9341_display, max_hsv_xpos + 5, ypos, max_hsv_xpos + 25, ypos + font_oled->line_height - 1,
-                    rgblight_get_hue(), rgblight_get_sat(), (uint8_t)(rgblight_get_val() * 0xFF / RGBLIGHT_LIMIT_VAL),
-                    true);
+static uint16_t locks_draw(painter_device_t display, const painter_widget_t* widget) {
+    // the title is drawn as a label that is always highlighted
+    static const char* const labels[] = {"Locks:", "CAPS", "SCRL", "NUM"};
+    return draw_flags(display, widget, widget->x, labels, ARRAY_SIZE(labels), 1 | (locks_key(widget) << 1));
+}
+
+static uint32_t mods_key(const painter_widget_t* widget) {
+    uint8_t mods = get_mods() | get_weak_mods() | get_oneshot_mods();
+    return (mods & MOD_MASK_SHIFT ? 1 : 0) | (mods & MOD_MASK_CTRL ? 2 : 0) | (mods & MOD_MASK_ALT ? 4 : 0) |
+           (mods & MOD_MASK_GUI ? 8 : 0);
+}
+
+static uint16_t mods_draw(painter_device_t display, const painter_widget_t* widget) {
+    static const char* const labels[] = {"Modifiers:", "Shift", "Control", "Alt", "GUI"};
+    return draw_flags(display, widget, widget->x, labels, ARRAY_SIZE(labels), 1 | (mods_key(widget) << 1));
+}
+
+#if defined(RGBLIGHT_ENABLE) || defined(RGB_MATRIX_ENABLE)
+/**
+ * @brief Turns the effect name in a buffer from "SOLID_REACTIVE" into "Solid Reactive"
+ *
+ * @param buf buffer holding the string
+ * @param start index of the start of the effect name
+ */
+static void format_effect_name(char* buf, uint8_t start) {
+    for (uint8_t i = start; buf[i] != 0; ++i) {
+        if (buf[i] == '_') {
+            buf[i] = ' ';
+        } else if (buf[i - 1] == ' ') {
+            buf[i] = toupper(buf[i]);
         } else {
-            // we called ypos inside the function ... to make sure we don't skip a line on future passes ....
-            ypos += font_oled->line_height + 4;
+            buf[i] = tolower(buf[i]);
         }
+    }
+}
+
+/**
+ * @brief Draws the HSV values in the current hue, followed by a swatch of the color at the end of the widget
+ *
+ * @param display display to draw to
+ * @param widget widget being drawn
+ * @param buf HSV text
+ * @param hue swatch hue
+ * @param sat swatch saturation
+ * @param val swatch value
+ * @return uint16_t x position after the swatch
+ */
+static uint16_t draw_hsv_swatch(painter_device_t display, const painter_widget_t* widget, const char* buf, uint8_t hue,
+                                uint8_t sat, uint8_t val) {
+    uint16_t right = widget->x + widget->width;
+    uint16_t xpos  = draw_hue_text(display, widget, buf);
+    if (xpos < right - 25) {
+        qp_rect(display, xpos, widget->y, right - 26, widget->y + widget->height - 1, 0, 0, 0, true);
+    }
+    qp_rect(display, right - 20, widget->y, right - 1, widget->y + font_oled->line_height - 1, hue, sat, val, true);
+    return right;
+}
+#endif // RGBLIGHT_ENABLE || RGB_MATRIX_ENABLE
+
+#ifdef RGBLIGHT_ENABLE
+static uint32_t rgblight_mode_key(const painter_widget_t* widget) {
+    return painter_widget_key_mix(rgblight_get_mode(), ili9341_hue);
+}
+
+static uint16_t rgblight_mode_draw(painter_device_t display, const painter_widget_t* widget) {
+    char buf[50] = {0};
+    snprintf(buf, sizeof(buf), "RGB Light Mode: %s", rgblight_name(rgblight_get_mode()));
+    format_effect_name(buf, 16);
+    return draw_hue_text(display, widget, buf);
+}
+
+static uint32_t rgblight_hsv_key(const painter_widget_t* widget) {
+    return painter_widget_key_mix(
+        (rgblight_get_hue() << 16) | (rgblight_get_sat() << 8) | rgblight_get_val(), ili9341_hue);
+}
+
+static uint16_t rgblight_hsv_draw(painter_device_t display, const painter_widget_t* widget) {
+    char buf[50] = {0};
+    snprintf(buf, sizeof(buf), "RGB Light HSV: %3d, %3d, %3d", rgblight_get_hue(), rgblight_get_sat(),
+             rgblight_get_val());
+    return draw_hsv_swatch(display, widget, buf, rgblight_get_hue(), rgblight_get_sat(),
+                           (uint8_t)(rgblight_get_val() * 0xFF / RGBLIGHT_LIMIT_VAL));
+}
 #endif // RGBLIGHT_ENABLE
 
-        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // RGB Matrix Settings
-
-#if defined(RGB_MATRIX_ENABLE)
-        ypos += font_oled->line_height + 4;
-        if (hue_redraw || rgb_effect_redraw) {
-            static uint16_t max_rgb_xpos = 0;
-            xpos                         = 5;
-            snprintf(buf, sizeof(buf), "RGB Matrix Mode: %s", rgb_matrix_name(curr_effect));
-            for (uint16_t i = 17; i < sizeof(buf); ++i) {
-                if (buf[i] == 0)
-                    break;
-                else if (buf[i] == '_')
-                    buf[i] = ' ';
-                else if (buf[i - 1] == ' ')
-                    buf[i] = toupper(buf[i]);
-                else if (buf[i - 1] != ' ')
-                    buf[i] = tolower(buf[i]);
-            }
+#ifdef RGB_MATRIX_ENABLE
+static uint32_t rgb_matrix_mode_key(const painter_widget_t* widget) {
+    return painter_widget_key_mix(rgb_matrix_get_mode(), ili9341_hue);
+}
 
-            xpos +=
-                qp_drawtext_recolor(ili9341_display, xpos, ypos, font_oled, buf, curr_hue, 255, 255, curr_hue, 255, 0);
-            if (max_rgb_xpos < xpos) {
-                max_rgb_xpos = xpos;
-            }
-            qp_rect(ili9341_display, xpos, ypos, max_rgb_xpos, ypos + font_oled->line_height, 0, 0, 0, true);
-
-            ypos += font_oled->line_height + 4;
-            static uint16_t max_hsv_xpos = 0;
-            xpos                         = 5;
-            snprintf(buf, sizeof(buf), "RGB Matrix HSV: %3d, %3d, %3d", rgb_matrix_get_hue(), rgb_matrix_get_sat(),
-                     rgb_matrix_get_val());
-            xpos +=
-                qp_drawtext_recolor(ili9341_display, xpos, ypos, font_oled, buf, curr_hue, 255, 255, curr_hue, 255, 0);
-            if (max_hsv_xpos < xpos) {
-                max_hsv_xpos = xpos;
-            }
-            qp_rect(ili9341_display, xpos, ypos, max_hsv_xpos, ypos + font_oled->line_height, 0, 0, 0, true);
-            qp_rect(ili9341_display, max_hsv_xpos + 5, ypos, max_hsv_xpos + 25, ypos + font_oled->line_height - 1,
-                    rgb_matrix_get_hue(), rgb_matrix_get_sat(),
-                    (uint8_t)(rgb_matrix_get_val() * 0xFF / RGB_MATRIX_MAXIMUM_BRIGHTNESS), true);
-        } else {
-            // we called ypos inside the function ... to make sure we don't skip a line on future passes ....
-            ypos += font_oled->line_height + 4;
-        }
-#endif // RGB_MATRIX_ENABLE
+static uint16_t rgb_matrix_mode_draw(painter_device_t display, const painter_widget_t* widget) {
+    char buf[50] = {0};
+    snprintf(buf, sizeof(buf), "RGB Matrix Mode: %s", rgb_matrix_name(rgb_matrix_get_mode()));
+    format_effect_name(buf, 17);
+    return draw_hue_text(display, widget, buf);
+}
 
-        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        //  Default layer state
+static uint32_t rgb_matrix_hsv_key(const painter_widget_t* widget) {
+    return painter_widget_key_mix(
+        (rgb_matrix_get_hue() << 16) | (rgb_matrix_get_sat() << 8) | rgb_matrix_get_val(), ili9341_hue);
+}
 
-        bool                 layer_state_redraw = false, dl_state_redraw = false;
-        static layer_state_t last_layer_state = 0, last_dl_state = 0;
-        if (last_layer_state != layer_state) {
-            last_layer_state   = layer_state;
-            layer_state_redraw = true;
-        }
-        if (last_dl_state != default_layer_state) {
-            last_dl_state   = default_layer_state;
-            dl_state_redraw = true;
-        }
+static uint16_t rgb_matrix_hsv_draw(painter_device_t display, const painter_widget_t* widget) {
+    char buf[50] = {0};
+    snprintf(buf, sizeof(buf), "RGB Matrix HSV: %3d, %3d, %3d", rgb_matrix_get_hue(), rgb_matrix_get_sat(),
+             rgb_matrix_get_val());
+    return draw_hsv_swatch(display, widget, buf, rgb_matrix_get_hue(), rgb_matrix_get_sat(),
+                           (uint8_t)(rgb_matrix_get_val() * 0xFF / RGB_MATRIX_MAXIMUM_BRIGHTNESS));
+}
+#endif // RGB_MATRIX_ENABLE
 
-        ypos += font_oled->line_height + 4;
-        if (hue_redraw || dl_state_redraw || layer_state_redraw) {
-            static int max_layer_xpos = 0;
-            xpos                      = 5;
-            snprintf(buf, sizeof(buf), "LAYOUT: %s", get_layer_name_string(layer_state, false, true));
-            xpos +=
-                qp_drawtext_recolor(ili9341_display, xpos, ypos, font_oled, buf, curr_hue, 255, 255, curr_hue, 255, 0);
-            if (max_layer_xpos < xpos) {
-                max_layer_xpos = xpos;
-            }
-            qp_rect(ili9341_display, xpos, ypos, max_layer_xpos, ypos + font_oled->line_height, 0, 0, 0, true);
-        }
+static uint32_t layout_key(const painter_widget_t* widget) {
+    return painter_widget_key_mix(painter_widget_key_mix(default_layer_state, layer_state), ili9341_hue);
+}
 
-        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Layer State
-
-        if (hue_redraw || layer_state_redraw) {
-            static int max_layer_xpos = 0;
-            xpos                      = 5 + (qp_textwidth(font_oled, "LAYOUT: COLEMAK_DH"));
-            snprintf(buf, sizeof(buf), "LAYER: %s", get_layer_name_string(layer_state, false, false));
-            xpos +=
-                qp_drawtext_recolor(ili9341_display, xpos, ypos, font_oled, buf, curr_hue, 255, 255, curr_hue, 255, 0);
-            if (max_layer_xpos < xpos) {
-                max_layer_xpos = xpos;
-            }
-            qp_rect(ili9341_display, xpos, ypos, max_layer_xpos, ypos + font_oled->line_height, 0, 0, 0, true);
-        }
+static uint16_t layout_draw(painter_device_t display, const painter_widget_t* widget) {
+    char buf[50] = {0};
+    snprintf(buf, sizeof(buf), "LAYOUT: %s", get_layer_name_string(layer_state, false, true));
+    return draw_hue_text(display, widget, buf);
+}
 
-        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Autocorrection values
+static uint32_t layer_key(const painter_widget_t* widget) {
+    return painter_widget_key_mix(layer_state, ili9341_hue);
+}
+
+static uint16_t layer_draw(painter_device_t display, const painter_widget_t* widget) {
+    char buf[50] = {0};
+    snprintf(buf, sizeof(buf), "LAYER: %s", get_layer_name_string(layer_state, false, false));
+    return draw_hue_text(display, widget, buf);
+}
 
 #ifdef AUTOCORRECT_ENABLE
-        ypos += font_oled->line_height + 4;
-        extern bool autocorrect_str_has_changed;
-        extern char autocorrected_str_raw[2][21];
-        if (hue_redraw || autocorrect_str_has_changed) {
-            static int max_klog_xpos = 0;
-            xpos                     = 5;
-            snprintf(buf, sizeof(buf), "Autocorrected: %s", autocorrected_str_raw[0]);
-            xpos +=
-                qp_drawtext_recolor(ili9341_display, xpos, ypos, font_oled, buf, curr_hue, 255, 255, curr_hue, 255, 0);
-
-            if (max_klog_xpos < xpos) {
-                max_klog_xpos = xpos;
-            }
-            qp_rect(ili9341_display, xpos, ypos, max_klog_xpos, ypos + font_oled->line_height, 0, 0, 0, true);
-
-            ypos += font_oled->line_height + 4;
-            max_klog_xpos = 0;
-            xpos          = 5;
-            snprintf(buf, sizeof(buf), "Original Text: %s", autocorrected_str_raw[1]);
-            xpos +=
-                qp_drawtext_recolor(ili9341_display, xpos, ypos, font_oled, buf, curr_hue, 255, 255, curr_hue, 255, 0);
-            if (max_klog_xpos < xpos) {
-                max_klog_xpos = xpos;
-            }
-            qp_rect(ili9341_display, xpos, ypos, max_klog_xpos, ypos + font_oled->line_height, 0, 0, 0, true);
+extern char autocorrected_str_raw[2][21];
 
-            autocorrect_str_has_changed = false;
-        } else {
-            // we called ypos inside the function ... to make sure we don't skip a line on future passes ....
-            ypos += font_oled->line_height + 4;
-        }
+static uint32_t autocorrect_key(const painter_widget_t* widget) {
+    return painter_widget_key_str(ili9341_hue, autocorrected_str_raw[widget->arg]);
+}
+
+static uint16_t autocorrect_draw(painter_device_t display, const painter_widget_t* widget) {
+    char buf[50] = {0};
+    snprintf(buf, sizeof(buf), "%s: %s", widget->arg ? "Original Text" : "Autocorrected",
+             autocorrected_str_raw[widget->arg]);
+    return draw_hue_text(display, widget, buf);
+}
 #endif // AUTOCORRECT_ENABLE
 
-        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Font test
-
-#if 0
-        ypos += font_oled->line_height + 4;
-        if (hue_redraw) {
-            xpos                             = 5;
-            static uint16_t max_font_xpos[4] = {0};
-            render_character_set(ili9341_display, &xpos, max_font_xpos, &ypos, font_thintel, curr_hue, 255, 255,
-                                 curr_hue, 255, 0);
-            render_character_set(ili9341_display, &xpos, max_font_xpos, &ypos, font_mono, curr_hue, 255, 255, curr_hue,
-                                 255, 0);
-            render_character_set(ili9341_display, &xpos, max_font_xpos, &ypos, font_oled, curr_hue, 255, 255, curr_hue,
-                                 255, 0);
-        }
-#endif
+#ifdef CUSTOM_SPLIT_TRANSPORT_SYNC
+static uint32_t transport_stats_key(const painter_widget_t* widget) {
+    // the stats are refreshed once a second
+    return painter_widget_key_mix(timer_read32() / 1000, ili9341_hue);
+}
 
-        // Keylogger
-        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+static uint16_t transport_stats_draw(painter_device_t display, const painter_widget_t* widget) {
+    char buf[50] = {0};
+    if (!transport_stats_render_string(widget->arg, buf, sizeof(buf), true)) {
+        return widget->x;
+    }
+    return draw_hue_text(display, widget, buf);
+}
 
-#ifdef DISPLAY_KEYLOGGER_ENABLE // keep at very end
-        static uint32_t last_klog_update = 0;
-        if (timer_elapsed32(last_klog_update) > 125 || keylogger_has_changed) {
-            last_klog_update = timer_read32();
-        }
+static uint16_t peer_telemetry_draw(painter_device_t display, const painter_widget_t* widget) {
+    char                     buf[50] = {0};
+    const split_telemetry_t* peer    = transport_sync_get_remote_telemetry();
+    if (peer) {
+        snprintf(buf, sizeof(buf), "Peer: %lu scans, hk %u/%uus, err %u/%u%s", peer->matrix_scan_rate,
+                 peer->housekeeping_us, peer->housekeeping_max_us, peer->delta_errors, peer->blob_errors,
+                 peer->rtc_connected ? ", RTC" : "");
+    } else {
+        snprintf(buf, sizeof(buf), "Peer: no data");
+    }
+    return draw_hue_text(display, widget, buf);
+}
+#endif // CUSTOM_SPLIT_TRANSPORT_SYNC
 
-        ypos = height - (font_mono->line_height + 2);
-        if (keylogger_has_changed) {
-            static int max_klog_xpos = 0;
-            xpos                     = 27;
-            snprintf(buf, sizeof(buf), "Keylogger: %s", display_keylogger_string);
+#ifdef DISPLAY_KEYLOGGER_ENABLE
+static uint32_t keylogger_key(const painter_widget_t* widget) {
+    return painter_widget_key_str(0, display_keylogger_string);
+}
 
-            xpos += qp_drawtext_recolor(ili9341_display, xpos, ypos, font_mono, buf, 0, 255, 0, 0, 0, 255);
+static uint16_t keylogger_draw(painter_device_t display, const painter_widget_t* widget) {
+    char buf[50] = {0};
+    snprintf(buf, sizeof(buf), "Keylogger: %s", display_keylogger_string);
+    return painter_widget_drawtext(display, widget, widget->x, font_mono, buf, 0, 255, 0);
+}
+#endif // DISPLAY_KEYLOGGER_ENABLE
 
-            if (max_klog_xpos < xpos) {
-                max_klog_xpos = xpos;
-            }
-            // qp_rect(ili9341_display, xpos, ypos, max_klog_xpos, ypos + font->line_height, 0, 0, 255, true);
-            keylogger_has_changed = false;
+#ifdef RTC_ENABLE
+static uint32_t rtc_key(const painter_widget_t* widget) {
+    // the date/time strings are cached in the rtc code, so this only redraws when the second changes
+    return painter_widget_key_mix(rtc_is_connected() ? rtc_read_time_struct().unixtime : 0, ili9341_hue);
+}
+
+static uint16_t rtc_draw(painter_device_t display, const painter_widget_t* widget) {
+    char buf[50] = {0};
+    snprintf(buf, sizeof(buf), "RTC Date/Time: %s", rtc_read_date_time_str());
+    return draw_hue_text(display, widget, buf);
+}
+#endif // RTC_ENABLE
+
+#ifdef LAYER_MAP_ENABLE
+static uint8_t layer_map_generation = 0;
+
+static uint32_t layer_map_key(const painter_widget_t* widget) {
+    uint32_t pressed = 0;
+    for (uint8_t x = 0; x < LAYER_MAP_COLS; x++) {
+        pressed |= (uint32_t)peek_matrix_layer_map(widget->arg, x) << (x % 32);
+    }
+    return painter_widget_key_mix(painter_widget_key_mix(layer_map_generation, pressed), ili9341_hue);
+}
+
+static uint16_t layer_map_draw(painter_device_t display, const painter_widget_t* widget) {
+    char     buf[2] = {0};
+    uint16_t xpos   = widget->x;
+    for (uint8_t x = 0; x < LAYER_MAP_COLS; x++) {
+        uint16_t keycode = extract_basic_keycode(layer_map[widget->arg][x], NULL, false);
+        if (keycode > 0xFF) {
+            keycode = KC_SPC;
         }
-#endif // DISPLAY_KEYLOGGER_ENABLE
+        buf[0] = keycode < ARRAY_SIZE(code_to_name) ? pgm_read_byte(&code_to_name[keycode]) : 0;
+        xpos += qp_drawtext_recolor(display, xpos, widget->y, font_oled, buf, ili9341_hue, 255, 255, 0, 0,
+                                    peek_matrix_layer_map(widget->arg, x) ? 255 : 0) +
+                5;
+    }
+    return xpos;
+}
+#endif // LAYER_MAP_ENABLE
 
-        // RTC
-        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/**
+ * @brief Adds a widget to the status screen
+ *
+ * @param x left edge
+ * @param y top edge
+ * @param width width in pixels
+ * @param key key callback
+ * @param draw draw callback
+ * @param arg widget specific argument, such as a row index
+ * @return uint16_t x position after the widget
+ */
+static uint16_t add_widget(uint16_t x, uint16_t y, uint16_t width, painter_widget_key_t key, painter_widget_draw_t draw,
+                           uint8_t arg) {
+    if (ili9341_widget_count < ILI9341_WIDGETS_MAX) {
+        ili9341_widgets[ili9341_widget_count++] = (painter_widget_t){
+            .x      = x,
+            .y      = y,
+            .width  = width,
+            .height = font_oled->line_height,
+            .key    = key,
+            .draw   = draw,
+            .arg    = arg,
+        };
+    }
+    return x + width;
+}
+
+/**
+ * @brief Lays out the status widgets. Numbers are given room for their widest value, so nothing moves around.
+ *
+ * @param width display width
+ * @param height display height
+ */
+static void init_widgets_ili9341(uint16_t width, uint16_t height) {
+    const uint16_t line = font_oled->line_height + 4;
+    uint16_t       ypos = 18;
+    uint16_t       xpos = 5;
+
+    ili9341_widget_count = 0;
+
+#ifdef QP_LOCK_LOGO_ENABLE
+    add_widget(5, ypos, lock_caps_on->width + lock_num_on->width + lock_scrl_on->width + 8, lock_images_key,
+               lock_images_draw, 0);
+    ili9341_widgets[ili9341_widget_count - 1].height = lock_caps_on->height;
+    ypos += lock_caps_on->height + 4;
+#endif // QP_LOCK_LOGO_ENABLE
+
+#ifdef WPM_ENABLE
+    xpos = add_widget(xpos, ypos, qp_textwidth(font_oled, "WPM: 000"), wpm_key, wpm_draw, 0) + 10;
+#endif // WPM_ENABLE
+    xpos = add_widget(xpos, ypos, qp_textwidth(font_oled, "SCANS: 0000"), scan_rate_key, scan_rate_draw, 0) + 10;
+#ifdef POINTING_DEVICE_ENABLE
+    add_widget(xpos, ypos, qp_textwidth(font_oled, "CPI: 00000"), cpi_key, cpi_draw, 0);
+
+    ypos += line;
+    xpos = add_widget(5, ypos, qp_textwidth(font_oled, "DRAG SCROLL"), drag_scroll_key, drag_scroll_draw, 0) + 10;
+#    ifdef POINTING_DEVICE_AUTO_MOUSE_ENABLE
+    xpos = add_widget(xpos, ypos, qp_textwidth(font_oled, "Auto Layer"), auto_mouse_key, auto_mouse_draw, 0) + 10;
+#    endif // POINTING_DEVICE_AUTO_MOUSE_ENABLE
+    add_widget(xpos, ypos, qp_textwidth(font_oled, "Sniping"), sniping_key, sniping_draw, 0);
+#endif // POINTING_DEVICE_ENABLE
+
+    ypos += line;
+    // the OS logo is taller than a line of text, so the widget owns its full height
+    add_widget(5, ypos, width - 10, keymap_config_key, keymap_config_draw, 0);
+    ili9341_widgets[ili9341_widget_count - 1].height = windows_logo->height;
+    ypos += windows_logo->height + 4;
+    add_widget(5, ypos, width - 10, user_state_key, user_state_draw, 0);
+    ypos += line;
+    add_widget(5, ypos, width - 10, locks_key, locks_draw, 0);
+    ypos += line;
+    add_widget(5, ypos, width - 10, mods_key, mods_draw, 0);
+
+#ifdef RGBLIGHT_ENABLE
+    ypos += line;
+    add_widget(5, ypos, width - 10, rgblight_mode_key, rgblight_mode_draw, 0);
+    ypos += line;
+    add_widget(5, ypos, qp_textwidth(font_oled, "RGB Light HSV: 000, 000, 000") + 25, rgblight_hsv_key,
+               rgblight_hsv_draw, 0);
+#endif // RGBLIGHT_ENABLE
+#ifdef RGB_MATRIX_ENABLE
+    ypos += line;
+    add_widget(5, ypos, width - 10, rgb_matrix_mode_key, rgb_matrix_mode_draw, 0);
+    ypos += line;
+    add_widget(5, ypos, qp_textwidth(font_oled, "RGB Matrix HSV: 000, 000, 000") + 25, rgb_matrix_hsv_key,
+               rgb_matrix_hsv_draw, 0);
+#endif // RGB_MATRIX_ENABLE
+
+    ypos += line;
+    xpos = add_widget(5, ypos, qp_textwidth(font_oled, "LAYOUT: COLEMAK_DH"), layout_key, layout_draw, 0);
+    add_widget(xpos, ypos, width - 5 - xpos, layer_key, layer_draw, 0);
+
+#ifdef AUTOCORRECT_ENABLE
+    for (uint8_t i = 0; i < 2; i++) {
+        ypos += line;
+        add_widget(5, ypos, width - 10, autocorrect_key, autocorrect_draw, i);
+    }
+#endif // AUTOCORRECT_ENABLE
+
+#ifdef CUSTOM_SPLIT_TRANSPORT_SYNC
+    for (uint8_t i = 0; i < TRANSPORT_STATS_COUNT; i++) {
+        ypos += line;
+        add_widget(5, ypos, width - 10, transport_stats_key, transport_stats_draw, i);
+    }
+    ypos += line;
+    add_widget(5, ypos, width - 10, transport_stats_key, peer_telemetry_draw, 0);
+#endif // CUSTOM_SPLIT_TRANSPORT_SYNC
+
+    // the rest are stacked up from the bottom of the screen
+    ypos = height - (font_mono->line_height + 2);
+#ifdef DISPLAY_KEYLOGGER_ENABLE
+    add_widget(27, ypos, width - 32, keylogger_key, keylogger_draw, 0);
+    ili9341_widgets[ili9341_widget_count - 1].height = font_mono->line_height;
+    ili9341_widgets[ili9341_widget_count - 1].bg_val = 255;
+#endif // DISPLAY_KEYLOGGER_ENABLE
 
 #ifdef RTC_ENABLE
-        ypos -= (font_oled->line_height + 4);
-        static uint16_t rtc_timer  = 0;
-        bool            rtc_redraw = false;
-        if (timer_elapsed(rtc_timer) > 125 && rtc_is_connected()) {
-            rtc_timer  = timer_read();
-            rtc_redraw = true;
-        }
-        if (hue_redraw || rtc_redraw) {
-            static uint16_t max_rtc_xpos = 0;
-            xpos                         = 5;
-            snprintf(buf, sizeof(buf), "RTC Date/Time: %s", rtc_read_date_time_str());
-
-            uint8_t title_width = qp_textwidth(font_oled, buf);
-            if (title_width > (width - 6)) {
-                title_width = width - 6;
-            }
-            uint8_t title_xpos = (width - title_width) / 2;
+    ypos -= line;
+    uint16_t rtc_width = qp_textwidth(font_oled, "RTC Date/Time: 00/00/0000 00:00:00");
+    if (rtc_width > width - 6) {
+        rtc_width = width - 6;
+    }
+    add_widget((width - rtc_width) / 2, ypos, rtc_width, rtc_key, rtc_draw, 0);
+#endif // RTC_ENABLE
+
+#ifdef LAYER_MAP_ENABLE
+    ypos -= line * LAYER_MAP_ROWS;
+    for (uint8_t y = 0; y < LAYER_MAP_ROWS; y++) {
+        add_widget(25, ypos + line * y, width - 30, layer_map_key, layer_map_draw, y);
+    }
+#endif // LAYER_MAP_ENABLE
+
+    painter_widgets_invalidate(ili9341_widget_states, ili9341_widget_count);
+}
+
+void ili9341_display_power(bool on) {
+    qp_power(ili9341_display, on);
+}
 
-            xpos += qp_drawtext_recolor(ili9341_display, title_xpos, ypos, font_oled, buf, curr_hue, 255, 255, curr_hue,
-                                        255, 0);
-            if (max_rtc_xpos < xpos) {
-                max_rtc_xpos = xpos;
+__attribute__((weak)) void ili9341_draw_user(void) {
+    uint16_t width;
+    uint16_t height;
+    qp_get_geometry(ili9341_display, &width, &height, NULL, NULL, NULL);
+
+    if (is_keyboard_master()) {
+        bool        render_menu(painter_device_t display, uint16_t width, uint16_t height);
+        static bool menu_on_screen = false;
+        bool        menu_temp      = render_menu(ili9341_display, width, height);
+        if (menu_temp != menu_on_screen) {
+            menu_on_screen = menu_temp;
+            if (!menu_on_screen) {
+                render_frame(ili9341_display);
+                painter_widgets_invalidate(ili9341_widget_states, ili9341_widget_count);
             }
-            qp_rect(ili9341_display, xpos, ypos, max_rtc_xpos, ypos + font_oled->line_height, 0, 0, 0, true);
         }
-#endif // RTC_ENABLE
-
-        //  Layer Map render
-        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        if (menu_on_screen) {
+            qp_flush(ili9341_display);
+            return;
+        }
 
+#if defined(RGBLIGHT_ENABLE) || defined(RGB_MATRIX_ENABLE)
+        ili9341_hue = rgblight_get_hue();
+#endif // RGBLIGHT_ENABLE || RGB_MATRIX_ENABLE
 #ifdef LAYER_MAP_ENABLE
-        ypos -= (font_oled->line_height + 4) * LAYER_MAP_ROWS;
-        if (hue_redraw || layer_map_has_updated) {
-            uint16_t temp_ypos = ypos;
-            for (uint8_t y = 0; y < LAYER_MAP_ROWS; y++) {
-                xpos = 25;
-                for (uint8_t x = 0; x < LAYER_MAP_COLS; x++) {
-                    uint16_t keycode = extract_basic_keycode(layer_map[y][x], NULL, false);
-                    char     code    = 0;
-                    if (keycode > 0xFF) {
-                        keycode = KC_SPC;
-                    }
-                    if (keycode < ARRAY_SIZE(code_to_name)) {
-                        code = pgm_read_byte(&code_to_name[keycode]);
-                    }
-                    snprintf(buf, sizeof(buf), "%c", code);
-                    xpos += qp_drawtext_recolor(ili9341_display, xpos, temp_ypos, font_oled, buf, curr_hue, 255, 255, 0,
-                                                0, peek_matrix_layer_map(y, x) ? 255 : 0) +
-                            5;
-                }
-                temp_ypos += font_oled->line_height + 4;
-            }
+        if (layer_map_has_updated) {
             layer_map_has_updated = false;
+            layer_map_generation++;
+        }
+#endif // LAYER_MAP_ENABLE
+
+        // only flush if something was actually drawn
+        if (painter_widgets_render(ili9341_display, ili9341_widgets, ili9341_widget_states, ili9341_widget_count)) {
+            qp_flush(ili9341_display);
         }
-#endif
     }
-    qp_flush(ili9341_display);
 }
@@ -8,57 +8,197 @@
 #    include "display/painter/ili9341_display.h"
 #endif // QUANTUM_PAINTER_ILI9341_ENABLE && CUSTOM_QUANTUM_PAINTER_ILI9341
 
+#ifndef PAINTER_FONT_WIDTHS_MAX
+#    define PAINTER_FONT_WIDTHS_MAX 4
+#endif // PAINTER_FONT_WIDTHS_MAX
+#ifndef TRUNCATE_TEXT_MAX_LENGTH
+#    define TRUNCATE_TEXT_MAX_LENGTH 80
+#endif // TRUNCATE_TEXT_MAX_LENGTH
+
+#define PAINTER_FONT_WIDTHS_FIRST ' '
+#define PAINTER_FONT_WIDTHS_LAST  '~'
+
+/**
+ * @brief Advance width of each printable ASCII glyph in a font
+ *
+ */
+typedef struct {
+    painter_font_handle_t font;
+    uint8_t               advance[PAINTER_FONT_WIDTHS_LAST - PAINTER_FONT_WIDTHS_FIRST + 1];
+} painter_font_widths_t;
+
+static painter_font_widths_t painter_font_widths[PAINTER_FONT_WIDTHS_MAX] = {0};
+
+/**
+ * @brief Loads a font, and builds a table of its glyph widths, so that text can be measured without decoding glyphs
+ *
+ * @param buffer font data
+ * @return painter_font_handle_t font handle, NULL on failure
+ */
+painter_font_handle_t painter_load_font_mem(const void* buffer) {
+    painter_font_handle_t font = qp_load_font_mem(buffer);
+    if (!font) {
+        return NULL;
+    }
+    for (uint8_t i = 0; i < PAINTER_FONT_WIDTHS_MAX; i++) {
+        painter_font_widths_t* widths = &painter_font_widths[i];
+        if (widths->font == NULL || widths->font == font) {
+            char glyph[2] = {0};
+            for (uint8_t c = PAINTER_FONT_WIDTHS_FIRST; c <= PAINTER_FONT_WIDTHS_LAST; c++) {
+                glyph[0]                                       = c;
+                widths->advance[c - PAINTER_FONT_WIDTHS_FIRST] = qp_textwidth(font, glyph);
+            }
+            widths->font = font;
+            break;
+        }
+    }
+    return font;
+}
+
+/**
+ * @brief Measures ranges of a string, from the glyph width table if possible
+ *
+ */
+typedef struct {
+    painter_font_handle_t font;
+    const char*           text;
+    const uint16_t*       prefix;
+} text_measure_t;
+
+/**
+ * @brief Fills in the running width of the text, after each character
+ *
+ * @param font font being used
+ * @param text text to measure
+ * @param len length of the text
+ * @param prefix width of the first n characters, for each n up to len
+ * @return true if every glyph was in the font's width table
+ */
+static bool text_prefix_widths(painter_font_handle_t font, const char* text, size_t len, uint16_t* prefix) {
+    const painter_font_widths_t* widths = NULL;
+    for (uint8_t i = 0; i < PAINTER_FONT_WIDTHS_MAX; i++) {
+        if (painter_font_widths[i].font == font) {
+            widths = &painter_font_widths[i];
+            break;
+        }
+    }
+    if (!widths) {
+        return false;
+    }
+    prefix[0] = 0;
+    for (size_t i = 0; i < len; i++) {
+        uint8_t c = text[i];
+        if (c < PAINTER_FONT_WIDTHS_FIRST || c > PAINTER_FONT_WIDTHS_LAST) {
+            return false;
+        }
+        prefix[i + 1] = prefix[i] + widths->advance[c - PAINTER_FONT_WIDTHS_FIRST];
+    }
+    return true;
+}
+
+/**
+ * @brief Width of the characters from start up to (but not including) end
+ *
+ */
+static uint16_t text_range_width(const text_measure_t* measure, size_t start, size_t end) {
+    if (measure->prefix) {
+        return measure->prefix[end] - measure->prefix[start];
+    }
+    // no width table, so this has to decode the glyphs
+    char temp[TRUNCATE_TEXT_MAX_LENGTH + 1];
+    memcpy(temp, measure->text + start, end - start);
+    temp[end - start] = '\0';
+    return qp_textwidth(measure->font, temp);
+}
+
 /**
  * @brief Truncates text to fit within a certain width
  *
+ * The cut point is found with a binary search over the running width of the text, so each call only measures the
+ * text a handful of times, and with a width table from painter_load_font_mem(), doesn't decode any glyphs at all.
+ *
  * @param text original text
  * @param max_width max width in pixels
  * @param font font being used
+ * @param from_start remove characters from the start of the text, instead of the end
+ * @param add_ellipses add "..." where the text was cut
+ * @param buffer buffer for the truncated text (may be the same as text), or NULL to use a shared static buffer
+ * @param size size of the buffer
  * @return char* truncated text
  */
 char* truncate_text(const char* text, uint16_t max_width, painter_font_handle_t font, bool from_start,
-                    bool add_ellipses) {
+                    bool add_ellipses, char* buffer, size_t size) {
     static char truncated_text[50];
-    strncpy(truncated_text, text, sizeof(truncated_text) - 1);
-    truncated_text[sizeof(truncated_text) - 1] = '\0';
+    if (!buffer || !size) {
+        buffer = truncated_text;
+        size   = sizeof(truncated_text);
+    }
+
+    size_t len = strlen(text);
+    if (len > size - 1) {
+        len = size - 1;
+    }
+    if (len > TRUNCATE_TEXT_MAX_LENGTH) {
+        len = TRUNCATE_TEXT_MAX_LENGTH;
+    }
+    uint16_t       prefix[TRUNCATE_TEXT_MAX_LENGTH + 1];
+    text_measure_t measure = {
+        .font   = font,
+        .text   = text,
+        .prefix = text_prefix_widths(font, text, len, prefix) ? prefix : NULL,
+    };
 
-    uint16_t text_width = qp_textwidth(font, truncated_text);
-    if (text_width <= max_width) {
-        return truncated_text;
+    if (text_range_width(&measure, 0, len) <= max_width) {
+        memmove(buffer, text, len);
+        buffer[len] = '\0';
+        return buffer;
     }
 
-    size_t      len            = strlen(truncated_text);
     const char* ellipses       = "...";
+    size_t      ellipses_len   = add_ellipses ? strlen(ellipses) : 0;
     uint16_t    ellipses_width = add_ellipses ? qp_textwidth(font, ellipses) : 0;
+    uint16_t    available      = max_width > ellipses_width ? max_width - ellipses_width : 0;
+    if (ellipses_len > size - 1) {
+        ellipses_len = 0;
+    }
 
     if (from_start) {
-        size_t start_index = 0;
-        while (start_index < len && text_width > max_width - ellipses_width) {
-            start_index++;
-            text_width = qp_textwidth(font, truncated_text + start_index);
+        // find the first character that the rest of the text fits after
+        size_t low = 0, high = len;
+        while (low < high) {
+            size_t mid = (low + high) / 2;
+            if (text_range_width(&measure, mid, len) <= available) {
+                high = mid;
+            } else {
+                low = mid + 1;
+            }
         }
-
-        if (add_ellipses) {
-            char temp[75];
-            snprintf(temp, sizeof(temp), "%s%s", ellipses, truncated_text + start_index);
-            strncpy(truncated_text, temp, sizeof(truncated_text) - 1);
-            truncated_text[sizeof(truncated_text) - 1] = '\0';
-        } else {
-            memmove(truncated_text, truncated_text + start_index, len - start_index + 1);
+        if (len - low + ellipses_len > size - 1) {
+            low = len - (size - 1 - ellipses_len);
         }
+        memmove(buffer + ellipses_len, text + low, len - low);
+        memcpy(buffer, ellipses, ellipses_len);
+        buffer[ellipses_len + len - low] = '\0';
     } else {
-        while (len > 0 && text_width > max_width - ellipses_width) {
-            len--;
-            truncated_text[len] = '\0';
-            text_width          = qp_textwidth(font, truncated_text);
+        // find the most characters that fit
+        size_t low = 0, high = len;
+        while (low < high) {
+            size_t mid = (low + high + 1) / 2;
+            if (text_range_width(&measure, 0, mid) <= available) {
+                low = mid;
+            } else {
+                high = mid - 1;
+            }
         }
-
-        if (add_ellipses) {
-            snprintf(truncated_text + len, sizeof(truncated_text) - len, "%s", ellipses);
+        if (low + ellipses_len > size - 1) {
+            low = size - 1 - ellipses_len;
         }
+        memmove(buffer, text, low);
+        memcpy(buffer + low, ellipses, ellipses_len);
+        buffer[low + ellipses_len] = '\0';
     }
 
-    return truncated_text;
+    return buffer;
 }
 
 /**
@@ -107,6 +247,37 @@ void render_character_set(painter_device_t display, uint16_t* x_offset, uint16_t
     }
 }
 
+#ifdef PAINTER_SCRATCH_SURFACE_ENABLE
+static uint16_t         painter_scratch_buffer[PAINTER_SCRATCH_SURFACE_WIDTH * PAINTER_SCRATCH_SURFACE_HEIGHT];
+static painter_device_t painter_scratch_device = NULL;
+#endif // PAINTER_SCRATCH_SURFACE_ENABLE
+
+/**
+ * @brief Gets the scratch surface, that text and images are rendered into, to be copied out of again.
+ *
+ * RGB565 surfaces store 16 bits per pixel in the panel's native format, row by row, PAINTER_SCRATCH_SURFACE_WIDTH
+ * pixels wide. Nothing should be left in it between calls, as anything can draw over it.
+ *
+ * @param surface set to the surface device
+ * @return uint16_t* surface pixel buffer, or NULL if it isn't available
+ */
+uint16_t* painter_scratch_surface(painter_device_t* surface) {
+#ifdef PAINTER_SCRATCH_SURFACE_ENABLE
+    if (!painter_scratch_device) {
+        painter_device_t device = qp_rgb565_make_surface(PAINTER_SCRATCH_SURFACE_WIDTH, PAINTER_SCRATCH_SURFACE_HEIGHT,
+                                                         painter_scratch_buffer);
+        if (!device || !qp_init(device, QP_ROTATION_0)) {
+            return NULL;
+        }
+        painter_scratch_device = device;
+    }
+    *surface = painter_scratch_device;
+    return painter_scratch_buffer;
+#else
+    return NULL;
+#endif // PAINTER_SCRATCH_SURFACE_ENABLE
+}
+
 #ifdef BACKLIGHT_ENABLE
 static uint8_t last_backlight = 255;
 #endif
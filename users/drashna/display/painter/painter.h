@@ -15,8 +15,10 @@ void suspend_power_down_quantum_painter(void);
 void suspend_wakeup_init_quantum_painter(void);
 void shutdown_quantum_painter(void);
 
-char* truncate_text(const char* text, uint16_t max_width, painter_font_handle_t font, bool from_start,
-                    bool add_ellipses);
-void  render_character_set(painter_device_t display, uint16_t* x_offset, uint16_t* max_pos, uint16_t* ypos,
-                           painter_font_handle_t font, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg,
-                           uint8_t sat_bg, uint8_t val_bg);
+painter_font_handle_t painter_load_font_mem(const void* buffer);
+uint16_t*             painter_scratch_surface(painter_device_t* surface);
+char*                 truncate_text(const char* text, uint16_t max_width, painter_font_handle_t font, bool from_start,
+                                    bool add_ellipses, char* buffer, size_t size);
+void                  render_character_set(painter_device_t display, uint16_t* x_offset, uint16_t* max_pos,
+                                           uint16_t* ypos, painter_font_handle_t font, uint8_t hue_fg, uint8_t sat_fg,
+                                           uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg);
@@ -0,0 +1,241 @@
+// Copyright 2024 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @brief Recolorable images, drawn through a palette lookup table.
+ *
+ * The first time that an image is drawn, it is rendered white on black into the scratch surface, and each pixel is
+ * stored as a 4 bit index into the handful of grey levels that it uses. Each grey is matched back to the level of the
+ * image's palette that it was mixed from. For each set of colors, the levels are mixed
+ * between the foreground and background the same way that Quantum Painter does, and converted into a table of native
+ * pixels. After that, drawing the image is a viewport and a push of the table lookups, so changing the hue only
+ * rebuilds a 16 entry table, instead of decoding the QGF again. Images that aren't greyscale, are animated, or don't
+ * fit, are drawn normally.
+ */
+
+#include "display/painter/painter_palette.h"
+#include "display/painter/painter.h"
+#include <string.h>
+
+#ifdef PAINTER_PALETTE_ENABLE
+#    ifndef PAINTER_PALETTE_IMAGES
+#        define PAINTER_PALETTE_IMAGES 8
+#    endif // PAINTER_PALETTE_IMAGES
+#    ifndef PAINTER_PALETTE_POOL_BYTES
+#        define PAINTER_PALETTE_POOL_BYTES 4096
+#    endif // PAINTER_PALETTE_POOL_BYTES
+#    ifndef PAINTER_PALETTE_PUSH_PIXELS
+#        define PAINTER_PALETTE_PUSH_PIXELS 256
+#    endif // PAINTER_PALETTE_PUSH_PIXELS
+#    define PAINTER_PALETTE_LEVELS 16
+
+#    if PAINTER_SCRATCH_SURFACE_WIDTH * PAINTER_SCRATCH_SURFACE_HEIGHT < 256
+#        error "The scratch surface needs room for all 256 grey levels"
+#    endif
+
+/**
+ * @brief An image converted to palette indices, and the lookup table for the colors that it was last drawn with
+ *
+ */
+typedef struct {
+    painter_image_handle_t image;
+    bool                   usable;
+    bool                   lut_valid;
+    uint8_t                level_count;
+    uint16_t               steps;
+    uint8_t                levels[PAINTER_PALETTE_LEVELS];
+    uint8_t                lut_colors[6];
+    uint16_t               lut[PAINTER_PALETTE_LEVELS];
+    uint16_t               offset;
+} painter_palette_entry_t;
+
+static painter_palette_entry_t painter_palette_entries[PAINTER_PALETTE_IMAGES];
+static uint8_t                 painter_palette_entry_count = 0;
+static uint8_t                 painter_palette_pool[PAINTER_PALETTE_POOL_BYTES];
+static uint16_t                painter_palette_pool_used = 0;
+static uint16_t                painter_palette_push_buffer[PAINTER_PALETTE_PUSH_PIXELS];
+
+/**
+ * @brief Converts an image into palette indices, and works out which palette level each index was drawn from
+ *
+ * @param entry entry to fill in
+ * @return true if the image can be drawn through the palette
+ */
+static bool painter_palette_convert(painter_palette_entry_t *entry) {
+    painter_image_handle_t image = entry->image;
+    uint32_t               size  = (uint32_t)image->width * image->height;
+    if (image->frame_count > 1 || image->width > PAINTER_SCRATCH_SURFACE_WIDTH ||
+        image->height > PAINTER_SCRATCH_SURFACE_HEIGHT ||
+        painter_palette_pool_used + (size + 1) / 2 > PAINTER_PALETTE_POOL_BYTES) {
+        return false;
+    }
+    painter_device_t surface;
+    uint16_t        *buffer = painter_scratch_surface(&surface);
+    if (!buffer || !qp_drawimage_recolor(surface, 0, 0, image, 0, 0, 255, 0, 0, 0)) {
+        return false;
+    }
+
+    uint16_t natives[PAINTER_PALETTE_LEVELS];
+    uint8_t *indices = &painter_palette_pool[painter_palette_pool_used];
+    uint8_t  count   = 0;
+    for (uint32_t i = 0; i < size; i++) {
+        uint16_t native = buffer[(i / image->width) * PAINTER_SCRATCH_SURFACE_WIDTH + i % image->width];
+        uint8_t  index  = 0;
+        while (index < count && natives[index] != native) {
+            index++;
+        }
+        if (index == count) {
+            if (count == PAINTER_PALETTE_LEVELS) {
+                return false;
+            }
+            natives[count++] = native;
+        }
+        if (i & 1) {
+            indices[i / 2] |= index << 4;
+        } else {
+            indices[i / 2] = index;
+        }
+    }
+
+    // render every grey level, to find which levels each native pixel could have come from
+    uint8_t first[PAINTER_PALETTE_LEVELS], last[PAINTER_PALETTE_LEVELS];
+    for (uint16_t v = 0; v < 256; v++) {
+        qp_setpixel(surface, v % PAINTER_SCRATCH_SURFACE_WIDTH, v / PAINTER_SCRATCH_SURFACE_WIDTH, 0, 0, v);
+    }
+    for (uint8_t index = 0; index < count; index++) {
+        uint16_t v = 0;
+        while (v < 256 && buffer[v] != natives[index]) {
+            v++;
+        }
+        if (v == 256) {
+            // not grey, so the image has its own palette, and can't be recolored
+            return false;
+        }
+        first[index] = v;
+        while (v < 256 && buffer[v] == natives[index]) {
+            v++;
+        }
+        last[index] = v - 1;
+    }
+
+    // then find the palette size that the image was drawn with, so that the levels can be mixed exactly
+    static const uint16_t palette_steps[] = {2, 4, 16, 256};
+    for (uint8_t p = 0; p < ARRAY_SIZE(palette_steps) && !entry->steps; p++) {
+        uint16_t steps = palette_steps[p];
+        uint8_t  index = 0;
+        for (; index < count; index++) {
+            int16_t low = -1, high = -1;
+            for (uint16_t i = 0; i < steps; i++) {
+                uint8_t v = (uint8_t)(255 - 255 * ((float)i / (steps - 1)));
+                if (v >= first[index] && v <= last[index]) {
+                    low  = low < 0 ? i : low;
+                    high = i;
+                }
+            }
+            if (low < 0) {
+                break;
+            }
+            entry->levels[index] = (low + high) / 2;
+        }
+        if (index == count) {
+            entry->steps = steps;
+        }
+    }
+    if (!entry->steps) {
+        return false;
+    }
+    entry->level_count = count;
+    entry->offset      = painter_palette_pool_used;
+    painter_palette_pool_used += (size + 1) / 2;
+    return true;
+}
+
+/**
+ * @brief Finds the entry for an image, converting it if this is the first time that it has been drawn
+ *
+ * @return painter_palette_entry_t* entry, or NULL if the image has to be drawn normally
+ */
+static painter_palette_entry_t *painter_palette_lookup(painter_image_handle_t image) {
+    for (uint8_t i = 0; i < painter_palette_entry_count; i++) {
+        if (painter_palette_entries[i].image == image) {
+            return painter_palette_entries[i].usable ? &painter_palette_entries[i] : NULL;
+        }
+    }
+    if (painter_palette_entry_count == PAINTER_PALETTE_IMAGES) {
+        return NULL;
+    }
+    painter_palette_entry_t *entry = &painter_palette_entries[painter_palette_entry_count++];
+    *entry                         = (painter_palette_entry_t){.image = image};
+    entry->usable                  = painter_palette_convert(entry);
+    return entry->usable ? entry : NULL;
+}
+
+/**
+ * @brief Builds the lookup table for a set of colors, mixing each level between the foreground and background the
+ * same way that Quantum Painter interpolates its palettes, and converting them to native pixels with the surface.
+ *
+ * @return true if the lookup table is ready
+ */
+static bool painter_palette_build_lut(painter_palette_entry_t *entry, const uint8_t colors[6]) {
+    if (entry->lut_valid && memcmp(entry->lut_colors, colors, sizeof(entry->lut_colors)) == 0) {
+        return true;
+    }
+    painter_device_t surface;
+    uint16_t        *buffer = painter_scratch_surface(&surface);
+    if (!buffer) {
+        return false;
+    }
+
+    // take the shortest route around the hue wheel
+    int16_t hue_fg = colors[0];
+    int16_t hue_bg = colors[3];
+    if (hue_bg - hue_fg > 128) {
+        hue_bg -= 256;
+    } else if (hue_fg - hue_bg > 128) {
+        hue_bg += 256;
+    }
+    for (uint8_t index = 0; index < entry->level_count; index++) {
+        float mix = (float)entry->levels[index] / (entry->steps - 1);
+        qp_setpixel(surface, index, 0, (uint8_t)(hue_fg + (hue_bg - hue_fg) * mix),
+                    (uint8_t)(colors[1] + (colors[4] - colors[1]) * mix),
+                    (uint8_t)(colors[2] + (colors[5] - colors[2]) * mix));
+    }
+    memcpy(entry->lut, buffer, entry->level_count * sizeof(uint16_t));
+    memcpy(entry->lut_colors, colors, sizeof(entry->lut_colors));
+    entry->lut_valid = true;
+    return true;
+}
+#endif // PAINTER_PALETTE_ENABLE
+
+/**
+ * @brief Draws a recolored image through its palette lookup table if possible. Same as qp_drawimage_recolor(),
+ * otherwise.
+ *
+ * @return true if the image was drawn
+ */
+bool painter_palette_drawimage_recolor(painter_device_t display, uint16_t x, uint16_t y, painter_image_handle_t image,
+                                       uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg,
+                                       uint8_t val_bg) {
+#ifdef PAINTER_PALETTE_ENABLE
+    const uint8_t            colors[6] = {hue_fg, sat_fg, val_fg, hue_bg, sat_bg, val_bg};
+    painter_palette_entry_t *entry     = painter_palette_lookup(image);
+    if (entry && painter_palette_build_lut(entry, colors)) {
+        const uint8_t *indices = &painter_palette_pool[entry->offset];
+        uint32_t       size    = (uint32_t)image->width * image->height;
+        if (!qp_viewport(display, x, y, x + image->width - 1, y + image->height - 1)) {
+            return false;
+        }
+        for (uint32_t i = 0; i < size;) {
+            uint16_t count = size - i > PAINTER_PALETTE_PUSH_PIXELS ? PAINTER_PALETTE_PUSH_PIXELS : size - i;
+            for (uint16_t j = 0; j < count; j++, i++) {
+                painter_palette_push_buffer[j] = entry->lut[(indices[i / 2] >> ((i & 1) * 4)) & 0x0F];
+            }
+            if (!qp_pixdata(display, painter_palette_push_buffer, count)) {
+                return false;
+            }
+        }
+        return true;
+    }
+#endif // PAINTER_PALETTE_ENABLE
+    return qp_drawimage_recolor(display, x, y, image, hue_fg, sat_fg, val_fg, hue_bg, sat_bg, val_bg);
+}
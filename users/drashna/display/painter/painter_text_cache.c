@@ -0,0 +1,111 @@
+// Copyright 2024 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @brief Small LRU cache of pre-rendered text, for labels that get redrawn a lot.
+ *
+ * On a miss, the text is rendered into the scratch surface, and the pixels are copied into a cache slot. After that,
+ * drawing the same text in the same font and colors is just a viewport and a push of the cached pixels, without any
+ * glyph decoding. Text that is too long, or too big for a slot, is drawn directly.
+ */
+
+#include "display/painter/painter_text_cache.h"
+#include "display/painter/painter.h"
+#include <string.h>
+
+#ifdef PAINTER_TEXT_CACHE_ENABLE
+#    ifndef PAINTER_TEXT_CACHE_SLOTS
+#        define PAINTER_TEXT_CACHE_SLOTS 8
+#    endif // PAINTER_TEXT_CACHE_SLOTS
+#    ifndef PAINTER_TEXT_CACHE_SLOT_PIXELS
+#        define PAINTER_TEXT_CACHE_SLOT_PIXELS 1024
+#    endif // PAINTER_TEXT_CACHE_SLOT_PIXELS
+#    ifndef PAINTER_TEXT_CACHE_TEXT_LENGTH
+#        define PAINTER_TEXT_CACHE_TEXT_LENGTH 12
+#    endif // PAINTER_TEXT_CACHE_TEXT_LENGTH
+
+/**
+ * @brief A cached piece of text, and what it was rendered with
+ *
+ */
+typedef struct {
+    painter_font_handle_t font;
+    char                  text[PAINTER_TEXT_CACHE_TEXT_LENGTH + 1];
+    uint8_t               colors[6];
+    uint16_t              width;
+    uint16_t              height;
+    uint32_t              last_used;
+} painter_text_cache_entry_t;
+
+static painter_text_cache_entry_t painter_text_cache_entries[PAINTER_TEXT_CACHE_SLOTS];
+static uint16_t                   painter_text_cache_pixels[PAINTER_TEXT_CACHE_SLOTS][PAINTER_TEXT_CACHE_SLOT_PIXELS];
+static uint32_t                   painter_text_cache_clock = 0;
+
+/**
+ * @brief Finds the cache slot for the text, rendering it into the least recently used slot if it isn't cached
+ *
+ * @return painter_text_cache_entry_t* slot, or NULL if the text can't be cached
+ */
+static painter_text_cache_entry_t *painter_text_cache_lookup(painter_font_handle_t font, const char *text,
+                                                             const uint8_t colors[6]) {
+    painter_text_cache_entry_t *victim = &painter_text_cache_entries[0];
+    for (uint8_t i = 0; i < PAINTER_TEXT_CACHE_SLOTS; i++) {
+        painter_text_cache_entry_t *entry = &painter_text_cache_entries[i];
+        if (entry->font == font && memcmp(entry->colors, colors, sizeof(entry->colors)) == 0 &&
+            strcmp(entry->text, text) == 0) {
+            return entry;
+        }
+        if (entry->last_used < victim->last_used) {
+            victim = entry;
+        }
+    }
+
+    uint16_t width  = qp_textwidth(font, text);
+    uint16_t height = font->line_height;
+    if (width == 0 || width > PAINTER_SCRATCH_SURFACE_WIDTH || height > PAINTER_SCRATCH_SURFACE_HEIGHT ||
+        (uint32_t)width * height > PAINTER_TEXT_CACHE_SLOT_PIXELS) {
+        return NULL;
+    }
+    painter_device_t surface;
+    uint16_t        *buffer = painter_scratch_surface(&surface);
+    if (!buffer) {
+        return NULL;
+    }
+    qp_drawtext_recolor(surface, 0, 0, font, text, colors[0], colors[1], colors[2], colors[3], colors[4], colors[5]);
+
+    uint16_t *pixels = painter_text_cache_pixels[victim - painter_text_cache_entries];
+    for (uint16_t y = 0; y < height; y++) {
+        memcpy(&pixels[y * width], &buffer[y * PAINTER_SCRATCH_SURFACE_WIDTH], width * sizeof(uint16_t));
+    }
+    victim->font = font;
+    strcpy(victim->text, text);
+    memcpy(victim->colors, colors, sizeof(victim->colors));
+    victim->width  = width;
+    victim->height = height;
+    return victim;
+}
+#endif // PAINTER_TEXT_CACHE_ENABLE
+
+/**
+ * @brief Draws text, from the cache if possible. Same as qp_drawtext_recolor(), otherwise.
+ *
+ * @return int16_t width of the text drawn
+ */
+int16_t painter_text_cache_draw(painter_device_t display, uint16_t x, uint16_t y, painter_font_handle_t font,
+                                const char *text, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg,
+                                uint8_t sat_bg, uint8_t val_bg) {
+#ifdef PAINTER_TEXT_CACHE_ENABLE
+    if (strlen(text) <= PAINTER_TEXT_CACHE_TEXT_LENGTH) {
+        const uint8_t               colors[6] = {hue_fg, sat_fg, val_fg, hue_bg, sat_bg, val_bg};
+        painter_text_cache_entry_t *entry     = painter_text_cache_lookup(font, text, colors);
+        if (entry) {
+            entry->last_used = ++painter_text_cache_clock;
+            qp_viewport(display, x, y, x + entry->width - 1, y + entry->height - 1);
+            qp_pixdata(display, painter_text_cache_pixels[entry - painter_text_cache_entries],
+                       (uint32_t)entry->width * entry->height);
+            return entry->width;
+        }
+    }
+#endif // PAINTER_TEXT_CACHE_ENABLE
+    return qp_drawtext_recolor(display, x, y, font, text, hue_fg, sat_fg, val_fg, hue_bg, sat_bg, val_bg);
+}
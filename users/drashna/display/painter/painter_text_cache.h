@@ -0,0 +1,12 @@
+// Copyright 2024 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "qp.h"
+
+int16_t painter_text_cache_draw(painter_device_t display, uint16_t x, uint16_t y, painter_font_handle_t font,
+                                const char *text, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg,
+                                uint8_t sat_bg, uint8_t val_bg);
@@ -0,0 +1,385 @@
+// Copyright 2024 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @brief Retained widgets for the Quantum Painter displays.
+ *
+ * Each widget owns a fixed rectangle, and has a key callback that returns a compact key of the state that it shows.
+ * Each pass, only the widgets whose key has changed are drawn. The draw callback reports how far it drew, and only the
+ * part of the rectangle that the last draw covered and this one didn't is cleared. So a widget that doesn't change
+ * costs a key comparison, and no SPI traffic at all. Widgets that change together are merged into dirty regions, so
+ * that they can be pushed to the display in one go.
+ */
+
+#include "display/painter/painter_widgets.h"
+#include "display/painter/painter.h"
+#include "display/painter/painter_text_cache.h"
+
+#ifndef PAINTER_WIDGETS_MAX
+#    define PAINTER_WIDGETS_MAX 64
+#endif // PAINTER_WIDGETS_MAX
+#ifndef PAINTER_WIDGETS_MERGE_GAP
+#    define PAINTER_WIDGETS_MERGE_GAP 10
+#endif // PAINTER_WIDGETS_MERGE_GAP
+
+#ifdef PAINTER_WIDGETS_SURFACE_ENABLE
+#    ifndef PAINTER_WIDGETS_SURFACE_WIDTH
+#        define PAINTER_WIDGETS_SURFACE_WIDTH 240
+#    endif // PAINTER_WIDGETS_SURFACE_WIDTH
+#    ifndef PAINTER_WIDGETS_SURFACE_HEIGHT
+#        define PAINTER_WIDGETS_SURFACE_HEIGHT 24
+#    endif // PAINTER_WIDGETS_SURFACE_HEIGHT
+
+static uint16_t         painter_widgets_surface_buffer[PAINTER_WIDGETS_SURFACE_WIDTH * PAINTER_WIDGETS_SURFACE_HEIGHT];
+static painter_device_t painter_widgets_surface = NULL;
+#endif // PAINTER_WIDGETS_SURFACE_ENABLE
+
+/**
+ * @brief A dirty region of the display, right and bottom are exclusive
+ *
+ */
+typedef struct {
+    uint16_t left;
+    uint16_t top;
+    uint16_t right;
+    uint16_t bottom;
+} painter_dirty_rect_t;
+
+/**
+ * @brief A widget that needs to be drawn this pass, and the region that it has been merged into
+ *
+ */
+typedef struct {
+    uint32_t key;
+    uint8_t  widget;
+    uint8_t  region;
+    bool     pushed; // region was pushed from the surface (only set on the first widget of the region)
+} painter_dirty_widget_t;
+
+static painter_dirty_widget_t painter_dirty_widgets[PAINTER_WIDGETS_MAX];
+static painter_dirty_rect_t   painter_dirty_rects[PAINTER_WIDGETS_MAX];
+
+static painter_dirty_rect_t painter_widget_rect(const painter_widget_t *widget) {
+    return (painter_dirty_rect_t){
+        .left   = widget->x,
+        .top    = widget->y,
+        .right  = widget->x + widget->width,
+        .bottom = widget->y + widget->height,
+    };
+}
+
+static bool painter_dirty_rects_intersect(const painter_dirty_rect_t *a, const painter_dirty_rect_t *b) {
+    return a->left < b->right && b->left < a->right && a->top < b->bottom && b->top < a->bottom;
+}
+
+/**
+ * @brief Checks if a region can be pushed as a single transfer, which means that it has to fit in the surface
+ *
+ * @param rect region to check
+ * @return true if it fits
+ */
+static bool painter_dirty_rect_fits(const painter_dirty_rect_t *rect) {
+#ifdef PAINTER_WIDGETS_SURFACE_ENABLE
+    return rect->right - rect->left <= PAINTER_WIDGETS_SURFACE_WIDTH &&
+           rect->bottom - rect->top <= PAINTER_WIDGETS_SURFACE_HEIGHT;
+#else
+    return false;
+#endif // PAINTER_WIDGETS_SURFACE_ENABLE
+}
+
+/**
+ * @brief Checks if two dirty regions can be merged. They need to be overlapping or adjacent, share a background, and
+ * the merged region has to fit in the surface, and not cover any widget that isn't being redrawn.
+ *
+ * @param widgets widget table
+ * @param count number of widgets
+ * @param a first region
+ * @param b second region
+ * @param merged set to the merged region
+ * @return true if they can be merged
+ */
+static bool painter_dirty_rects_merge(const painter_widget_t *widgets, uint8_t count, const painter_widget_t *a_widget,
+                                      const painter_widget_t *b_widget, const painter_dirty_rect_t *a,
+                                      const painter_dirty_rect_t *b, painter_dirty_rect_t *merged) {
+    if (a_widget->bg_hue != b_widget->bg_hue || a_widget->bg_sat != b_widget->bg_sat ||
+        a_widget->bg_val != b_widget->bg_val) {
+        return false;
+    }
+    if (a->left > b->right + PAINTER_WIDGETS_MERGE_GAP || b->left > a->right + PAINTER_WIDGETS_MERGE_GAP ||
+        a->top > b->bottom || b->top > a->bottom) {
+        return false;
+    }
+    *merged = (painter_dirty_rect_t){
+        .left   = a->left < b->left ? a->left : b->left,
+        .top    = a->top < b->top ? a->top : b->top,
+        .right  = a->right > b->right ? a->right : b->right,
+        .bottom = a->bottom > b->bottom ? a->bottom : b->bottom,
+    };
+    if (!painter_dirty_rect_fits(merged)) {
+        return false;
+    }
+    // the whole region gets pushed, so it can't cover anything that isn't being drawn into it
+    for (uint8_t i = 0; i < count; i++) {
+        painter_dirty_rect_t rect = painter_widget_rect(&widgets[i]);
+        if (painter_dirty_rects_intersect(merged, &rect) && !painter_dirty_rects_intersect(a, &rect) &&
+            !painter_dirty_rects_intersect(b, &rect)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Draws a widget straight to the display, clearing whatever the last draw left behind
+ *
+ */
+static void painter_widget_draw_direct(painter_device_t display, const painter_widget_t *widget,
+                                       painter_widget_state_t *state) {
+    uint16_t right = widget->draw(display, widget);
+    if (right < widget->x) {
+        right = widget->x;
+    } else if (right > widget->x + widget->width) {
+        right = widget->x + widget->width;
+    }
+    uint16_t stale = state->right < widget->x + widget->width ? state->right : widget->x + widget->width;
+    if (stale > right) {
+        qp_rect(display, right, widget->y, stale - 1, widget->y + widget->height - 1, widget->bg_hue, widget->bg_sat,
+                widget->bg_val, true);
+    }
+    state->right = right;
+}
+
+/**
+ * @brief Draws the widgets in a merged region into the surface, and pushes it to the display as a single transfer.
+ * Since the whole region is pushed from a cleared surface, there is nothing stale left to clear.
+ *
+ * Only the region itself is pushed, rather than the surface's dirty box, so that anything drawn past the widgets'
+ * rectangles can't overwrite their neighbours with stale surface contents. The widgets' right edges are only updated
+ * once the push has succeeded.
+ *
+ * @return true if the region was pushed, false if it needs to be drawn directly instead
+ */
+static bool painter_dirty_region_draw(painter_device_t display, const painter_widget_t *widgets,
+                                      painter_widget_state_t *states, uint8_t pending, uint8_t region) {
+#ifdef PAINTER_WIDGETS_SURFACE_ENABLE
+    if (!painter_widgets_surface) {
+        painter_device_t device = qp_rgb565_make_surface(PAINTER_WIDGETS_SURFACE_WIDTH, PAINTER_WIDGETS_SURFACE_HEIGHT,
+                                                         painter_widgets_surface_buffer);
+        if (!device || !qp_init(device, QP_ROTATION_0)) {
+            return false;
+        }
+        painter_widgets_surface = device;
+    }
+    const painter_dirty_rect_t *rect   = &painter_dirty_rects[region];
+    const painter_widget_t     *first  = &widgets[painter_dirty_widgets[region].widget];
+    uint16_t                    width  = rect->right - rect->left;
+    uint16_t                    height = rect->bottom - rect->top;
+    uint16_t                    rights[PAINTER_WIDGETS_MAX];
+    qp_rect(painter_widgets_surface, 0, 0, width - 1, height - 1, first->bg_hue, first->bg_sat, first->bg_val, true);
+    for (uint8_t i = region; i < pending; i++) {
+        if (painter_dirty_widgets[i].region != region) {
+            continue;
+        }
+        painter_widget_t local = widgets[painter_dirty_widgets[i].widget];
+        local.x -= rect->left;
+        local.y -= rect->top;
+        uint16_t right = local.draw(painter_widgets_surface, &local);
+        if (right < local.x) {
+            right = local.x;
+        } else if (right > local.x + local.width) {
+            right = local.x + local.width;
+        }
+        rights[i] = rect->left + right;
+    }
+
+    if (!qp_viewport(display, rect->left, rect->top, rect->right - 1, rect->bottom - 1)) {
+        return false;
+    }
+    for (uint16_t y = 0; y < height; y++) {
+        if (!qp_pixdata(display, &painter_widgets_surface_buffer[y * PAINTER_WIDGETS_SURFACE_WIDTH], width)) {
+            return false;
+        }
+    }
+
+    // only now that the region is on screen, since if the push fails, the widgets are drawn directly instead, and need
+    // their old right edges to clear what they left behind
+    for (uint8_t i = region; i < pending; i++) {
+        if (painter_dirty_widgets[i].region == region) {
+            states[painter_dirty_widgets[i].widget].right = rights[i];
+        }
+    }
+    return true;
+#else
+    return false;
+#endif // PAINTER_WIDGETS_SURFACE_ENABLE
+}
+
+/**
+ * @brief Draws the widgets whose state has changed
+ *
+ * First, the widgets that need to be drawn are collected, and their rectangles are merged into regions wherever they
+ * overlap or sit next to each other. With PAINTER_WIDGETS_SURFACE_ENABLE, each region is drawn into an offscreen
+ * surface and pushed as one windowed transfer, instead of a window per glyph, image and clear. Anything that doesn't
+ * fit in the surface (or everything, if the surface can't be set up) is drawn directly to the display.
+ *
+ * @param display display to draw to
+ * @param widgets widget table
+ * @param states state for each widget in the table
+ * @param count number of widgets
+ * @return true if anything was drawn, so that the display needs to be flushed
+ */
+bool painter_widgets_render(painter_device_t display, const painter_widget_t *widgets,
+                            painter_widget_state_t *states, uint8_t count) {
+    uint8_t pending = 0;
+    for (uint8_t i = 0; i < count && pending < PAINTER_WIDGETS_MAX; i++) {
+        uint32_t key = widgets[i].key(&widgets[i]);
+        if (states[i].valid && states[i].key == key) {
+            continue;
+        }
+        painter_dirty_widgets[pending] = (painter_dirty_widget_t){.key = key, .widget = i, .region = pending};
+        painter_dirty_rects[pending]   = painter_widget_rect(&widgets[i]);
+        pending++;
+    }
+    if (!pending) {
+        return false;
+    }
+
+    // merge the regions, until nothing else can be merged. Each region is identified by its first widget.
+    bool merged = true;
+    while (merged) {
+        merged = false;
+        for (uint8_t a = 0; a < pending; a++) {
+            if (painter_dirty_widgets[a].region != a) {
+                continue;
+            }
+            for (uint8_t b = a + 1; b < pending; b++) {
+                painter_dirty_rect_t rect;
+                if (painter_dirty_widgets[b].region != b ||
+                    !painter_dirty_rects_merge(widgets, count, &widgets[painter_dirty_widgets[a].widget],
+                                               &widgets[painter_dirty_widgets[b].widget], &painter_dirty_rects[a],
+                                               &painter_dirty_rects[b], &rect)) {
+                    continue;
+                }
+                painter_dirty_rects[a] = rect;
+                for (uint8_t i = b; i < pending; i++) {
+                    if (painter_dirty_widgets[i].region == b) {
+                        painter_dirty_widgets[i].region = a;
+                    }
+                }
+                merged = true;
+            }
+        }
+    }
+
+    // the first widget of a region always comes before the rest of it
+    for (uint8_t i = 0; i < pending; i++) {
+        uint8_t region = painter_dirty_widgets[i].region;
+        if (region == i) {
+            painter_dirty_widgets[i].pushed = painter_dirty_rect_fits(&painter_dirty_rects[i]) &&
+                                              painter_dirty_region_draw(display, widgets, states, pending, i);
+        }
+        if (!painter_dirty_widgets[region].pushed) {
+            painter_widget_draw_direct(display, &widgets[painter_dirty_widgets[i].widget],
+                                       &states[painter_dirty_widgets[i].widget]);
+        }
+        painter_widget_state_t *state = &states[painter_dirty_widgets[i].widget];
+        state->key                    = painter_dirty_widgets[i].key;
+        state->valid                  = true;
+    }
+    return true;
+}
+
+/**
+ * @brief Forces the widgets to be redrawn on the next pass, such as after something else has drawn over them. Since
+ * there is no telling what is on screen, the whole rectangle gets cleared on the first draw.
+ *
+ * @param states state for each widget in the table
+ * @param count number of widgets
+ */
+void painter_widgets_invalidate(painter_widget_state_t *states, uint8_t count) {
+    for (uint8_t i = 0; i < count; i++) {
+        states[i].valid = false;
+        states[i].right = 0xFFFF;
+    }
+}
+
+/**
+ * @brief Draws text inside of a widget, clipped to the widget's rectangle
+ *
+ * @param display display to draw to
+ * @param widget widget being drawn
+ * @param x x position to draw the text at
+ * @param font font to use
+ * @param text text to draw
+ * @param hue_fg text hue
+ * @param sat_fg text saturation
+ * @param val_fg text value
+ * @return uint16_t x position after the text
+ */
+uint16_t painter_widget_drawtext(painter_device_t display, const painter_widget_t *widget, uint16_t x,
+                                 painter_font_handle_t font, const char *text, uint8_t hue_fg, uint8_t sat_fg,
+                                 uint8_t val_fg) {
+    uint16_t right = widget->x + widget->width;
+    if (x >= right) {
+        return x;
+    }
+    char truncated[64];
+    if (qp_textwidth(font, text) > right - x) {
+        text = truncate_text(text, right - x, font, false, false, truncated, sizeof(truncated));
+    }
+    return x + qp_drawtext_recolor(display, x, widget->y, font, text, hue_fg, sat_fg, val_fg, widget->bg_hue,
+                                   widget->bg_sat, widget->bg_val);
+}
+
+/**
+ * @brief Draws a fixed label inside of a widget, through the text cache. Labels are drawn with the same few colors over
+ * and over, so they can skip the glyph decoding once they have been cached.
+ *
+ * @param display display to draw to
+ * @param widget widget being drawn
+ * @param x x position to draw the label at
+ * @param font font to use
+ * @param text label to draw
+ * @param hue_fg text hue
+ * @param sat_fg text saturation
+ * @param val_fg text value
+ * @return uint16_t x position after the label
+ */
+uint16_t painter_widget_drawlabel(painter_device_t display, const painter_widget_t *widget, uint16_t x,
+                                  painter_font_handle_t font, const char *text, uint8_t hue_fg, uint8_t sat_fg,
+                                  uint8_t val_fg) {
+    if (x >= widget->x + widget->width || qp_textwidth(font, text) > widget->x + widget->width - x) {
+        return painter_widget_drawtext(display, widget, x, font, text, hue_fg, sat_fg, val_fg);
+    }
+    return x + painter_text_cache_draw(display, x, widget->y, font, text, hue_fg, sat_fg, val_fg, widget->bg_hue,
+                                       widget->bg_sat, widget->bg_val);
+}
+
+/**
+ * @brief Mixes a value into a widget key (FNV-1a)
+ *
+ * @param key key so far, start with 0
+ * @param value value to add
+ * @return uint32_t new key
+ */
+uint32_t painter_widget_key_mix(uint32_t key, uint32_t value) {
+    for (uint8_t i = 0; i < 4; i++) {
+        key = (key ^ (value & 0xFF)) * 16777619UL;
+        value >>= 8;
+    }
+    return key;
+}
+
+/**
+ * @brief Mixes a string into a widget key, for widgets that show text that changes from elsewhere
+ *
+ * @param key key so far, start with 0
+ * @param str string to add
+ * @return uint32_t new key
+ */
+uint32_t painter_widget_key_str(uint32_t key, const char *str) {
+    for (; *str; str++) {
+        key = (key ^ (uint8_t)*str) * 16777619UL;
+    }
+    return key;
+}
@@ -0,0 +1,62 @@
+// Copyright 2024 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "qp.h"
+
+typedef struct painter_widget_t painter_widget_t;
+
+/**
+ * @brief Returns a compact key of everything that the widget displays. The widget is only redrawn when this changes.
+ *
+ */
+typedef uint32_t (*painter_widget_key_t)(const painter_widget_t *widget);
+
+/**
+ * @brief Draws the widget, starting at its x position, and returns the x position of the right edge of what was
+ * drawn. Anything that the last draw left past that edge is cleared by the framework.
+ *
+ */
+typedef uint16_t (*painter_widget_draw_t)(painter_device_t display, const painter_widget_t *widget);
+
+/**
+ * @brief A retained widget: the rectangle that it owns, and the callbacks to key and draw it.
+ *
+ */
+struct painter_widget_t {
+    uint16_t              x;
+    uint16_t              y;
+    uint16_t              width;
+    uint16_t              height;
+    painter_widget_key_t  key;
+    painter_widget_draw_t draw;
+    uint8_t               arg;
+    uint8_t               bg_hue;
+    uint8_t               bg_sat;
+    uint8_t               bg_val;
+};
+
+/**
+ * @brief What was last drawn for a widget
+ *
+ */
+typedef struct {
+    uint32_t key;
+    uint16_t right;
+    bool     valid;
+} painter_widget_state_t;
+
+bool     painter_widgets_render(painter_device_t display, const painter_widget_t *widgets,
+                                painter_widget_state_t *states, uint8_t count);
+void     painter_widgets_invalidate(painter_widget_state_t *states, uint8_t count);
+uint16_t painter_widget_drawtext(painter_device_t display, const painter_widget_t *widget, uint16_t x,
+                                 painter_font_handle_t font, const char *text, uint8_t hue_fg, uint8_t sat_fg,
+                                 uint8_t val_fg);
+uint16_t painter_widget_drawlabel(painter_device_t display, const painter_widget_t *widget, uint16_t x,
+                                  painter_font_handle_t font, const char *text, uint8_t hue_fg, uint8_t sat_fg,
+                                  uint8_t val_fg);
+uint32_t painter_widget_key_mix(uint32_t key, uint32_t value);
+uint32_t painter_widget_key_str(uint32_t key, const char *str);
@@ -6,14 +6,35 @@ ifeq ($(strip $(CUSTOM_QUANTUM_PAINTER_ENABLE)), yes)
         DISPLAY_DRIVER_REQUIRED  = yes
         OPT_DEFS += -DCUSTOM_QUANTUM_PAINTER_ENABLE -DQUANTUM_PAINTER_NUM_IMAGES=32
 
-        ifeq ($(strip $(QUANTUM_PAINTER_DRIVERS)),ili9341_spi)
+        ifneq ($(filter ili9341_spi,$(QUANTUM_PAINTER_DRIVERS)),)
             OPT_DEFS += -DCUSTOM_QUANTUM_PAINTER_ILI9341
             SRC += $(USER_PATH)/display/painter/ili9341_display.c
         endif
+        ifeq ($(strip $(PAINTER_WIDGETS_SURFACE_ENABLE)), yes)
+            PAINTER_SURFACE_REQUIRED = yes
+            OPT_DEFS += -DPAINTER_WIDGETS_SURFACE_ENABLE
+        endif
+        ifeq ($(strip $(PAINTER_TEXT_CACHE_ENABLE)), yes)
+            PAINTER_SURFACE_REQUIRED = yes
+            OPT_DEFS += -DPAINTER_TEXT_CACHE_ENABLE
+        endif
+        ifeq ($(strip $(PAINTER_PALETTE_ENABLE)), yes)
+            PAINTER_SURFACE_REQUIRED = yes
+            OPT_DEFS += -DPAINTER_PALETTE_ENABLE
+        endif
+        ifeq ($(strip $(PAINTER_SURFACE_REQUIRED)), yes)
+            ifeq ($(filter rgb565_surface,$(QUANTUM_PAINTER_DRIVERS)),)
+                QUANTUM_PAINTER_DRIVERS += rgb565_surface
+            endif
+        endif
 
         SRC += $(USER_PATH)/display/painter/painter.c \
+               $(USER_PATH)/display/painter/painter_widgets.c \
+               $(USER_PATH)/display/painter/painter_text_cache.c \
+               $(USER_PATH)/display/painter/painter_palette.c \
                $(USER_PATH)/display/painter/graphics.qgf.c \
                $(USER_PATH)/display/painter/menu.c
+        POST_CONFIG_H += $(USER_PATH)/display/painter/config.h
     endif
 endif
 
@@ -32,12 +53,20 @@ ifeq ($(strip $(OLED_ENABLE)), yes)
         DISPLAY_DRIVER_REQUIRED  = yes
         OPT_DEFS += -DCUSTOM_OLED_DRIVER
         SRC += $(USER_PATH)/display/oled/oled_stuff.c \
-               $(USER_PATH)/display/oled/screensaver.c
+               $(USER_PATH)/display/oled/screensaver.c \
+               $(USER_PATH)/display/oled/oled_profiler.c
         POST_CONFIG_H += $(USER_PATH)/display/oled/config.h
+        ifeq ($(strip $(OLED_CAPTURE_ENABLE)), yes)
+            OPT_DEFS += -DOLED_CAPTURE_ENABLE
+            SRC += $(USER_PATH)/display/oled/oled_capture.c
+        endif
     endif
     ifeq ($(strip $(OLED_DISPLAY_TEST)), yes)
         OPT_DEFS += -DOLED_DISPLAY_TEST
     endif
+    ifeq ($(strip $(OLED_PROFILER_ENABLE)), yes)
+        OPT_DEFS += -DOLED_PROFILER_ENABLE
+    endif
 endif
 
 ifeq ($(strip $(DISPLAY_DRIVER_REQUIRED)), yes)
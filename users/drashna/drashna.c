@@ -5,6 +5,9 @@
 #include <string.h>
 #include <stdio.h>
 #include <ctype.h>
+#ifdef __arm__
+#    include <hal.h>
+#endif
 
 userspace_config_t userspace_config;
 static bool        device_suspended = false;
@@ -477,6 +480,39 @@ uint32_t get_matrix_scan_rate(void) {
     return last_matrix_scan_count;
 }
 
+/**
+ * @brief Get a timestamp for measuring short durations
+ *
+ * Uses the cycle counter where available, then the ChibiOS system timer, falling back to the millisecond timer.
+ *
+ * @return uint32_t timestamp, in platform specific ticks
+ */
+uint32_t timer_read_precise(void) {
+#if defined(__arm__) && defined(STM32_SYSCLK) && (PORT_SUPPORTS_RT == TRUE)
+    return chSysGetRealtimeCounterX();
+#elif defined(__arm__)
+    return chVTGetSystemTimeX();
+#else
+    return timer_read32();
+#endif
+}
+
+/**
+ * @brief Get the time elapsed since a timestamp
+ *
+ * @param start value from timer_read_precise
+ * @return uint32_t elapsed time in microseconds
+ */
+uint32_t timer_elapsed_precise_us(uint32_t start) {
+#if defined(__arm__) && defined(STM32_SYSCLK) && (PORT_SUPPORTS_RT == TRUE)
+    return (uint32_t)(chSysGetRealtimeCounterX() - start) / (STM32_SYSCLK / 1000000UL);
+#elif defined(__arm__)
+    return TIME_I2US(chVTTimeElapsedSinceX(start));
+#else
+    return timer_elapsed32(start) * 1000UL;
+#endif
+}
+
 /**
  * @brief Task to monitor and print the matrix scan rate
  */
@@ -139,3 +139,5 @@ uint16_t extract_basic_keycode(uint16_t keycode, keyrecord_t *record, bool check
 
 void     matrix_scan_rate_task(void);
 uint32_t get_matrix_scan_rate(void);
+uint32_t timer_read_precise(void);
+uint32_t timer_elapsed_precise_us(uint32_t start);
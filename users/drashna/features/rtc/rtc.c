@@ -7,11 +7,9 @@
 #include <stdlib.h>
 #include "print.h"
 #include "timer.h"
+#include "sync_timer.h"
 #include "progmem.h"
 
-#include <stdio.h>
-#include <string.h>
-
 #ifdef DS3231_RTC_DRIVER_ENABLE
 #    include "ds3231.h"
 #endif
@@ -25,25 +23,23 @@
 #    include "vendor.h"
 #endif
 
-#define strncpy_nowarn(...)                                          \
-    __extension__({                                                  \
-        _Pragma("GCC diagnostic push");                              \
-        _Pragma("GCC diagnostic ignored \"-Wstringop-truncation\""); \
-        const char *_strncpy_nowarn = strncpy(__VA_ARGS__);          \
-        _Pragma("GCC diagnostic pop");                               \
-        _strncpy_nowarn;                                             \
-    })
-
 #ifndef RTC_READ_INTERVAL
 #    define RTC_READ_INTERVAL 250
 #endif
+#ifndef RTC_SPLIT_ANCHOR_INTERVAL
+#    define RTC_SPLIT_ANCHOR_INTERVAL 60000
+#endif
 
-static rtc_time_t rtc_time;
-static uint16_t   last_rtc_read   = 0;
-static bool       rtc_initialized = false, rtc_connected = false;
+static rtc_time_t         rtc_time;
+static uint16_t           last_rtc_read   = 0;
+static bool               rtc_initialized = false, rtc_connected = false;
+static rtc_split_anchor_t rtc_split_anchor;
+static bool               rtc_split_anchor_valid = false;
 
 const uint8_t days_in_month[12] PROGMEM = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
 
+static uint16_t date_to_days(uint16_t y, uint8_t m, uint8_t d);
+
 /**
  * @brief Get the unixtime object
  *
@@ -76,6 +72,48 @@ uint32_t convert_to_unixtime(rtc_time_t time) {
     return unixtime;
 }
 
+/**
+ * @brief Convert a unixtime back to a time struct, the inverse of convert_to_unixtime
+ *
+ * @param unixtime
+ * @return rtc_time_t 24 hour format
+ */
+rtc_time_t convert_from_unixtime(uint32_t unixtime) {
+    rtc_time_t time    = {0};
+    uint32_t   seconds = 0;
+
+    if (unixtime > (SECONDS_FROM_1970_TO_2000 + (TIME_OFFSET * 3000))) {
+        seconds = unixtime - SECONDS_FROM_1970_TO_2000 - (TIME_OFFSET * 3000);
+    }
+
+    time.second = seconds % 60;
+    seconds /= 60;
+    time.minute = seconds % 60;
+    seconds /= 60;
+    time.hour = seconds % 24;
+
+    uint16_t days  = seconds / 24;
+    uint16_t years = 0;
+    while (days >= (365U + (years % 4 == 0))) {
+        days -= 365U + (years % 4 == 0);
+        years++;
+    }
+    uint8_t month = 1;
+    while (month < 12 && days >= (pgm_read_byte(days_in_month + month - 1) + (month == 2 && years % 4 == 0))) {
+        days -= pgm_read_byte(days_in_month + month - 1) + (month == 2 && years % 4 == 0);
+        month++;
+    }
+
+    time.year            = years + 2000U;
+    time.month           = month;
+    time.date            = days + 1;
+    time.day_of_the_week = (rtc_time_day_of_the_week_t)((date_to_days(time.year, time.month, time.date) + 6) % 7);
+    time.format          = RTC_FORMAT_24H;
+    time.am_pm           = (rtc_time_am_pm_t)(time.hour >= 12);
+    time.unixtime        = unixtime;
+    return time;
+}
+
 /**
  * @brief convert a date to days
  *
@@ -211,12 +249,106 @@ void rtc_init(void) {
 #endif
 }
 
+/**
+ * @brief Checks if the time comes from an RTC on this half, rather than from the other half
+ *
+ * @return true
+ * @return false
+ */
+bool rtc_is_local(void) {
+    return rtc_initialized;
+}
+
+/**
+ * @brief Get the time anchor to send to the other half
+ *
+ * @return rtc_split_anchor_t
+ */
+rtc_split_anchor_t rtc_get_split_anchor(void) {
+    return rtc_split_anchor;
+}
+
+/**
+ * @brief Set the time anchor received from the other half, ignored if this half has its own RTC
+ *
+ * @param anchor
+ */
+void rtc_set_split_anchor(rtc_split_anchor_t anchor) {
+    if (rtc_initialized) {
+        return;
+    }
+    rtc_split_anchor       = anchor;
+    rtc_split_anchor_valid = true;
+}
+
+/**
+ * @brief Re-anchors the time sent to the other half, when needed
+ *
+ * Only anchor on a read where the second has just ticked over, so the anchor is accurate to within a read interval.
+ * The anchor is refreshed every RTC_SPLIT_ANCHOR_INTERVAL to correct for drift between the timer and the RTC, or
+ * straight away if the time has jumped (such as being set).
+ *
+ * @param connected RTC state from the last read
+ * @param second_ticked unixtime changed since the last read
+ */
+static void rtc_update_split_anchor(bool connected, bool second_ticked) {
+    uint32_t now = sync_timer_read32();
+
+    if (connected != rtc_split_anchor.is_connected) {
+        rtc_split_anchor.is_connected = connected;
+        rtc_split_anchor_valid        = false;
+    }
+    if (!connected || !second_ticked) {
+        return;
+    }
+
+    int32_t drift = (int32_t)(rtc_split_anchor.unixtime + (now - rtc_split_anchor.timer) / 1000) -
+                    (int32_t)rtc_time.unixtime;
+    if (!rtc_split_anchor_valid || drift > 1 || drift < -1 ||
+        (now - rtc_split_anchor.timer) >= RTC_SPLIT_ANCHOR_INTERVAL) {
+        rtc_split_anchor.unixtime = rtc_time.unixtime;
+        rtc_split_anchor.timer    = now;
+        rtc_split_anchor.is_dst   = rtc_time.is_dst;
+        rtc_split_anchor.format   = rtc_time.format;
+        rtc_split_anchor_valid    = true;
+    }
+}
+
+/**
+ * @brief Interpolates the time from the anchor sent by the other half
+ *
+ */
+static void rtc_split_task(void) {
+    if (!rtc_split_anchor_valid) {
+        return;
+    }
+    rtc_connected = rtc_split_anchor.is_connected;
+    if (!rtc_connected) {
+        return;
+    }
+
+    uint32_t unixtime = rtc_split_anchor.unixtime + (sync_timer_read32() - rtc_split_anchor.timer) / 1000;
+    // only convert once a second, and never step backwards when a new anchor corrects for drift
+    if (unixtime <= rtc_time.unixtime && (rtc_time.unixtime - unixtime) < 2) {
+        return;
+    }
+
+    rtc_time        = convert_from_unixtime(unixtime);
+    rtc_time.is_dst = rtc_split_anchor.is_dst;
+    if (rtc_split_anchor.format == RTC_FORMAT_12H) {
+        rtc_time.format = RTC_FORMAT_12H;
+        rtc_time.hour   = rtc_time.hour % 12 ? rtc_time.hour % 12 : 12;
+    }
+}
+
 void rtc_task(void) {
     if (!rtc_initialized) {
+        rtc_split_task();
         return;
     }
     if (timer_expired(timer_read(), last_rtc_read)) {
-        bool connected = false;
+        bool     connected     = false;
+        uint32_t last_unixtime = rtc_time.unixtime;
 #ifdef DS3231_RTC_DRIVER_ENABLE
         connected = ds3231_task(&rtc_time);
 #endif
@@ -235,21 +367,101 @@ void rtc_task(void) {
             last_rtc_read = timer_read() + (RTC_READ_INTERVAL * 100);
         }
         rtc_connected = connected;
+        rtc_update_split_anchor(connected, rtc_time.unixtime != last_unixtime);
     }
 }
 
-// not sure if neede. Let people do it?
+/**
+ * @brief Formatted strings for the current date and time
+ *
+ * The strings are only formatted once, and after that, only the two digit fields that have changed since they were
+ * last read are rewritten, so reading them every frame costs a few compares, rather than a printf.
+ */
+static struct {
+    char    date_str[11];      /**< MM/DD/YYYY */
+    char    time_str[9];       /**< HH:MM:SS */
+    char    date_time_str[20]; /**< MM/DD/YYYY HH:MM:SS */
+    char    iso8601_str[20];   /**< YYYY-MM-DDTHH:MM:SS */
+    uint8_t month, date, century, year, hour, minute, second;
+} rtc_str = {
+    .date_str      = "00/00/0000",
+    .time_str      = "00:00:00",
+    .date_time_str = "00/00/0000 00:00:00",
+    .iso8601_str   = "0000-00-00T00:00:00",
+    .month         = 0xFF,
+    .date          = 0xFF,
+    .century       = 0xFF,
+    .year          = 0xFF,
+    .hour          = 0xFF,
+    .minute        = 0xFF,
+    .second        = 0xFF,
+};
+
+static void rtc_str_write_digits(char *str, uint8_t value) {
+    value %= 100;
+    str[0] = '0' + (value / 10);
+    str[1] = '0' + (value % 10);
+}
+
+/**
+ * @brief Updates a date field in the strings, if it has changed
+ *
+ * @param cached value the strings were last formatted with
+ * @param value current value
+ * @param offset offset of the field in the date and date_time strings
+ * @param iso_offset offset of the field in the ISO 8601 string
+ */
+static void rtc_str_update_date_field(uint8_t *cached, uint8_t value, uint8_t offset, uint8_t iso_offset) {
+    if (*cached == value) {
+        return;
+    }
+    *cached = value;
+    rtc_str_write_digits(&rtc_str.date_str[offset], value);
+    rtc_str_write_digits(&rtc_str.date_time_str[offset], value);
+    rtc_str_write_digits(&rtc_str.iso8601_str[iso_offset], value);
+}
+
+/**
+ * @brief Updates a time field in the strings, if it has changed
+ *
+ * The time is at the same offset after the date in both the date_time and ISO 8601 strings.
+ *
+ * @param cached value the strings were last formatted with
+ * @param value current value
+ * @param offset offset of the field in the time string
+ */
+static void rtc_str_update_time_field(uint8_t *cached, uint8_t value, uint8_t offset) {
+    if (*cached == value) {
+        return;
+    }
+    *cached = value;
+    rtc_str_write_digits(&rtc_str.time_str[offset], value);
+    rtc_str_write_digits(&rtc_str.date_time_str[11 + offset], value);
+    rtc_str_write_digits(&rtc_str.iso8601_str[11 + offset], value);
+}
+
+/**
+ * @brief Brings the formatted strings up to date with the current time
+ *
+ */
+static void rtc_str_update(void) {
+    rtc_str_update_time_field(&rtc_str.second, rtc_time.second, 6);
+    rtc_str_update_time_field(&rtc_str.minute, rtc_time.minute, 3);
+    rtc_str_update_time_field(&rtc_str.hour, rtc_time.hour, 0);
+    rtc_str_update_date_field(&rtc_str.date, rtc_time.date, 3, 8);
+    rtc_str_update_date_field(&rtc_str.month, rtc_time.month, 0, 5);
+    rtc_str_update_date_field(&rtc_str.year, rtc_time.year % 100, 8, 2);
+    rtc_str_update_date_field(&rtc_str.century, (rtc_time.year / 100) % 100, 6, 0);
+}
+
 /**
  * @brief Generates a string with the date
  *
  * @return char*
  */
 char *rtc_read_date_str(void) {
-    char date_str_temp[14] = {0};
-    snprintf(date_str_temp, sizeof(date_str_temp), "%02d/%02d/%04d", rtc_time.month, rtc_time.date, rtc_time.year);
-    static char date_str[12] = {0};
-    strncpy_nowarn(date_str, date_str_temp, sizeof(date_str));
-    return date_str;
+    rtc_str_update();
+    return rtc_str.date_str;
 }
 
 /**
@@ -258,11 +470,8 @@ char *rtc_read_date_str(void) {
  * @return char*
  */
 char *rtc_read_time_str(void) {
-    char time_str_temp[12];
-    snprintf(time_str_temp, sizeof(time_str_temp), "%02d:%02d:%02d", rtc_time.hour, rtc_time.minute, rtc_time.second);
-    static char time_str[9] = {0};
-    strncpy_nowarn(time_str, time_str_temp, sizeof(time_str));
-    return time_str;
+    rtc_str_update();
+    return rtc_str.time_str;
 }
 
 /**
@@ -271,9 +480,8 @@ char *rtc_read_time_str(void) {
  * @return char*
  */
 char *rtc_read_date_time_str(void) {
-    static char date_time_str[21] = {0};
-    snprintf(date_time_str, sizeof(date_time_str), "%s %s", rtc_read_date_str(), rtc_read_time_str());
-    return date_time_str;
+    rtc_str_update();
+    return rtc_str.date_time_str;
 }
 
 /**
@@ -282,10 +490,8 @@ char *rtc_read_date_time_str(void) {
  * @return char*
  */
 char *rtc_read_date_time_iso8601_str(void) {
-    static char date_time_str[26] = {0};
-    snprintf(date_time_str, sizeof(date_time_str), "%04d-%02d-%02dT%02d:%02d:%02d", rtc_time.year, rtc_time.month,
-             rtc_time.date, rtc_time.hour, rtc_time.minute, rtc_time.second);
-    return date_time_str;
+    rtc_str_update();
+    return rtc_str.iso8601_str;
 }
 
 /**
@@ -41,6 +41,18 @@ typedef struct {
     uint32_t                   unixtime;        /**< Unix Time */
 } rtc_time_t;
 
+/**
+ * @brief Time anchor for distributing the time to the other half of a split keyboard
+ *
+ */
+typedef struct __attribute__((packed)) {
+    uint32_t unixtime;         /**< time at the anchor */
+    uint32_t timer;            /**< sync_timer_read32() at the anchor */
+    bool     is_connected : 1; /**< master's RTC is connected */
+    bool     is_dst       : 1; /**< daylight saving time */
+    uint8_t  format       : 1; /**< data format */
+} rtc_split_anchor_t;
+
 #define SECONDS_FROM_1970_TO_2000 946684800
 #define TIME_OFFSET               6
 
@@ -48,6 +60,7 @@ void rtc_init(void);
 void rtc_task(void);
 
 uint32_t   convert_to_unixtime(rtc_time_t time);
+rtc_time_t convert_from_unixtime(uint32_t unixtime);
 rtc_time_t convert_date_time(const char *date, const char *time);
 uint8_t    rtc_bcd2bin(uint8_t val);
 uint8_t    rtc_bin2bcd(uint8_t val);
@@ -61,4 +74,8 @@ char      *rtc_read_date_time_iso8601_str(void);
 
 bool     rtc_is_connected(void);
 void     rtc_set_time_split(rtc_time_t time, bool is_connected);
+bool     rtc_is_local(void);
+
+rtc_split_anchor_t rtc_get_split_anchor(void);
+void               rtc_set_split_anchor(rtc_split_anchor_t anchor);
 uint32_t get_fattime(void);
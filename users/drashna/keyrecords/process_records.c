@@ -16,6 +16,9 @@
 #ifdef DISPLAY_DRIVER_ENABLE
 #    include "display/display.h"
 #endif
+#ifdef CUSTOM_SPLIT_TRANSPORT_SYNC
+#    include "split/transport_stats.h"
+#endif
 
 uint16_t copy_paste_timer;
 // Defines actions tor my global custom keycodes. Defined in drashna.h file
@@ -236,6 +239,17 @@ bool process_record_user(uint16_t keycode, keyrecord_t *record) {
                 eeconfig_update_user_config(&userspace_config.raw);
             }
             break;
+#ifdef CUSTOM_SPLIT_TRANSPORT_SYNC
+        case US_TRANSPORT_STATS_PRINT:
+            if (record->event.pressed) {
+                transport_stats_print();
+                transport_sync_print_telemetry();
+                if (get_mods() & MOD_MASK_SHIFT) {
+                    transport_stats_reset();
+                }
+            }
+            return false;
+#endif // CUSTOM_SPLIT_TRANSPORT_SYNC
     }
     return true;
 }
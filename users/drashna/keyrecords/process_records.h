@@ -99,6 +99,11 @@ enum userspace_custom_keycodes {
 
     DISPLAY_MENU,
 
+    US_TRANSPORT_STATS_PRINT,
+
+    OLED_CAPTURE,
+    OLED_PROFILER,
+
     USER_SAFE_RANGE,
 };
 
@@ -187,6 +192,8 @@ We use custom codes here, so we can substitute the right stuff
 #define OL_BDEC OLED_BRIGHTNESS_DEC
 #define OL_CW   OLED_ROTATE_CW
 #define OL_CCW  OLED_ROTATE_CCW
+#define OL_CAPT OLED_CAPTURE
+#define OL_PROF OLED_PROFILER
 
 #define US_MSRP US_MATRIX_SCAN_RATE_PRINT
 #define US_SELW US_SELECT_WORD
@@ -1,7 +1,10 @@
 CUSTOM_SPLIT_TRANSPORT_SYNC ?= yes
 ifeq ($(strip $(CUSTOM_SPLIT_TRANSPORT_SYNC)), yes)
     ifeq ($(strip $(SPLIT_KEYBOARD)), yes)
-        QUANTUM_LIB_SRC += $(USER_PATH)/split/transport_sync.c
+        QUANTUM_LIB_SRC += $(USER_PATH)/split/transport_sync.c \
+                           $(USER_PATH)/split/transport_blob.c \
+                           $(USER_PATH)/split/transport_stats.c \
+                           $(USER_PATH)/split/transport_encoding.c
         OPT_DEFS += -DCUSTOM_SPLIT_TRANSPORT_SYNC
         CONFIG_H += $(USER_PATH)/split/config.h
     endif
@@ -0,0 +1,153 @@
+// Copyright 2024 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @brief Stubs for one half of the split keyboard, linked with the real transport sync code.
+ *
+ * This is built into a shared object, and loaded once per half, so everything here (and in the transport code) is
+ * per half. The clock and the link come from the simulator.
+ */
+
+#include "sim_host.h"
+#include "drashna.h"
+#include "transactions.h"
+#include "transport_sync.h"
+#include "transport_stats.h"
+#include <string.h>
+
+static const sim_host_t          *sim_host                             = NULL;
+static bool                        sim_is_master                        = false;
+static bool                        device_suspended                     = false;
+static slave_transaction_handler_t rpc_handlers[NUM_TOTAL_TRANSACTIONS] = {0};
+
+keymap_config_t       keymap_config    = {0};
+userspace_config_t    userspace_config = {0};
+user_runtime_config_t user_state       = {0};
+
+char autocorrected_str[2][21]     = {0};
+char autocorrected_str_raw[2][21] = {0};
+bool autocorrect_str_has_changed  = false;
+
+uint16_t timer_read(void) {
+    return (uint16_t)(sim_host->clock_us() / 1000);
+}
+
+uint32_t timer_read32(void) {
+    return (uint32_t)(sim_host->clock_us() / 1000);
+}
+
+uint16_t timer_elapsed(uint16_t last) {
+    return (uint16_t)(timer_read() - last);
+}
+
+uint32_t timer_elapsed32(uint32_t last) {
+    return timer_read32() - last;
+}
+
+// both halves share the one clock, so the synced timer is just the timer
+uint32_t sync_timer_read32(void) {
+    return timer_read32();
+}
+
+uint32_t sync_timer_elapsed32(uint32_t last) {
+    return timer_elapsed32(last);
+}
+
+uint32_t timer_read_precise(void) {
+    return (uint32_t)sim_host->clock_us();
+}
+
+uint32_t timer_elapsed_precise_us(uint32_t start) {
+    return timer_read_precise() - start;
+}
+
+bool is_keyboard_master(void) {
+    return sim_is_master;
+}
+
+uint32_t get_matrix_scan_rate(void) {
+    return 0;
+}
+
+void set_keyboard_lock(bool enable) {
+    user_state.host_driver_disabled = enable;
+}
+
+bool is_device_suspended(void) {
+    return device_suspended;
+}
+
+void set_is_device_suspended(bool status) {
+    send_device_suspend_state(status);
+    device_suspended = status;
+}
+
+void center_text(const char *text, char *output, uint8_t width) {
+    size_t length  = strnlen(text, width);
+    size_t padding = (width - length) / 2;
+    memset(output, ' ', width);
+    memcpy(&output[padding], text, length);
+    output[width] = '\0';
+}
+
+void transaction_register_rpc(int8_t transaction_id, slave_transaction_handler_t handler) {
+    if (transaction_id >= 0 && transaction_id < NUM_TOTAL_TRANSACTIONS) {
+        rpc_handlers[transaction_id] = handler;
+    }
+}
+
+bool transaction_rpc_exec(int8_t transaction_id, uint8_t initiator2target_buffer_size,
+                          const void *initiator2target_buffer, uint8_t target2initiator_buffer_size,
+                          void *target2initiator_buffer) {
+    return sim_host->rpc_exec(transaction_id, initiator2target_buffer_size, initiator2target_buffer,
+                              target2initiator_buffer_size, target2initiator_buffer);
+}
+
+static void sim_half_init(const sim_host_t *host, bool is_master) {
+    sim_host      = host;
+    sim_is_master = is_master;
+    keyboard_post_init_transport_sync();
+    if (is_master) {
+        transport_stats_reset();
+    }
+}
+
+/**
+ * @brief Run the slave's handler for an RPC, like the slave's transport does when a transaction arrives
+ *
+ * @return true handler was run
+ * @return false nothing registered for the id
+ */
+static bool sim_half_dispatch(int8_t id, uint8_t initiator2target_buffer_size, const void *initiator2target_buffer,
+                              uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    if (id < 0 || id >= NUM_TOTAL_TRANSACTIONS || !rpc_handlers[id]) {
+        return false;
+    }
+    rpc_handlers[id](initiator2target_buffer_size, initiator2target_buffer, target2initiator_buffer_size,
+                     target2initiator_buffer);
+    return true;
+}
+
+static void sim_half_print_stats(void) {
+    transport_stats_print();
+    transport_sync_print_telemetry();
+}
+
+// clang-format off
+static const sim_half_t sim_half = {
+    .init             = sim_half_init,
+    .dispatch         = sim_half_dispatch,
+    .housekeeping     = housekeeping_task_transport_sync,
+    .is_suspended     = is_device_suspended,
+    .set_suspended    = set_is_device_suspended,
+    .print_stats      = sim_half_print_stats,
+    .user_state       = &user_state.raw,
+    .keymap_config    = &keymap_config.raw,
+    .userspace_config = &userspace_config.raw,
+    .autocorrect      = autocorrected_str_raw,
+};
+// clang-format on
+
+const sim_half_t *sim_half_get(void) {
+    return &sim_half;
+}
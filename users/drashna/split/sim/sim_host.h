@@ -0,0 +1,41 @@
+// Copyright 2024 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @brief Services the simulator provides to each half: the shared clock, and the link to the other half
+ *
+ */
+typedef struct {
+    uint64_t (*clock_us)(void);
+    bool (*rpc_exec)(int8_t id, uint8_t initiator2target_buffer_size, const void *initiator2target_buffer,
+                     uint8_t target2initiator_buffer_size, void *target2initiator_buffer);
+} sim_host_t;
+
+/**
+ * @brief State and entry points of one simulated half
+ *
+ * Each half is a separate copy of the same shared object, so that the master and slave each get their own globals.
+ */
+typedef struct {
+    void (*init)(const sim_host_t *host, bool is_master);
+    bool (*dispatch)(int8_t id, uint8_t initiator2target_buffer_size, const void *initiator2target_buffer,
+                     uint8_t target2initiator_buffer_size, void *target2initiator_buffer);
+    void (*housekeeping)(void);
+    bool (*is_suspended)(void);
+    void (*set_suspended)(bool status);
+    void (*print_stats)(void);
+
+    uint32_t *user_state;
+    uint16_t *keymap_config;
+    uint32_t *userspace_config;
+    char (*autocorrect)[21]; // raw typo and correction strings
+} sim_half_t;
+
+typedef const sim_half_t *(*sim_half_get_t)(void);
+
+#define SIM_HALF_GET_SYMBOL "sim_half_get"
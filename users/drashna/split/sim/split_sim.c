@@ -0,0 +1,492 @@
+// Copyright 2024 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @brief Host simulator for the split transport sync.
+ *
+ * Loads two copies of the transport sync code (one per half), connects them through a loopback link with configurable
+ * latency, bandwidth and drop rate, and replays a trace of state changes on the master. Reports the bytes per second
+ * on the link, the time from each change to it being visible on the slave, and the CPU time of the sync task per
+ * tick, so sync policy changes can be compared without flashing two boards.
+ */
+
+#include "sim_host.h"
+#include <dlfcn.h>
+#include <errno.h>
+#include <libgen.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#ifndef MIN
+#    define MIN(a, b) ((a) < (b) ? (a) : (b))
+#endif
+#ifndef MAX
+#    define MAX(a, b) ((a) > (b) ? (a) : (b))
+#endif
+
+#define SIM_DEFAULT_TICK_US   1000
+#define SIM_DEFAULT_TAIL_MS   2000
+#define SIM_AUTOCORRECT_WIDTH 21
+
+typedef enum {
+    SIM_FIELD_USER_STATE = 0,
+    SIM_FIELD_KEYMAP_CONFIG,
+    SIM_FIELD_USERSPACE_CONFIG,
+    SIM_FIELD_SUSPEND,
+    SIM_FIELD_AUTOCORRECT,
+    SIM_FIELD_COUNT,
+} sim_field_t;
+
+static const char *const sim_field_names[SIM_FIELD_COUNT] = {
+    [SIM_FIELD_USER_STATE]       = "user_state",
+    [SIM_FIELD_KEYMAP_CONFIG]    = "keymap_config",
+    [SIM_FIELD_USERSPACE_CONFIG] = "userspace_config",
+    [SIM_FIELD_SUSPEND]          = "suspend",
+    [SIM_FIELD_AUTOCORRECT]      = "autocorrect",
+};
+
+typedef struct {
+    uint64_t    time_us;
+    sim_field_t field;
+    uint32_t    value;
+    char        strings[2][SIM_AUTOCORRECT_WIDTH]; // autocorrect typo and correction
+    bool        is_pending;                        // waiting to become visible on the slave
+} sim_event_t;
+
+typedef struct {
+    uint32_t updates;
+    uint32_t visible;
+    uint32_t superseded; // replaced by a newer value before the slave had it
+    uint64_t total_us;
+    uint64_t max_us;
+} sim_field_stats_t;
+
+static struct {
+    uint32_t latency_us;
+    uint32_t bandwidth; // bytes per second, 0 for unlimited
+    uint8_t  drop_percent;
+    uint32_t tick_us;
+    uint32_t seed;
+} sim_link = {
+    .tick_us = SIM_DEFAULT_TICK_US,
+    .seed    = 1,
+};
+
+static uint64_t          sim_clock          = 0;
+static uint64_t          sim_wire_bytes     = 0;
+static uint32_t          sim_transactions   = 0;
+static uint32_t          sim_dropped_req    = 0;
+static uint32_t          sim_dropped_ack    = 0;
+static uint64_t          sim_slave_cpu_ns   = 0;
+static const sim_half_t *sim_master         = NULL;
+static const sim_half_t *sim_slave          = NULL;
+static sim_event_t      *sim_events         = NULL;
+static size_t            sim_event_count    = 0;
+static sim_field_stats_t sim_field_stats[SIM_FIELD_COUNT];
+
+static uint64_t sim_clock_us(void) {
+    return sim_clock;
+}
+
+static uint32_t sim_random(void) {
+    // xorshift32, so runs are repeatable for a given seed
+    sim_link.seed ^= sim_link.seed << 13;
+    sim_link.seed ^= sim_link.seed >> 17;
+    sim_link.seed ^= sim_link.seed << 5;
+    return sim_link.seed;
+}
+
+static uint64_t sim_cpu_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief Loopback link from the master to the slave
+ *
+ * The master is blocked for the latency plus the transfer time of the bytes that actually went over the wire. Either
+ * the request (the slave never sees it) or the ack (the slave has applied it) is dropped, evenly.
+ */
+static bool sim_rpc_exec(int8_t id, uint8_t initiator2target_buffer_size, const void *initiator2target_buffer,
+                         uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    bool     drop         = (sim_random() % 100) < sim_link.drop_percent;
+    bool     drop_request = drop && (sim_random() & 1);
+    uint32_t bytes        = initiator2target_buffer_size + (drop_request ? 0 : target2initiator_buffer_size);
+
+    sim_transactions++;
+    sim_wire_bytes += bytes;
+    sim_clock += sim_link.latency_us;
+    if (sim_link.bandwidth) {
+        sim_clock += (uint64_t)bytes * 1000000ULL / sim_link.bandwidth;
+    }
+
+    if (drop_request) {
+        sim_dropped_req++;
+        return false;
+    }
+    // the slave's handler runs on the other MCU, so it doesn't count towards the master's sync time
+    uint64_t start   = sim_cpu_ns();
+    bool     handled = sim_slave->dispatch(id, initiator2target_buffer_size, initiator2target_buffer,
+                                           target2initiator_buffer_size, target2initiator_buffer);
+    sim_slave_cpu_ns += sim_cpu_ns() - start;
+    if (!handled) {
+        return false;
+    }
+    if (drop) {
+        sim_dropped_ack++;
+        return false;
+    }
+    return true;
+}
+
+static const sim_host_t sim_host = {
+    .clock_us = sim_clock_us,
+    .rpc_exec = sim_rpc_exec,
+};
+
+/**
+ * @brief Load one copy of the half shared object, so that it gets its own globals
+ *
+ * @param dir directory the simulator binary is in
+ * @param name file name of the shared object
+ * @return const sim_half_t* NULL on failure
+ */
+static const sim_half_t *sim_load_half(const char *dir, const char *name) {
+    char path[PATH_MAX];
+    snprintf(path, sizeof(path), "%s/%s", dir, name);
+
+    void *handle = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+    if (!handle) {
+        fprintf(stderr, "Failed to load %s: %s\n", path, dlerror());
+        return NULL;
+    }
+    sim_half_get_t get = (sim_half_get_t)dlsym(handle, SIM_HALF_GET_SYMBOL);
+    if (!get) {
+        fprintf(stderr, "Failed to find %s in %s: %s\n", SIM_HALF_GET_SYMBOL, path, dlerror());
+        return NULL;
+    }
+    return get();
+}
+
+/**
+ * @brief Parse a trace of state changes on the master
+ *
+ * One change per line, as "<time_ms> <field> <value>", where field is one of user_state, keymap_config,
+ * userspace_config or suspend (with a numeric value), or "<time_ms> autocorrect <typo> <correction>". Blank lines and
+ * lines starting with # are ignored. Times must not go backwards.
+ *
+ * @param file trace to read
+ * @return true trace was read
+ * @return false trace is malformed
+ */
+static bool sim_read_trace(FILE *file) {
+    char     line[256];
+    size_t   capacity = 0;
+    uint32_t line_no  = 0;
+
+    while (fgets(line, sizeof(line), file)) {
+        char          field[32], arg1[64], arg2[64];
+        unsigned long time_ms;
+        int           args;
+
+        line_no++;
+        args = sscanf(line, " %lu %31s %63s %63s", &time_ms, field, arg1, arg2);
+        if (line[strspn(line, " \t\r\n")] == '\0' || line[strspn(line, " \t")] == '#') {
+            continue;
+        }
+        if (args < 3) {
+            fprintf(stderr, "Trace line %u: expected \"<time_ms> <field> <value>\"\n", line_no);
+            return false;
+        }
+
+        sim_event_t event = {.time_us = (uint64_t)time_ms * 1000, .field = SIM_FIELD_COUNT};
+        for (sim_field_t i = 0; i < SIM_FIELD_COUNT; i++) {
+            if (!strcmp(field, sim_field_names[i])) {
+                event.field = i;
+            }
+        }
+        if (event.field == SIM_FIELD_COUNT) {
+            fprintf(stderr, "Trace line %u: unknown field \"%s\"\n", line_no, field);
+            return false;
+        }
+        if (sim_event_count && event.time_us < sim_events[sim_event_count - 1].time_us) {
+            fprintf(stderr, "Trace line %u: time goes backwards\n", line_no);
+            return false;
+        }
+        if (event.field == SIM_FIELD_AUTOCORRECT) {
+            if (args < 4 || strlen(arg1) >= SIM_AUTOCORRECT_WIDTH || strlen(arg2) >= SIM_AUTOCORRECT_WIDTH) {
+                fprintf(stderr, "Trace line %u: expected a typo and correction, up to %u characters each\n",
+                        line_no, SIM_AUTOCORRECT_WIDTH - 1);
+                return false;
+            }
+            strcpy(event.strings[0], arg1);
+            strcpy(event.strings[1], arg2);
+        } else {
+            char *end;
+            errno       = 0;
+            event.value = (uint32_t)strtoul(arg1, &end, 0);
+            if (errno || *end) {
+                fprintf(stderr, "Trace line %u: bad value \"%s\"\n", line_no, arg1);
+                return false;
+            }
+        }
+
+        if (sim_event_count == capacity) {
+            capacity   = capacity ? capacity * 2 : 64;
+            sim_events = realloc(sim_events, capacity * sizeof(*sim_events));
+            if (!sim_events) {
+                fprintf(stderr, "Out of memory\n");
+                return false;
+            }
+        }
+        sim_events[sim_event_count++] = event;
+    }
+    return true;
+}
+
+/**
+ * @brief Check if a half holds the value from a trace event
+ *
+ */
+static bool sim_half_has_value(const sim_half_t *half, const sim_event_t *event) {
+    switch (event->field) {
+        case SIM_FIELD_USER_STATE:
+            return *half->user_state == event->value;
+        case SIM_FIELD_KEYMAP_CONFIG:
+            return *half->keymap_config == (uint16_t)event->value;
+        case SIM_FIELD_USERSPACE_CONFIG:
+            return *half->userspace_config == event->value;
+        case SIM_FIELD_SUSPEND:
+            return half->is_suspended() == !!event->value;
+        case SIM_FIELD_AUTOCORRECT:
+            return !strcmp(half->autocorrect[0], event->strings[0]) &&
+                   !strcmp(half->autocorrect[1], event->strings[1]);
+        default:
+            return false;
+    }
+}
+
+/**
+ * @brief Apply a trace event to the master, and start timing it
+ *
+ * Events that don't change anything are ignored. An older change to the same field that hasn't reached the slave yet
+ * is counted as superseded, since the slave will never see that value.
+ */
+static void sim_apply_event(sim_event_t *event) {
+    if (sim_half_has_value(sim_master, event)) {
+        return;
+    }
+    for (sim_event_t *older = sim_events; older < event; older++) {
+        if (older->is_pending && older->field == event->field) {
+            older->is_pending = false;
+            sim_field_stats[older->field].superseded++;
+        }
+    }
+
+    switch (event->field) {
+        case SIM_FIELD_USER_STATE:
+            *sim_master->user_state = event->value;
+            break;
+        case SIM_FIELD_KEYMAP_CONFIG:
+            *sim_master->keymap_config = (uint16_t)event->value;
+            break;
+        case SIM_FIELD_USERSPACE_CONFIG:
+            *sim_master->userspace_config = event->value;
+            break;
+        case SIM_FIELD_SUSPEND:
+            sim_master->set_suspended(!!event->value);
+            break;
+        case SIM_FIELD_AUTOCORRECT:
+            memcpy(sim_master->autocorrect, event->strings, sizeof(event->strings));
+            break;
+        default:
+            break;
+    }
+    event->is_pending = true;
+    sim_field_stats[event->field].updates++;
+}
+
+/**
+ * @brief Record the pending events that the slave now has
+ *
+ * @param now_us time the slave's housekeeping pass finished
+ */
+static void sim_check_visible(uint64_t now_us) {
+    for (size_t i = 0; i < sim_event_count; i++) {
+        sim_event_t *event = &sim_events[i];
+        if (event->is_pending && sim_half_has_value(sim_slave, event)) {
+            sim_field_stats_t *stats   = &sim_field_stats[event->field];
+            uint64_t           latency = now_us - event->time_us;
+            event->is_pending          = false;
+            stats->visible++;
+            stats->total_us += latency;
+            if (latency > stats->max_us) {
+                stats->max_us = latency;
+            }
+        }
+    }
+}
+
+static void sim_print_field_stats(const char *name, const sim_field_stats_t *stats) {
+    printf("  %-16s updates %u, visible %u, superseded %u, avg %lluus, max %lluus\n", name, stats->updates,
+           stats->visible, stats->superseded,
+           (unsigned long long)(stats->visible ? stats->total_us / stats->visible : 0),
+           (unsigned long long)stats->max_us);
+}
+
+static void sim_usage(const char *name) {
+    fprintf(stderr,
+            "Usage: %s [options] <trace file, or - for stdin>\n"
+            "  -l <us>    added latency per transaction (default 0)\n"
+            "  -b <B/s>   link bandwidth, 0 for unlimited (default 0)\n"
+            "  -d <%%>     chance of dropping a request or ack (default 0)\n"
+            "  -t <us>    time between housekeeping passes (default %u)\n"
+            "  -e <ms>    end time (default %ums after the last event)\n"
+            "  -s <seed>  random seed for drops (default 1)\n"
+            "  -v         also print the master's link stats and telemetry\n",
+            name, SIM_DEFAULT_TICK_US, SIM_DEFAULT_TAIL_MS);
+}
+
+int main(int argc, char **argv) {
+    uint64_t end_us  = 0;
+    bool     verbose = false;
+    int      opt;
+
+    while ((opt = getopt(argc, argv, "l:b:d:t:e:s:v")) != -1) {
+        switch (opt) {
+            case 'l':
+                sim_link.latency_us = strtoul(optarg, NULL, 0);
+                break;
+            case 'b':
+                sim_link.bandwidth = strtoul(optarg, NULL, 0);
+                break;
+            case 'd':
+                sim_link.drop_percent = MIN(strtoul(optarg, NULL, 0), 100);
+                break;
+            case 't':
+                sim_link.tick_us = MAX(strtoul(optarg, NULL, 0), 1);
+                break;
+            case 'e':
+                end_us = strtoull(optarg, NULL, 0) * 1000;
+                break;
+            case 's':
+                sim_link.seed = MAX(strtoul(optarg, NULL, 0), 1);
+                break;
+            case 'v':
+                verbose = true;
+                break;
+            default:
+                sim_usage(argv[0]);
+                return 2;
+        }
+    }
+    if (optind != argc - 1) {
+        sim_usage(argv[0]);
+        return 2;
+    }
+
+    FILE *trace = strcmp(argv[optind], "-") ? fopen(argv[optind], "r") : stdin;
+    if (!trace) {
+        fprintf(stderr, "Failed to open %s: %s\n", argv[optind], strerror(errno));
+        return 2;
+    }
+    bool trace_ok = sim_read_trace(trace);
+    if (trace != stdin) {
+        fclose(trace);
+    }
+    if (!trace_ok) {
+        return 2;
+    }
+    if (!end_us) {
+        end_us = (sim_event_count ? sim_events[sim_event_count - 1].time_us : 0) + SIM_DEFAULT_TAIL_MS * 1000;
+    }
+
+    char    exe[PATH_MAX];
+    ssize_t length = readlink("/proc/self/exe", exe, sizeof(exe) - 1);
+    if (length < 0) {
+        fprintf(stderr, "Failed to find the simulator's directory: %s\n", strerror(errno));
+        return 2;
+    }
+    exe[length]      = '\0';
+    const char *dir  = dirname(exe);
+    sim_master       = sim_load_half(dir, "sim_half_master.so");
+    sim_slave        = sim_load_half(dir, "sim_half_slave.so");
+    if (!sim_master || !sim_slave || sim_master == sim_slave) {
+        fprintf(stderr, "Failed to load two separate halves\n");
+        return 2;
+    }
+    sim_slave->init(&sim_host, false);
+    sim_master->init(&sim_host, true);
+
+    uint32_t ticks      = 0;
+    uint64_t tick_cpu   = 0;
+    uint64_t tick_max   = 0;
+    size_t   next_event = 0;
+
+    while (sim_clock < end_us) {
+        uint64_t tick_start = sim_clock;
+
+        while (next_event < sim_event_count && sim_events[next_event].time_us <= sim_clock) {
+            sim_apply_event(&sim_events[next_event++]);
+        }
+
+        if (sim_master->is_suspended()) {
+            // housekeeping doesn't run while suspended, but the suspend callback is called constantly
+            sim_master->set_suspended(true);
+        } else {
+            uint64_t slave_cpu = sim_slave_cpu_ns;
+            uint64_t start     = sim_cpu_ns();
+            sim_master->housekeeping();
+            uint64_t elapsed = sim_cpu_ns() - start - (sim_slave_cpu_ns - slave_cpu);
+            ticks++;
+            tick_cpu += elapsed;
+            if (elapsed > tick_max) {
+                tick_max = elapsed;
+            }
+        }
+        sim_slave->housekeeping();
+        sim_check_visible(sim_clock);
+
+        // a pass that blocked on the link for longer than a tick delays the next one
+        sim_clock = MAX(sim_clock, tick_start + sim_link.tick_us);
+    }
+
+    printf("Link: latency %uus, bandwidth %uB/s, drop %u%%, tick %uus\n", sim_link.latency_us, sim_link.bandwidth,
+           sim_link.drop_percent, sim_link.tick_us);
+    printf("Ran %llums: %u transactions, %u dropped requests, %u dropped acks\n",
+           (unsigned long long)(sim_clock / 1000), sim_transactions, sim_dropped_req, sim_dropped_ack);
+    printf("Link throughput: %lluB/s\n", (unsigned long long)(sim_wire_bytes * 1000000ULL / MAX(sim_clock, 1)));
+    printf("Sync CPU time per tick (host): avg %.2fus, max %.2fus over %u ticks\n",
+           ticks ? tick_cpu / 1000.0 / ticks : 0.0, tick_max / 1000.0, ticks);
+    printf("Update to visible latency:\n");
+
+    sim_field_stats_t total = {0};
+    for (sim_field_t i = 0; i < SIM_FIELD_COUNT; i++) {
+        const sim_field_stats_t *stats = &sim_field_stats[i];
+        if (!stats->updates) {
+            continue;
+        }
+        sim_print_field_stats(sim_field_names[i], stats);
+        total.updates += stats->updates;
+        total.visible += stats->visible;
+        total.superseded += stats->superseded;
+        total.total_us += stats->total_us;
+        total.max_us = MAX(total.max_us, stats->max_us);
+    }
+    sim_print_field_stats("all", &total);
+
+    uint32_t lost = total.updates - total.visible - total.superseded;
+    printf("Lost updates: %u\n", lost);
+
+    if (verbose) {
+        printf("\nMaster:\n");
+        sim_master->print_stats();
+    }
+    free(sim_events);
+    return lost ? 1 : 0;
+}
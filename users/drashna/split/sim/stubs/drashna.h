@@ -0,0 +1,62 @@
+// Copyright 2024 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @brief Host stand-in for the userspace state that the split transport sync uses.
+ *
+ * The config unions need to match drashna.h, so that the packets are the same size as on the keyboard.
+ */
+
+#pragma once
+
+#include "quantum.h"
+
+typedef union {
+    uint32_t raw;
+    struct {
+        bool     rgb_layer_change     : 1;
+        bool     is_overwatch         : 1;
+        bool     nuke_switch          : 1;
+        bool     swapped_numbers      : 1;
+        bool     rgb_matrix_idle_anim : 1;
+        bool     reserved1            : 1;
+        bool     matrix_scan_print    : 1;
+        bool     align_reserved       : 1;
+        uint8_t  oled_brightness      : 8;
+        bool     oled_lock            : 1;
+        bool     enable_acceleration  : 1;
+        uint32_t reserved             : 13;
+        bool     check                : 1;
+    };
+} userspace_config_t;
+
+_Static_assert(sizeof(userspace_config_t) == sizeof(uint32_t), "Userspace EECONFIG out of spec.");
+
+extern userspace_config_t userspace_config;
+
+typedef union {
+    uint32_t raw;
+    struct {
+        bool     audio_enable         : 1;
+        bool     audio_clicky_enable  : 1;
+        bool     tap_toggling         : 1;
+        uint8_t  unicode_mode         : 3;
+        bool     swap_hands           : 1;
+        bool     host_driver_disabled : 1;
+        uint8_t  unicode_typing_mode  : 3;
+        bool     is_caps_word         : 1;
+        uint32_t reserved             : 20;
+    };
+} user_runtime_config_t;
+
+_Static_assert(sizeof(user_runtime_config_t) == sizeof(uint32_t), "Userspace Runtime config out of spec.");
+
+extern user_runtime_config_t user_state;
+
+void     center_text(const char *text, char *output, uint8_t width);
+void     set_keyboard_lock(bool enable);
+bool     is_device_suspended(void);
+void     set_is_device_suspended(bool status);
+uint32_t get_matrix_scan_rate(void);
+uint32_t timer_read_precise(void);
+uint32_t timer_elapsed_precise_us(uint32_t start);
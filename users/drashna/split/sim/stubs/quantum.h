@@ -0,0 +1,44 @@
+// Copyright 2024 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @brief Host stand-in for the parts of the QMK core that the split transport sync uses.
+ *
+ * Timers run off the simulated clock, rather than the system tick.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+
+#define PACKED __attribute__((packed))
+
+#ifndef MIN
+#    define MIN(a, b) ((a) < (b) ? (a) : (b))
+#endif
+#ifndef MAX
+#    define MAX(a, b) ((a) > (b) ? (a) : (b))
+#endif
+#ifndef ARRAY_SIZE
+#    define ARRAY_SIZE(array) (sizeof((array)) / sizeof((array)[0]))
+#endif
+
+#define xprintf printf
+
+uint16_t timer_read(void);
+uint32_t timer_read32(void);
+uint16_t timer_elapsed(uint16_t last);
+uint32_t timer_elapsed32(uint32_t last);
+uint32_t sync_timer_read32(void);
+uint32_t sync_timer_elapsed32(uint32_t last);
+
+typedef union {
+    uint16_t raw;
+} keymap_config_t;
+
+extern keymap_config_t keymap_config;
+
+bool is_keyboard_master(void);
@@ -0,0 +1,36 @@
+// Copyright 2024 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @brief Host stand-in for the QMK split transactions API.
+ *
+ * The user transaction ids come from split/config.h, the same as on the keyboard.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifndef RPC_M2S_BUFFER_SIZE
+#    define RPC_M2S_BUFFER_SIZE 32
+#endif
+#ifndef RPC_S2M_BUFFER_SIZE
+#    define RPC_S2M_BUFFER_SIZE 32
+#endif
+
+enum serial_transaction_id {
+    GET_SLAVE_MATRIX_CHECKSUM = 0, // stands in for the core transactions
+#ifdef SPLIT_TRANSACTION_IDS_USER
+    SPLIT_TRANSACTION_IDS_USER,
+#endif
+    NUM_TOTAL_TRANSACTIONS
+};
+
+typedef void (*slave_transaction_handler_t)(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer,
+                                            uint8_t target2initiator_buffer_size, void *target2initiator_buffer);
+
+void transaction_register_rpc(int8_t transaction_id, slave_transaction_handler_t handler);
+bool transaction_rpc_exec(int8_t transaction_id, uint8_t initiator2target_buffer_size,
+                          const void *initiator2target_buffer, uint8_t target2initiator_buffer_size,
+                          void *target2initiator_buffer);
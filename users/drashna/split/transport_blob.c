@@ -0,0 +1,272 @@
+// Copyright 2024 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @brief Fragmenting channel for sending large blobs of data over split transport.
+ *
+ * Each blob is snapshotted on the master when it changes, and streamed to the slave one fragment at a time, so the
+ * RPC buffers don't need to be large enough to hold the whole thing. The slave reassembles the fragments into a
+ * staging buffer, and only copies it over the live data once a complete generation has been received.
+ *
+ * Channels can also provide an encoder and decoder pair. When the slave is known to hold the previous generation, the
+ * master sends the change as a single delta message instead, and falls back to the whole blob if the delta can't be
+ * encoded, or the slave rejects it.
+ */
+
+#include "transport_blob.h"
+#include "transport_stats.h"
+#include "quantum.h"
+#include "drashna.h"
+#include "transactions.h"
+#include <string.h>
+
+typedef enum {
+    BLOB_MSG_FRAGMENT = 0,
+    BLOB_MSG_DELTA, // encoded change from the previous generation, offset is unused
+} blob_msg_type_t;
+
+typedef struct PACKED {
+    uint8_t  type;
+    uint8_t  channel;
+    uint8_t  generation;
+    uint16_t offset;
+    uint16_t total_length;
+    uint8_t  length;
+    uint8_t  data[RPC_M2S_BUFFER_SIZE - 8];
+} split_msg_t;
+
+_Static_assert(sizeof(split_msg_t) == RPC_M2S_BUFFER_SIZE, "Wrong size");
+
+typedef struct PACKED {
+    uint8_t  generation;
+    uint16_t received;
+} split_msg_ack_t;
+
+_Static_assert(sizeof(split_msg_ack_t) <= RPC_S2M_BUFFER_SIZE, "Wrong size");
+
+static transport_blob_channel_t *blob_channels      = NULL;
+static uint8_t                   blob_channel_count = 0;
+static uint16_t                  blob_errors        = 0;
+
+/**
+ * @brief Reassembles blob fragments on the slave side
+ *
+ * @param initiator2target_buffer_size
+ * @param initiator2target_buffer
+ * @param target2initiator_buffer_size
+ * @param target2initiator_buffer
+ */
+void transport_blob_sync(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer,
+                         uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    const split_msg_t *msg = (const split_msg_t *)initiator2target_buffer;
+
+    if (initiator2target_buffer_size < offsetof(split_msg_t, data) || msg->channel >= blob_channel_count ||
+        initiator2target_buffer_size != offsetof(split_msg_t, data) + msg->length) {
+        if (blob_errors < UINT16_MAX) {
+            blob_errors++;
+        }
+        return;
+    }
+
+    transport_blob_channel_t *channel = &blob_channels[msg->channel];
+    if (msg->type == BLOB_MSG_DELTA) {
+        bool is_complete = channel->offset == channel->size;
+        if (is_complete && msg->generation == channel->generation) {
+            // already applied, the ack must have been lost
+        } else if (is_complete && msg->generation == (uint8_t)(channel->generation + 1) && channel->decode &&
+                   msg->total_length == channel->size) {
+            // decode into the staging buffer, so a malformed delta can't corrupt the live data
+            memcpy(channel->buffer, channel->data, channel->size);
+            if (channel->decode(channel->buffer, channel->size, msg->data, msg->length)) {
+                memcpy(channel->data, channel->buffer, channel->size);
+                channel->generation = msg->generation;
+                if (channel->on_update) {
+                    channel->on_update();
+                }
+            } else if (blob_errors < UINT16_MAX) {
+                blob_errors++;
+            }
+        } else if (blob_errors < UINT16_MAX) {
+            blob_errors++;
+        }
+    } else {
+        if (msg->offset == 0) {
+            // start of a new generation, drop anything that was partially received
+            channel->generation = msg->generation;
+            channel->offset     = 0;
+        }
+
+        // only accept fragments in order, and for the generation that's in progress
+        if (msg->generation == channel->generation && msg->offset == channel->offset &&
+            msg->total_length == channel->size && (msg->offset + msg->length) <= channel->size) {
+            memcpy(&channel->buffer[msg->offset], msg->data, msg->length);
+            channel->offset += msg->length;
+            if (channel->offset == channel->size) {
+                memcpy(channel->data, channel->buffer, channel->size);
+                if (channel->on_update) {
+                    channel->on_update();
+                }
+            }
+        } else if (blob_errors < UINT16_MAX) {
+            blob_errors++;
+        }
+    }
+
+    if (target2initiator_buffer_size == sizeof(split_msg_ack_t)) {
+        split_msg_ack_t *ack = (split_msg_ack_t *)target2initiator_buffer;
+        ack->generation      = channel->generation;
+        ack->received        = channel->offset;
+    }
+}
+
+/**
+ * @brief Send the next fragment for a channel
+ *
+ * @param index channel index
+ * @return true fragment was acknowledged
+ * @return false transaction failed
+ */
+static bool transport_blob_send_fragment(uint8_t index) {
+    transport_blob_channel_t *channel = &blob_channels[index];
+    split_msg_t               msg     = {0};
+    split_msg_ack_t           ack     = {0};
+
+    msg.channel      = index;
+    msg.generation   = channel->generation;
+    msg.offset       = channel->offset;
+    msg.total_length = channel->size;
+
+    if (channel->offset == 0 && channel->has_acked && channel->encode) {
+        msg.type   = BLOB_MSG_DELTA;
+        msg.length = channel->encode(channel->acked, channel->buffer, channel->size, msg.data, sizeof(msg.data));
+    }
+    if (!msg.length) {
+        msg.type   = BLOB_MSG_FRAGMENT;
+        msg.length = MIN(sizeof(msg.data), channel->size - channel->offset);
+        memcpy(msg.data, &channel->buffer[channel->offset], msg.length);
+    }
+
+    if (channel->needs_retry) {
+        transport_stats_record_retry(RPC_ID_USER_BLOB_SYNC);
+    }
+    channel->needs_retry = !transport_stats_rpc_exec(RPC_ID_USER_BLOB_SYNC, offsetof(split_msg_t, data) + msg.length,
+                                                     &msg, sizeof(ack), &ack);
+    if (channel->needs_retry) {
+        return false;
+    }
+
+    uint16_t expected = msg.type == BLOB_MSG_DELTA ? channel->size : channel->offset + msg.length;
+    if (ack.generation == channel->generation && ack.received == expected) {
+        channel->offset = expected;
+        if (channel->offset >= channel->size) {
+            channel->is_sending = false;
+            if (channel->acked) {
+                memcpy(channel->acked, channel->buffer, channel->size);
+                channel->has_acked = true;
+            }
+            transport_stats_record_visible(RPC_ID_USER_BLOB_SYNC,
+                                           timer_elapsed_precise_us(channel->snapshot_timestamp));
+        }
+    } else {
+        // slave is out of step (reset, missed a fragment, or couldn't apply the delta), so restart this generation
+        // from the top, as a whole blob
+        channel->offset      = 0;
+        channel->needs_retry = true;
+        channel->has_acked   = false;
+    }
+    return true;
+}
+
+/**
+ * @brief Snapshot any changed channels, and get the most urgent priority of the channels that are sending
+ *
+ * @return sync_priority_t SYNC_PRIORITY_NONE if there is nothing to send
+ */
+sync_priority_t transport_blob_pending_priority(void) {
+    sync_priority_t priority = SYNC_PRIORITY_NONE;
+
+    if (!is_keyboard_master()) {
+        return priority;
+    }
+
+    for (uint8_t i = 0; i < blob_channel_count; i++) {
+        transport_blob_channel_t *channel = &blob_channels[i];
+        // don't restart an in-flight generation, so that rapidly changing data still completes
+        if (!channel->is_sending && timer_elapsed(channel->last_snapshot) >= channel->min_interval &&
+            memcmp(channel->data, channel->buffer, channel->size)) {
+            memcpy(channel->buffer, channel->data, channel->size);
+            channel->generation++;
+            channel->offset             = 0;
+            channel->is_sending         = true;
+            channel->last_snapshot      = timer_read();
+            channel->snapshot_timestamp = timer_read_precise();
+        }
+        if (channel->is_sending && channel->priority < priority) {
+            priority = channel->priority;
+        }
+    }
+    return priority;
+}
+
+/**
+ * @brief Send one fragment from the most urgent channel
+ *
+ * Channels of the same priority are round robined, so one large blob can't starve the others.
+ *
+ * @return true fragment was sent
+ * @return false nothing to send, or the transaction failed
+ */
+bool transport_blob_send_next(void) {
+    static uint8_t next_channel = 0;
+    int16_t        best         = -1;
+
+    for (uint8_t i = 0; i < blob_channel_count; i++) {
+        uint8_t index = (next_channel + i) % blob_channel_count;
+        if (blob_channels[index].is_sending &&
+            (best < 0 || blob_channels[index].priority < blob_channels[best].priority)) {
+            best = index;
+        }
+    }
+    if (best < 0) {
+        return false;
+    }
+    next_channel = (best + 1) % blob_channel_count;
+    return transport_blob_send_fragment(best);
+}
+
+/**
+ * @brief Restream every channel from the start, such as when the slave has lost its state
+ *
+ */
+void transport_blob_resync(void) {
+    for (uint8_t i = 0; i < blob_channel_count; i++) {
+        if (!blob_channels[i].is_sending) {
+            blob_channels[i].snapshot_timestamp = timer_read_precise();
+        }
+        blob_channels[i].generation++;
+        blob_channels[i].offset     = 0;
+        blob_channels[i].is_sending = true;
+        blob_channels[i].has_acked  = false;
+    }
+}
+
+/**
+ * @brief Get the number of fragments that the slave has rejected
+ *
+ * @return uint16_t
+ */
+uint16_t transport_blob_get_error_count(void) {
+    return blob_errors;
+}
+
+/**
+ * @brief Register the blob channels and the split transaction
+ *
+ * @param channels channel table, must be identical on both halves
+ * @param count number of channels
+ */
+void transport_blob_init(transport_blob_channel_t *channels, uint8_t count) {
+    blob_channels      = channels;
+    blob_channel_count = count;
+    transaction_register_rpc(RPC_ID_USER_BLOB_SYNC, transport_blob_sync);
+}
@@ -0,0 +1,56 @@
+// Copyright 2024 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "transport_sync.h"
+
+/**
+ * @brief Encodes the change from one snapshot to the next into a compact delta
+ *
+ * @param from data the slave already has
+ * @param to new data
+ * @param size size of the data
+ * @param out buffer for the delta
+ * @param out_size size of the buffer
+ * @return uint8_t length of the delta, or 0 if it can't be encoded (or won't fit), to send the whole blob instead
+ */
+typedef uint8_t (*transport_blob_encode_t)(const uint8_t *from, const uint8_t *to, uint16_t size, uint8_t *out,
+                                           uint8_t out_size);
+/**
+ * @brief Applies a delta in place, reversing transport_blob_encode_t
+ *
+ * @return true delta was applied
+ * @return false delta was malformed, data may have been partially modified
+ */
+typedef bool (*transport_blob_decode_t)(uint8_t *data, uint16_t size, const uint8_t *delta, uint8_t length);
+
+typedef struct {
+    void    *data;   // live data: the source on the master, the destination on the slave
+    uint8_t *buffer; // same size as data: snapshot being streamed (master), or reassembly area (slave)
+    uint16_t size;
+    uint16_t offset;     // next offset to send (master), or number of bytes received (slave)
+    uint8_t  generation; // bumped by the master every time a new snapshot is started
+    bool     is_sending;
+    bool     needs_retry; // last fragment failed, or the slave was out of step
+    bool     has_acked;   // slave is known to hold the contents of acked (master)
+    uint16_t last_snapshot;
+    uint32_t snapshot_timestamp; // for the update to visible latency stats
+
+    sync_priority_t priority;
+    uint16_t        min_interval; // minimum time between snapshots, in ms
+
+    // optional delta encoding, the whole blob is sent if these aren't set
+    uint8_t                *acked; // same size as data: last snapshot the slave acknowledged (master)
+    transport_blob_encode_t encode;
+    transport_blob_decode_t decode;
+    void (*on_update)(void); // called on the slave when new data has been applied
+} transport_blob_channel_t;
+
+void            transport_blob_init(transport_blob_channel_t *channels, uint8_t count);
+sync_priority_t transport_blob_pending_priority(void);
+bool            transport_blob_send_next(void);
+void            transport_blob_resync(void);
+uint16_t        transport_blob_get_error_count(void);
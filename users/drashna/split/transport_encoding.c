@@ -0,0 +1,197 @@
+// Copyright 2024 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @brief Delta encoders and decoders for the blob channels.
+ *
+ * These turn a change to one of the display strings into a few bytes, so that it fits into a single blob message,
+ * rather than resending the whole string every time a key is pressed.
+ */
+
+#include "transport_encoding.h"
+#include <string.h>
+
+#define KEYLOG_DELTA_FILL 0xFF
+
+/**
+ * @brief Encodes a keylogger change as "shift left by n, and append n chars"
+ *
+ * The keylogger is a shifting window, so a keypress is just a shift of one and the new character. Clearing it
+ * (ctrl+backspace) is sent as a fill instead.
+ *
+ * Delta format: [shift][shift chars to append], or [KEYLOG_DELTA_FILL][fill char]
+ *
+ * @param from keylogger string the slave has
+ * @param to new keylogger string
+ * @param size size of the string, including the null terminator
+ * @param out buffer for the delta
+ * @param out_size size of the buffer
+ * @return uint8_t length of the delta, or 0 if the change isn't a shift
+ */
+uint8_t transport_encode_keylog(const uint8_t *from, const uint8_t *to, uint16_t size, uint8_t *out, uint8_t out_size) {
+    uint16_t length = size - 1;
+
+    if (!length || out_size < 2 || from[length] != to[length]) {
+        return 0;
+    }
+
+    bool is_filled = true;
+    for (uint16_t i = 1; i < length; i++) {
+        if (to[i] != to[0]) {
+            is_filled = false;
+            break;
+        }
+    }
+    if (is_filled) {
+        out[0] = KEYLOG_DELTA_FILL;
+        out[1] = to[0];
+        return 2;
+    }
+
+    for (uint16_t shift = 1; shift <= length && shift < out_size && shift < KEYLOG_DELTA_FILL; shift++) {
+        if (!memcmp(&from[shift], to, length - shift)) {
+            out[0] = shift;
+            memcpy(&out[1], &to[length - shift], shift);
+            return shift + 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Applies a keylogger delta from transport_encode_keylog
+ *
+ * @param data keylogger string to update
+ * @param size size of the string, including the null terminator
+ * @param delta encoded delta
+ * @param length length of the delta
+ * @return true delta was applied
+ * @return false delta was malformed
+ */
+bool transport_decode_keylog(uint8_t *data, uint16_t size, const uint8_t *delta, uint8_t length) {
+    uint16_t str_length = size - 1;
+
+    if (length == 2 && delta[0] == KEYLOG_DELTA_FILL) {
+        memset(data, delta[1], str_length);
+        return true;
+    }
+
+    uint8_t shift = delta[0];
+    if (!length || !shift || shift > str_length || length != shift + 1) {
+        return false;
+    }
+    memmove(data, &data[shift], str_length - shift);
+    memcpy(&data[str_length - shift], &delta[1], shift);
+    return true;
+}
+
+/**
+ * @brief Length of a null padded string row, or -1 if there is anything after the terminator
+ *
+ * @param row string row
+ * @param stride size of the row
+ * @return int16_t
+ */
+static int16_t autocorrect_row_length(const uint8_t *row, uint16_t stride) {
+    uint16_t length = 0;
+    while (length < stride && row[length]) {
+        length++;
+    }
+    if (length == stride) {
+        return -1;
+    }
+    for (uint16_t i = length; i < stride; i++) {
+        if (row[i]) {
+            return -1;
+        }
+    }
+    return length;
+}
+
+/**
+ * @brief Encodes the autocorrect strings as the typo, and the correction as an edit of the typo
+ *
+ * Corrections usually share most of their characters with the typo, so only the part between the common prefix and
+ * suffix is sent. The data is the raw typo and correction strings, as two null padded rows.
+ *
+ * Delta format: [typo length][typo][prefix length][suffix length][middle of the correction]
+ *
+ * @param from unused, the encoding doesn't depend on the previous strings
+ * @param to new autocorrect strings
+ * @param size size of both rows
+ * @param out buffer for the delta
+ * @param out_size size of the buffer
+ * @return uint8_t length of the delta, or 0 if it won't fit
+ */
+uint8_t transport_encode_autocorrect(const uint8_t *from, const uint8_t *to, uint16_t size, uint8_t *out,
+                                     uint8_t out_size) {
+    uint16_t stride         = size / 2;
+    int16_t  typo_length    = autocorrect_row_length(to, stride);
+    int16_t  correct_length = autocorrect_row_length(&to[stride], stride);
+
+    if ((size & 1) || typo_length < 0 || correct_length < 0) {
+        return 0;
+    }
+
+    const uint8_t *typo    = to;
+    const uint8_t *correct = &to[stride];
+    uint8_t        prefix  = 0;
+    uint8_t        suffix  = 0;
+    while (prefix < typo_length && prefix < correct_length && typo[prefix] == correct[prefix]) {
+        prefix++;
+    }
+    while ((prefix + suffix) < typo_length && (prefix + suffix) < correct_length &&
+           typo[typo_length - suffix - 1] == correct[correct_length - suffix - 1]) {
+        suffix++;
+    }
+
+    uint8_t middle_length = correct_length - prefix - suffix;
+    uint8_t length        = 1 + typo_length + 2 + middle_length;
+    if (length > out_size) {
+        return 0;
+    }
+
+    out[0] = typo_length;
+    memcpy(&out[1], typo, typo_length);
+    out[1 + typo_length] = prefix;
+    out[2 + typo_length] = suffix;
+    memcpy(&out[3 + typo_length], &correct[prefix], middle_length);
+    return length;
+}
+
+/**
+ * @brief Applies an autocorrect delta from transport_encode_autocorrect
+ *
+ * @param data autocorrect strings to update
+ * @param size size of both rows
+ * @param delta encoded delta
+ * @param length length of the delta
+ * @return true delta was applied
+ * @return false delta was malformed
+ */
+bool transport_decode_autocorrect(uint8_t *data, uint16_t size, const uint8_t *delta, uint8_t length) {
+    uint16_t stride = size / 2;
+
+    if (!length || (size & 1)) {
+        return false;
+    }
+    uint8_t typo_length = delta[0];
+    if (typo_length >= stride || length < 3 + typo_length) {
+        return false;
+    }
+    uint8_t prefix         = delta[1 + typo_length];
+    uint8_t suffix         = delta[2 + typo_length];
+    uint8_t middle_length  = length - 3 - typo_length;
+    uint8_t correct_length = prefix + suffix + middle_length;
+    if ((prefix + suffix) > typo_length || correct_length >= stride) {
+        return false;
+    }
+
+    memset(data, 0, size);
+    memcpy(data, &delta[1], typo_length);
+    uint8_t *correct = &data[stride];
+    memcpy(correct, data, prefix);
+    memcpy(&correct[prefix], &delta[3 + typo_length], middle_length);
+    memcpy(&correct[prefix + middle_length], &data[typo_length - suffix], suffix);
+    return true;
+}
@@ -0,0 +1,13 @@
+// Copyright 2024 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+uint8_t transport_encode_keylog(const uint8_t *from, const uint8_t *to, uint16_t size, uint8_t *out, uint8_t out_size);
+bool    transport_decode_keylog(uint8_t *data, uint16_t size, const uint8_t *delta, uint8_t length);
+uint8_t transport_encode_autocorrect(const uint8_t *from, const uint8_t *to, uint16_t size, uint8_t *out,
+                                     uint8_t out_size);
+bool    transport_decode_autocorrect(uint8_t *data, uint16_t size, const uint8_t *delta, uint8_t length);
@@ -0,0 +1,239 @@
+// Copyright 2024 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @brief Link statistics for the userspace split transactions.
+ *
+ * Every user RPC goes through transport_stats_rpc_exec, which times the round trip and records it per RPC id. The
+ * p99 is estimated from a log2 histogram, so that no samples need to be kept around.
+ */
+
+#include "transport_stats.h"
+#include "quantum.h"
+#include "drashna.h"
+#include <stdio.h>
+#include <string.h>
+
+static transport_stats_t      transport_stats[TRANSPORT_STATS_COUNT] = {0};
+static transport_stats_tick_t transport_stats_tick                   = {0};
+static uint32_t               transport_stats_since                  = 0;
+
+// clang-format off
+static const char *const transport_stats_names[TRANSPORT_STATS_COUNT] = {
+    [RPC_ID_USER_DELTA_SYNC - TRANSPORT_STATS_FIRST_ID] = "DLT",
+    [RPC_ID_USER_BLOB_SYNC  - TRANSPORT_STATS_FIRST_ID] = "BLB",
+};
+// clang-format on
+
+static transport_stats_t *transport_stats_lookup(int8_t id) {
+    if (id < TRANSPORT_STATS_FIRST_ID || id >= NUM_TOTAL_TRANSACTIONS) {
+        return NULL;
+    }
+    return &transport_stats[id - TRANSPORT_STATS_FIRST_ID];
+}
+
+/**
+ * @brief Add a round trip time to the histogram and running totals
+ *
+ * @param stats stats to update
+ * @param elapsed_us round trip time
+ */
+static void transport_stats_record_latency(transport_stats_t *stats, uint32_t elapsed_us) {
+    uint8_t bucket = 0;
+    while (bucket < (TRANSPORT_STATS_HISTOGRAM_BUCKETS - 1) && (elapsed_us >> bucket)) {
+        bucket++;
+    }
+    // decay the histogram rather than letting a bucket saturate, so the percentiles track recent behavior
+    if (stats->histogram[bucket] == UINT16_MAX) {
+        for (uint8_t i = 0; i < TRANSPORT_STATS_HISTOGRAM_BUCKETS; i++) {
+            stats->histogram[i] >>= 1;
+        }
+    }
+    stats->histogram[bucket]++;
+
+    if (stats->count == 0 || elapsed_us < stats->min_us) {
+        stats->min_us = elapsed_us;
+    }
+    if (elapsed_us > stats->max_us) {
+        stats->max_us = elapsed_us;
+    }
+    stats->total_us += elapsed_us;
+    stats->count++;
+}
+
+/**
+ * @brief Wrapper for transaction_rpc_exec that records the round trip time and result
+ *
+ * @return true transaction succeeded
+ * @return false transaction failed
+ */
+bool transport_stats_rpc_exec(int8_t id, uint8_t initiator2target_buffer_size, const void *initiator2target_buffer,
+                              uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    transport_stats_t *stats = transport_stats_lookup(id);
+    uint32_t           start = timer_read_precise();
+    bool               ret   = transaction_rpc_exec(id, initiator2target_buffer_size, initiator2target_buffer,
+                                                    target2initiator_buffer_size, target2initiator_buffer);
+
+    if (stats) {
+        stats->bytes_sent += initiator2target_buffer_size;
+        if (ret) {
+            stats->bytes_received += target2initiator_buffer_size;
+            transport_stats_record_latency(stats, timer_elapsed_precise_us(start));
+        } else {
+            stats->failures++;
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Record that the data for an RPC is being sent again, because the last attempt failed or wasn't acknowledged
+ *
+ * @param id RPC id
+ */
+void transport_stats_record_retry(int8_t id) {
+    transport_stats_t *stats = transport_stats_lookup(id);
+    if (stats) {
+        stats->retries++;
+    }
+}
+
+/**
+ * @brief Record how long an update took to become visible on the slave
+ *
+ * @param id RPC id that carried the update
+ * @param elapsed_us time from the update being picked up on the master, to the slave acknowledging it
+ */
+void transport_stats_record_visible(int8_t id, uint32_t elapsed_us) {
+    transport_stats_t *stats = transport_stats_lookup(id);
+    if (stats) {
+        stats->visible_count++;
+        stats->visible_total_us += elapsed_us;
+        if (elapsed_us > stats->visible_max_us) {
+            stats->visible_max_us = elapsed_us;
+        }
+    }
+}
+
+/**
+ * @brief Record the CPU time of a sync pass
+ *
+ * @param elapsed_us
+ */
+void transport_stats_record_tick(uint32_t elapsed_us) {
+    transport_stats_tick.count++;
+    transport_stats_tick.total_us += elapsed_us;
+    if (elapsed_us > transport_stats_tick.max_us) {
+        transport_stats_tick.max_us = elapsed_us;
+    }
+}
+
+/**
+ * @brief Get the stats for an RPC id
+ *
+ * @param id RPC id
+ * @return const transport_stats_t* NULL if the id isn't a user RPC
+ */
+const transport_stats_t *transport_stats_get(int8_t id) {
+    return transport_stats_lookup(id);
+}
+
+uint32_t transport_stats_average_us(const transport_stats_t *stats) {
+    return stats->count ? stats->total_us / stats->count : 0;
+}
+
+/**
+ * @brief Estimate a percentile of the round trip time from the histogram
+ *
+ * @param stats stats to check
+ * @param percentile 1-100
+ * @return uint32_t upper bound of the bucket the percentile falls in, capped to the max seen
+ */
+uint32_t transport_stats_percentile_us(const transport_stats_t *stats, uint8_t percentile) {
+    uint32_t samples = 0;
+    for (uint8_t i = 0; i < TRANSPORT_STATS_HISTOGRAM_BUCKETS; i++) {
+        samples += stats->histogram[i];
+    }
+    if (!samples) {
+        return 0;
+    }
+
+    uint32_t target     = (samples * percentile + 99) / 100;
+    uint32_t cumulative = 0;
+    for (uint8_t i = 0; i < TRANSPORT_STATS_HISTOGRAM_BUCKETS; i++) {
+        cumulative += stats->histogram[i];
+        if (cumulative >= target) {
+            if (i == (TRANSPORT_STATS_HISTOGRAM_BUCKETS - 1)) {
+                break;
+            }
+            return MIN(((uint32_t)1 << i) - 1, stats->max_us);
+        }
+    }
+    return stats->max_us;
+}
+
+void transport_stats_reset(void) {
+    memset(transport_stats, 0, sizeof(transport_stats));
+    memset(&transport_stats_tick, 0, sizeof(transport_stats_tick));
+    transport_stats_since = timer_read32();
+}
+
+/**
+ * @brief Print the stats for every user RPC to the console
+ *
+ */
+void transport_stats_print(void) {
+#ifndef NO_PRINT
+    uint32_t elapsed_ms = MAX(timer_elapsed32(transport_stats_since), 1);
+
+    xprintf("Split transport stats (%lums):\n", elapsed_ms);
+    xprintf("  sync task: passes %lu, avg %luus, max %luus\n", transport_stats_tick.count,
+            transport_stats_tick.count ? transport_stats_tick.total_us / transport_stats_tick.count : 0,
+            transport_stats_tick.max_us);
+    for (uint8_t i = 0; i < TRANSPORT_STATS_COUNT; i++) {
+        const transport_stats_t *stats = &transport_stats[i];
+        xprintf("  %s: count %lu, failed %lu, retries %lu, min %luus, avg %luus, max %luus, p99 %luus\n",
+                transport_stats_names[i] ? transport_stats_names[i] : "???", stats->count, stats->failures,
+                stats->retries, stats->min_us, transport_stats_average_us(stats), stats->max_us,
+                transport_stats_percentile_us(stats, 99));
+        xprintf("    sent %luB/s, received %luB/s, update to visible avg %luus, max %luus\n",
+                (uint32_t)((uint64_t)stats->bytes_sent * 1000 / elapsed_ms),
+                (uint32_t)((uint64_t)stats->bytes_received * 1000 / elapsed_ms),
+                stats->visible_count ? stats->visible_total_us / stats->visible_count : 0, stats->visible_max_us);
+        xprintf("    histogram:");
+        for (uint8_t j = 0; j < TRANSPORT_STATS_HISTOGRAM_BUCKETS; j++) {
+            xprintf(" %u", stats->histogram[j]);
+        }
+        xprintf("\n");
+    }
+#endif
+}
+
+/**
+ * @brief Format the stats for a user RPC, for rendering on a display
+ *
+ * The short format fits in the 21 columns of a 128px wide OLED.
+ *
+ * @param index index of the user RPC, starting from 0
+ * @param buf buffer to write the string to
+ * @param size size of the buffer
+ * @param verbose use the long format
+ * @return true string was written
+ * @return false index is out of range
+ */
+bool transport_stats_render_string(uint8_t index, char *buf, size_t size, bool verbose) {
+    if (index >= TRANSPORT_STATS_COUNT) {
+        return false;
+    }
+    const transport_stats_t *stats = &transport_stats[index];
+    const char              *name  = transport_stats_names[index] ? transport_stats_names[index] : "???";
+
+    if (verbose) {
+        snprintf(buf, size, "%s avg %luus p99 %luus max %luus err %lu", name, transport_stats_average_us(stats),
+                 transport_stats_percentile_us(stats, 99), stats->max_us, stats->failures);
+    } else {
+        snprintf(buf, size, "%s%5lu%5lu%4lu", name, MIN(transport_stats_average_us(stats), 99999),
+                 MIN(transport_stats_percentile_us(stats, 99), 99999), MIN(stats->failures, 9999));
+    }
+    return true;
+}
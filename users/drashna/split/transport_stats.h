@@ -0,0 +1,58 @@
+// Copyright 2024 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "transactions.h"
+
+#ifndef TRANSPORT_STATS_HISTOGRAM_BUCKETS
+#    define TRANSPORT_STATS_HISTOGRAM_BUCKETS 16
+#endif
+
+#define TRANSPORT_STATS_FIRST_ID RPC_ID_USER_DELTA_SYNC
+#define TRANSPORT_STATS_COUNT    (NUM_TOTAL_TRANSACTIONS - TRANSPORT_STATS_FIRST_ID)
+
+/**
+ * @brief Link statistics for a single user RPC id, recorded on the master
+ *
+ */
+typedef struct {
+    uint32_t count;
+    uint32_t failures;
+    uint32_t retries;
+    uint32_t total_us;
+    uint32_t min_us;
+    uint32_t max_us;
+    uint16_t histogram[TRANSPORT_STATS_HISTOGRAM_BUCKETS]; // log2 buckets of the round trip time, in microseconds
+    uint32_t bytes_sent;
+    uint32_t bytes_received;
+    uint32_t visible_count;    // updates that have been acknowledged by the slave
+    uint32_t visible_total_us; // time from an update being picked up, to the slave acknowledging it
+    uint32_t visible_max_us;
+} transport_stats_t;
+
+/**
+ * @brief CPU time spent in the sync task on the master, per housekeeping pass
+ *
+ */
+typedef struct {
+    uint32_t count;
+    uint32_t total_us;
+    uint32_t max_us;
+} transport_stats_tick_t;
+
+bool                     transport_stats_rpc_exec(int8_t id, uint8_t initiator2target_buffer_size,
+                                                  const void *initiator2target_buffer, uint8_t target2initiator_buffer_size,
+                                                  void *target2initiator_buffer);
+void                     transport_stats_record_retry(int8_t id);
+void                     transport_stats_record_visible(int8_t id, uint32_t elapsed_us);
+void                     transport_stats_record_tick(uint32_t elapsed_us);
+const transport_stats_t *transport_stats_get(int8_t id);
+uint32_t                 transport_stats_average_us(const transport_stats_t *stats);
+uint32_t                 transport_stats_percentile_us(const transport_stats_t *stats, uint8_t percentile);
+void                     transport_stats_reset(void);
+void                     transport_stats_print(void);
+bool                     transport_stats_render_string(uint8_t index, char *buf, size_t size, bool verbose);
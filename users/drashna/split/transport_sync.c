@@ -2,7 +2,9 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 #include "transport_sync.h"
-#include "_wait.h"
+#include "transport_blob.h"
+#include "transport_stats.h"
+#include "transport_encoding.h"
 #include "drashna.h"
 #include "transactions.h"
 #include <string.h>
@@ -23,9 +25,28 @@ extern bool swap_hands;
 #ifdef DISPLAY_DRIVER_ENABLE
 #    include "display/display.h"
 #endif // DISPLAY_DRIVER_ENABLEj
-#ifndef FORCED_SYNC_THROTTLE_MS
-#    define FORCED_SYNC_THROTTLE_MS 100
-#endif // FORCED_SYNC_THROTTLE_MS
+#ifdef RTC_ENABLE
+#    include "features/rtc/rtc.h"
+#endif // RTC_ENABLE
+#ifndef SYNC_KEEPALIVE_INTERVAL_MS
+#    define SYNC_KEEPALIVE_INTERVAL_MS 1000
+#endif // SYNC_KEEPALIVE_INTERVAL_MS
+#ifndef SYNC_MAX_TRANSACTIONS_PER_PASS
+#    ifdef __AVR__
+#        define SYNC_MAX_TRANSACTIONS_PER_PASS 1
+#    else
+#        define SYNC_MAX_TRANSACTIONS_PER_PASS 2
+#    endif
+#endif // SYNC_MAX_TRANSACTIONS_PER_PASS
+#ifndef SYNC_SUSPEND_MAX_ATTEMPTS
+#    define SYNC_SUSPEND_MAX_ATTEMPTS 3
+#endif // SYNC_SUSPEND_MAX_ATTEMPTS
+#ifndef SYNC_SUSPEND_RETRY_INTERVAL_MS
+#    define SYNC_SUSPEND_RETRY_INTERVAL_MS 50
+#endif // SYNC_SUSPEND_RETRY_INTERVAL_MS
+#ifndef SYNC_SLAVE_SUSPEND_TIMEOUT_MS
+#    define SYNC_SLAVE_SUSPEND_TIMEOUT_MS (SYNC_KEEPALIVE_INTERVAL_MS * 5)
+#endif // SYNC_SLAVE_SUSPEND_TIMEOUT_MS
 
 // Make sure that the structs are not larger than the buffer size for synchronization
 _Static_assert(sizeof(userspace_config_t) <= RPC_M2S_BUFFER_SIZE,
@@ -35,116 +56,384 @@ _Static_assert(sizeof(user_runtime_config_t) <= RPC_M2S_BUFFER_SIZE,
 
 uint16_t transport_keymap_config    = 0;
 uint32_t transport_userspace_config = 0, transport_user_state = 0;
+bool     transport_suspend_state    = false;
+
+#if defined(AUTOCORRECT_ENABLE)
+extern char autocorrected_str[2][21];
+extern char autocorrected_str_raw[2][21];
+extern bool autocorrect_str_has_changed;
+#endif
 
 /**
- * @brief Syncs user state between halves of split keyboard
+ * @brief Fields that are carried in the delta sync packet.
  *
- * @param initiator2target_buffer_size
- * @param initiator2target_buffer
- * @param target2initiator_buffer_size
- * @param target2initiator_buffer
+ * The order here is the order the fields are packed into the packet, so it needs to match on both halves.
  */
-void user_state_sync(uint8_t initiator2target_buffer_size, const void* initiator2target_buffer,
-                     uint8_t target2initiator_buffer_size, void* target2initiator_buffer) {
-    if (initiator2target_buffer_size == sizeof(transport_user_state)) {
-        memcpy(&transport_user_state, initiator2target_buffer, initiator2target_buffer_size);
-    }
+typedef enum {
+    USER_SYNC_USER_STATE = 0,
+    USER_SYNC_KEYMAP_CONFIG,
+    USER_SYNC_USERSPACE_CONFIG,
+    USER_SYNC_SUSPEND_STATE,
+#ifdef RTC_ENABLE
+    USER_SYNC_RTC_ANCHOR,
+#endif // RTC_ENABLE
+    USER_SYNC_FIELD_COUNT,
+} user_sync_field_id_t;
+
+_Static_assert(USER_SYNC_FIELD_COUNT <= 8, "Too many fields for the delta sync dirty mask!");
+
+typedef struct {
+    void           *data;
+    void           *shadow;
+    uint8_t         size;
+    sync_priority_t priority;
+    uint16_t        min_interval; // minimum time between sends, in ms, so fast changing data gets coalesced
+} user_sync_field_t;
+
+typedef struct {
+    uint8_t dirty;
+    uint8_t seq;
+    uint8_t data[RPC_M2S_BUFFER_SIZE - 2];
+} user_sync_packet_t;
+
+_Static_assert(sizeof(user_sync_packet_t) == RPC_M2S_BUFFER_SIZE, "Delta sync packet is the wrong size!");
+
+typedef struct PACKED {
+    uint8_t           seq;       // sequence number of the packet being acknowledged
+    uint8_t           checksum;  // checksum of all of the slave's synced fields, after applying the packet
+    split_telemetry_t telemetry; // slave health, piggybacked on the ack so it doesn't need its own transaction
+} user_sync_ack_t;
+
+_Static_assert(sizeof(user_sync_ack_t) <= RPC_S2M_BUFFER_SIZE, "Delta sync ack is larger than split buffer size!");
+
+#define USER_SYNC_HEADER_SIZE (sizeof(user_sync_packet_t) - sizeof(((user_sync_packet_t*)0)->data))
+
+// Last values sent to the slave, so that we can tell what needs to be propagated
+static uint16_t last_keymap_config = 0;
+static uint32_t last_userspace_config = 0, last_user_state = 0;
+static bool     last_suspend_state = false;
+#ifdef RTC_ENABLE
+static rtc_split_anchor_t transport_rtc_anchor = {0}, last_rtc_anchor = {0};
+#endif // RTC_ENABLE
+
+// clang-format off
+static const user_sync_field_t sync_fields[USER_SYNC_FIELD_COUNT] = {
+    // caps word, swap hands, keyboard lock, etc
+    [USER_SYNC_USER_STATE]       = { &transport_user_state,       &last_user_state,       sizeof(transport_user_state),       SYNC_PRIORITY_CRITICAL, 0  },
+    [USER_SYNC_KEYMAP_CONFIG]    = { &transport_keymap_config,    &last_keymap_config,    sizeof(transport_keymap_config),    SYNC_PRIORITY_HIGH,     0  },
+    [USER_SYNC_USERSPACE_CONFIG] = { &transport_userspace_config, &last_userspace_config, sizeof(transport_userspace_config), SYNC_PRIORITY_NORMAL,   50 },
+    [USER_SYNC_SUSPEND_STATE]    = { &transport_suspend_state,    &last_suspend_state,    sizeof(transport_suspend_state),    SYNC_PRIORITY_CRITICAL, 0  },
+#ifdef RTC_ENABLE
+    // only changes when the master re-anchors the time, the slave interpolates in between
+    [USER_SYNC_RTC_ANCHOR]       = { &transport_rtc_anchor,       &last_rtc_anchor,       sizeof(transport_rtc_anchor),       SYNC_PRIORITY_NORMAL,   0  },
+#endif // RTC_ENABLE
+};
+// clang-format on
+
+static uint8_t  sync_dirty_fields = 0;
+static uint16_t sync_last_sent[USER_SYNC_FIELD_COUNT];
+static uint32_t sync_dirty_since[USER_SYNC_FIELD_COUNT]; // for the update to visible latency stats
+
+#ifndef SYNC_TELEMETRY_TIMEOUT_MS
+#    define SYNC_TELEMETRY_TIMEOUT_MS (SYNC_KEEPALIVE_INTERVAL_MS * 3)
+#endif // SYNC_TELEMETRY_TIMEOUT_MS
+
+static split_telemetry_t remote_telemetry         = {0};
+static uint16_t          remote_telemetry_timer   = 0;
+static bool              remote_telemetry_valid   = false;
+static uint16_t          delta_sync_errors        = 0;
+static uint16_t          housekeeping_us          = 0;
+static uint16_t          housekeeping_max_us      = 0;
+static uint16_t          housekeeping_window_max  = 0;
+static uint16_t          housekeeping_window_time = 0;
+
+static uint16_t slave_last_packet_time = 0;
+static bool     slave_self_suspended   = false;
+#ifdef RTC_ENABLE
+static bool slave_rtc_anchor_received = false; // only re-apply the anchor when the master actually sent a new one
+#endif // RTC_ENABLE
+
+/**
+ * @brief Larger data that is streamed over the fragmenting blob channel, rather than the delta packet.
+ *
+ * The order here needs to match on both halves.
+ */
+#if defined(DISPLAY_DRIVER_ENABLE) && defined(DISPLAY_KEYLOGGER_ENABLE)
+static uint8_t keylog_str_buffer[DISPLAY_KEYLOGGER_LENGTH + 1] = {0};
+static uint8_t keylog_str_acked[DISPLAY_KEYLOGGER_LENGTH + 1]  = {0};
+
+static void keylog_str_updated(void) {
+    keylogger_has_changed = true;
 }
+#endif // DISPLAY_DRIVER_ENABLE && DISPLAY_KEYLOGGER_ENABLE
+#if defined(AUTOCORRECT_ENABLE)
+static uint8_t autocorrected_str_buffer[sizeof(autocorrected_str_raw)] = {0};
+static uint8_t autocorrected_str_acked[sizeof(autocorrected_str_raw)]  = {0};
 
 /**
- * @brief Syncs keymap_config between halves of split keyboard
+ * @brief Only the raw strings are synced, so rebuild the centered ones on the slave
  *
- * @param initiator2target_buffer_size
- * @param initiator2target_buffer
- * @param target2initiator_buffer_size
- * @param target2initiator_buffer
  */
-void user_keymap_sync(uint8_t initiator2target_buffer_size, const void* initiator2target_buffer,
-                      uint8_t target2initiator_buffer_size, void* target2initiator_buffer) {
-    if (initiator2target_buffer_size == sizeof(transport_keymap_config)) {
-        memcpy(&transport_keymap_config, initiator2target_buffer, initiator2target_buffer_size);
+static void autocorrected_str_updated(void) {
+    center_text(autocorrected_str_raw[0], autocorrected_str[0], sizeof(autocorrected_str[0]) - 1);
+    center_text(autocorrected_str_raw[1], autocorrected_str[1], sizeof(autocorrected_str[1]) - 1);
+    autocorrect_str_has_changed = true;
+}
+#endif // AUTOCORRECT_ENABLE
+
+static transport_blob_channel_t blob_channels[] = {
+#if defined(DISPLAY_DRIVER_ENABLE) && defined(DISPLAY_KEYLOGGER_ENABLE)
+    {
+        .data         = &display_keylogger_string,
+        .buffer       = keylog_str_buffer,
+        .size         = sizeof(keylog_str_buffer),
+        .priority     = SYNC_PRIORITY_COSMETIC,
+        .min_interval = 50,
+        .acked        = keylog_str_acked,
+        .encode       = transport_encode_keylog,
+        .decode       = transport_decode_keylog,
+        .on_update    = keylog_str_updated,
+    },
+#endif // DISPLAY_DRIVER_ENABLE && DISPLAY_KEYLOGGER_ENABLE
+#if defined(AUTOCORRECT_ENABLE)
+    {
+        .data         = &autocorrected_str_raw,
+        .buffer       = autocorrected_str_buffer,
+        .size         = sizeof(autocorrected_str_buffer),
+        .priority     = SYNC_PRIORITY_COSMETIC,
+        .min_interval = 100,
+        .acked        = autocorrected_str_acked,
+        .encode       = transport_encode_autocorrect,
+        .decode       = transport_decode_autocorrect,
+        .on_update    = autocorrected_str_updated,
+    },
+#endif // AUTOCORRECT_ENABLE
+    {0},
+};
+
+/**
+ * @brief CRC-8 (polynomial 0x07) over a block of data
+ *
+ * @param crc running crc value
+ * @param data data to add to the crc
+ * @param length length of the data
+ * @return uint8_t updated crc value
+ */
+static uint8_t user_sync_crc8(uint8_t crc, const uint8_t* data, uint8_t length) {
+    while (length--) {
+        crc ^= *data++;
+        for (uint8_t i = 0; i < 8; i++) {
+            crc = (crc & 0x80) ? (crc << 1) ^ 0x07 : (crc << 1);
+        }
     }
+    return crc;
 }
 
 /**
- * @brief Syncs userspace_config between halves of split keyboard
+ * @brief Checksum of all of the synced fields
  *
- * @param initiator2target_buffer_size
- * @param initiator2target_buffer
- * @param target2initiator_buffer_size
- * @param target2initiator_buffer
+ * @param use_shadow use the last sent copy (master) rather than the live values (slave)
+ * @return uint8_t checksum
  */
-void user_config_sync(uint8_t initiator2target_buffer_size, const void* initiator2target_buffer,
-                      uint8_t target2initiator_buffer_size, void* target2initiator_buffer) {
-    if (initiator2target_buffer_size == sizeof(transport_userspace_config)) {
-        memcpy(&transport_userspace_config, initiator2target_buffer, initiator2target_buffer_size);
+static uint8_t user_sync_checksum(bool use_shadow) {
+    uint8_t crc = 0xFF;
+    for (uint8_t i = 0; i < USER_SYNC_FIELD_COUNT; i++) {
+        crc = user_sync_crc8(crc, use_shadow ? sync_fields[i].shadow : sync_fields[i].data, sync_fields[i].size);
     }
+    return crc;
 }
 
-#if defined(AUTOCORRECT_ENABLE)
-extern char autocorrected_str[2][22];
-_Static_assert(sizeof(autocorrected_str) <= RPC_M2S_BUFFER_SIZE, "Autocorrect array larger than buffer size!");
-#endif
 /**
- * @brief Sycn Autoccetion string between halves of split keyboard
+ * @brief Syncs all changed userspace state between halves of split keyboard
+ *
+ * The packet is a dirty field bitmask and sequence number, followed by the data for each flagged field, in field
+ * order. The slave acknowledges with the sequence number and a checksum of its copy of all of the fields, so the
+ * master can tell if a packet went missing, or if the halves have drifted apart.
  *
  * @param initiator2target_buffer_size
  * @param initiator2target_buffer
  * @param target2initiator_buffer_size
  * @param target2initiator_buffer
  */
-void autocorrect_string_sync(uint8_t initiator2target_buffer_size, const void* initiator2target_buffer,
-                             uint8_t target2initiator_buffer_size, void* target2initiator_buffer) {
-#if defined(AUTOCORRECT_ENABLE)
-    if (initiator2target_buffer_size == (sizeof(autocorrected_str))) {
-        memcpy(&autocorrected_str, initiator2target_buffer, initiator2target_buffer_size);
+void user_delta_sync(uint8_t initiator2target_buffer_size, const void* initiator2target_buffer,
+                     uint8_t target2initiator_buffer_size, void* target2initiator_buffer) {
+    const user_sync_packet_t* packet = (const user_sync_packet_t*)initiator2target_buffer;
+    uint8_t                   length = USER_SYNC_HEADER_SIZE;
+
+    if (initiator2target_buffer_size < USER_SYNC_HEADER_SIZE) {
+        if (delta_sync_errors < UINT16_MAX) {
+            delta_sync_errors++;
+        }
+        return;
+    }
+    // Validate the whole packet first, so that a malformed packet doesn't apply partially
+    for (uint8_t i = 0; i < USER_SYNC_FIELD_COUNT; i++) {
+        if (packet->dirty & (1 << i)) {
+            length += sync_fields[i].size;
+        }
+    }
+    if (length != initiator2target_buffer_size) {
+        if (delta_sync_errors < UINT16_MAX) {
+            delta_sync_errors++;
+        }
+        return;
+    }
+
+    uint8_t offset = 0;
+    for (uint8_t i = 0; i < USER_SYNC_FIELD_COUNT; i++) {
+        if (packet->dirty & (1 << i)) {
+            memcpy(sync_fields[i].data, &packet->data[offset], sync_fields[i].size);
+            offset += sync_fields[i].size;
+        }
+    }
+
+    slave_last_packet_time = timer_read();
+    // the master is back, so undo the watchdog suspend if the master isn't actually suspended
+    if (((packet->dirty & (1 << USER_SYNC_SUSPEND_STATE)) || slave_self_suspended) &&
+        transport_suspend_state != is_device_suspended()) {
+        set_is_device_suspended(transport_suspend_state);
+    }
+    slave_self_suspended = false;
+#ifdef RTC_ENABLE
+    if (packet->dirty & (1 << USER_SYNC_RTC_ANCHOR)) {
+        slave_rtc_anchor_received = true;
+    }
+#endif // RTC_ENABLE
+
+    if (target2initiator_buffer_size == sizeof(user_sync_ack_t)) {
+        user_sync_ack_t* ack = (user_sync_ack_t*)target2initiator_buffer;
+        ack->seq             = packet->seq;
+        ack->checksum        = user_sync_checksum(false);
+        ack->telemetry       = transport_sync_get_local_telemetry();
     }
-#endif
 }
 
 /**
- * @brief Sync keylogger string between halves of split keyboard
+ * @brief Compares the sync fields against the last sent values, and flags the changed ones as dirty
  *
- * @param initiator2target_buffer_size
- * @param initiator2target_buffer
- * @param target2initiator_buffer_size
- * @param target2initiator_buffer
  */
-void keylogger_string_sync(uint8_t initiator2target_buffer_size, const void* initiator2target_buffer,
-                           uint8_t target2initiator_buffer_size, void* target2initiator_buffer) {
-#if defined(DISPLAY_DRIVER_ENABLE) && defined(DISPLAY_KEYLOGGER_ENABLE)
-    if (initiator2target_buffer_size == (DISPLAY_KEYLOGGER_LENGTH + 1)) {
-        memcpy(&display_keylogger_string, initiator2target_buffer, initiator2target_buffer_size);
+static void user_sync_check_fields(void) {
+    for (uint8_t i = 0; i < USER_SYNC_FIELD_COUNT; i++) {
+        if (memcmp(sync_fields[i].data, sync_fields[i].shadow, sync_fields[i].size)) {
+            memcpy(sync_fields[i].shadow, sync_fields[i].data, sync_fields[i].size);
+            if (!(sync_dirty_fields & (1 << i))) {
+                sync_dirty_since[i] = timer_read_precise();
+            }
+            sync_dirty_fields |= (1 << i);
+        }
     }
-#endif // DISPLAY_DRIVER_ENABLE && DISPLAY_KEYLOGGER_ENABLE
 }
 
 /**
- * @brief Sync suspend state between halves of split keyboard
+ * @brief Builds and sends a delta packet with the requested dirty fields
  *
- * @param initiator2target_buffer_size
- * @param initiator2target_buffer
- * @param target2initiator_buffer_size
- * @param target2initiator_buffer
+ * Fields are picked in priority order, and any that don't fit into the packet are left dirty, and get sent on the
+ * next pass. Fields are only cleared once the slave has acknowledged the packet. An empty packet acts as a keepalive,
+ * which just checks the checksum.
+ *
+ * @param mask bitmask of the fields to send
+ * @return true packet was acknowledged by the slave
+ * @return false the transaction failed, or the ack was missing
  */
-void suspend_state_sync(uint8_t initiator2target_buffer_size, const void* initiator2target_buffer,
-                        uint8_t target2initiator_buffer_size, void* target2initiator_buffer) {
-    bool suspend_state = false;
-    memcpy(&suspend_state, initiator2target_buffer, initiator2target_buffer_size);
-    if (suspend_state != is_device_suspended()) {
-        set_is_device_suspended(suspend_state);
+static bool user_sync_send_packet(uint8_t mask) {
+    static uint8_t     seq         = 0;
+    static bool        last_failed = false;
+    user_sync_packet_t packet      = {.seq = ++seq};
+    user_sync_ack_t    ack    = {.seq = (uint8_t)(packet.seq - 1)}; // so a missing ack never matches
+    uint8_t            length = 0;
+
+    for (sync_priority_t priority = SYNC_PRIORITY_CRITICAL; priority <= SYNC_PRIORITY_COSMETIC; priority++) {
+        for (uint8_t i = 0; i < USER_SYNC_FIELD_COUNT; i++) {
+            if ((mask & (1 << i)) && sync_fields[i].priority == priority &&
+                (length + sync_fields[i].size) <= sizeof(packet.data)) {
+                packet.dirty |= (1 << i);
+                length += sync_fields[i].size;
+            }
+        }
+    }
+    // Data is always packed in field order, regardless of the priority
+    length = 0;
+    for (uint8_t i = 0; i < USER_SYNC_FIELD_COUNT; i++) {
+        if (packet.dirty & (1 << i)) {
+            memcpy(&packet.data[length], sync_fields[i].shadow, sync_fields[i].size);
+            length += sync_fields[i].size;
+            sync_last_sent[i] = timer_read();
+        }
+    }
+
+    if (last_failed) {
+        transport_stats_record_retry(RPC_ID_USER_DELTA_SYNC);
+    }
+    last_failed = !transport_stats_rpc_exec(RPC_ID_USER_DELTA_SYNC, length + USER_SYNC_HEADER_SIZE, &packet,
+                                            sizeof(ack), &ack) ||
+                  ack.seq != packet.seq;
+    if (last_failed) {
+        return false;
     }
+    remote_telemetry       = ack.telemetry;
+    remote_telemetry_timer = timer_read();
+    remote_telemetry_valid = true;
+    for (uint8_t i = 0; i < USER_SYNC_FIELD_COUNT; i++) {
+        if (packet.dirty & sync_dirty_fields & (1 << i)) {
+            transport_stats_record_visible(RPC_ID_USER_DELTA_SYNC, timer_elapsed_precise_us(sync_dirty_since[i]));
+        }
+    }
+    sync_dirty_fields &= ~packet.dirty;
+
+    // Only compare checksums once everything has been sent, otherwise the halves are expected to differ
+    if (!sync_dirty_fields && ack.checksum != user_sync_checksum(true)) {
+        sync_dirty_fields = (1 << USER_SYNC_FIELD_COUNT) - 1;
+        for (uint8_t i = 0; i < USER_SYNC_FIELD_COUNT; i++) {
+            sync_dirty_since[i] = timer_read_precise();
+        }
+        transport_blob_resync();
+    }
+    return true;
 }
 
 /**
  * @brief Send the suspend state to the other half of the split keyboard
  *
+ * This is sent immediately on the edge, since housekeeping doesn't run while suspended. The send is acknowledged, so
+ * there is no need to wait for it to land. If the ack is missing, it is retried on later calls (the suspend callback
+ * is called constantly), and after SYNC_SUSPEND_MAX_ATTEMPTS the slave's own watchdog takes over.
+ *
  * @param status
  */
 void send_device_suspend_state(bool status) {
-    if (is_device_suspended() != status && is_keyboard_master()) {
-        transaction_rpc_send(RPC_ID_USER_SUSPEND_STATE_SYNC, sizeof(bool), &status);
-        wait_ms(5);
+    static uint8_t  attempts_left = 0;
+    static uint16_t last_attempt  = 0;
+
+    if (!is_keyboard_master()) {
+        return;
+    }
+    if (is_device_suspended() != status) {
+        attempts_left = SYNC_SUSPEND_MAX_ATTEMPTS;
+    } else if (!attempts_left || timer_elapsed(last_attempt) < SYNC_SUSPEND_RETRY_INTERVAL_MS) {
+        return;
+    }
+
+    transport_suspend_state = status;
+    user_sync_check_fields();
+    last_attempt = timer_read();
+    if (user_sync_send_packet(1 << USER_SYNC_SUSPEND_STATE)) {
+        attempts_left = 0;
+    } else {
+        attempts_left--;
+    }
+}
+
+/**
+ * @brief Suspends the slave if the master has gone silent
+ *
+ * The master sends at least a keepalive every SYNC_KEEPALIVE_INTERVAL_MS while awake, so a long silence means that it
+ * has stopped running housekeeping (suspended, hung, or missed the suspend edge).
+ */
+static void user_sync_slave_watchdog(void) {
+    if (!slave_self_suspended && !is_device_suspended() &&
+        timer_elapsed(slave_last_packet_time) > SYNC_SLAVE_SUSPEND_TIMEOUT_MS) {
+        slave_self_suspended = true;
+        set_is_device_suspended(true);
     }
 }
 
@@ -154,12 +443,10 @@ void send_device_suspend_state(bool status) {
  */
 void keyboard_post_init_transport_sync(void) {
     // Register keyboard state sync split transaction
-    transaction_register_rpc(RPC_ID_USER_STATE_SYNC, user_state_sync);
-    transaction_register_rpc(RPC_ID_USER_KEYMAP_SYNC, user_keymap_sync);
-    transaction_register_rpc(RPC_ID_USER_CONFIG_SYNC, user_config_sync);
-    transaction_register_rpc(RPC_ID_USER_AUTOCORRECT_STR, autocorrect_string_sync);
-    transaction_register_rpc(RPC_ID_USER_DISPLAY_KEYLOG_STR, keylogger_string_sync);
-    transaction_register_rpc(RPC_ID_USER_SUSPEND_STATE_SYNC, suspend_state_sync);
+    transaction_register_rpc(RPC_ID_USER_DELTA_SYNC, user_delta_sync);
+    slave_last_packet_time = timer_read();
+    // The last entry is only there to keep the array from being empty
+    transport_blob_init(blob_channels, ARRAY_SIZE(blob_channels) - 1);
 }
 
 /**
@@ -170,7 +457,11 @@ void user_transport_update(void) {
     if (is_keyboard_master()) {
         transport_keymap_config    = keymap_config.raw;
         transport_userspace_config = userspace_config.raw;
-        transport_user_state = user_state.raw;
+        transport_user_state       = user_state.raw;
+        transport_suspend_state    = is_device_suspended();
+#ifdef RTC_ENABLE
+        transport_rtc_anchor = rtc_get_split_anchor();
+#endif // RTC_ENABLE
     } else {
         keymap_config.raw    = transport_keymap_config;
         userspace_config.raw = transport_userspace_config;
@@ -195,123 +486,87 @@ void user_transport_update(void) {
         }
 #endif
         set_keyboard_lock(user_state.host_driver_disabled);
+#ifdef RTC_ENABLE
+        if (slave_rtc_anchor_received) {
+            slave_rtc_anchor_received = false;
+            rtc_set_split_anchor(transport_rtc_anchor);
+        }
+#endif // RTC_ENABLE
     }
 }
 
 /**
- * @brief Send data over split to the other half of the keyboard
+ * @brief Bitmask of the dirty fields that are allowed to be sent now
  *
+ * @return uint8_t
  */
-void user_transport_sync(void) {
-    if (is_keyboard_master()) {
-        // Keep track of the last state, so that we can tell if we need to propagate to slave
-        static uint16_t last_keymap = 0;
-        static uint32_t last_config = 0, last_sync[6], last_user_state = 0;
-        bool            needs_sync = false;
-#if defined(DISPLAY_DRIVER_ENABLE) && defined(DISPLAY_KEYLOGGER_ENABLE)
-        static char keylog_temp[DISPLAY_KEYLOGGER_LENGTH + 1] = {0};
-#endif
-#if defined(AUTOCORRECT_ENABLE)
-        static char temp_autocorrected_str[2][22] = {0};
-#endif
-        if (timer_elapsed32(last_sync[5]) > FORCED_SYNC_THROTTLE_MS && !is_device_suspended()) {
-            transaction_rpc_send(RPC_ID_USER_SUSPEND_STATE_SYNC, sizeof(bool), &needs_sync);
-            last_sync[5] = timer_read32();
-        }
-        // Check if the state values are different
-        if (memcmp(&transport_user_state, &last_user_state, sizeof(transport_user_state))) {
-            needs_sync = true;
-            memcpy(&last_user_state, &transport_user_state, sizeof(transport_user_state));
-        }
-        // Send to slave every FORCED_SYNC_THROTTLE_MS regardless of state change
-        if (timer_elapsed32(last_sync[0]) > FORCED_SYNC_THROTTLE_MS) {
-            needs_sync = true;
-        }
-
-        // Perform the sync if requested
-        if (needs_sync) {
-            if (transaction_rpc_send(RPC_ID_USER_STATE_SYNC, sizeof(user_state), &user_state)) {
-                last_sync[0] = timer_read32();
-            }
-            needs_sync = false;
-        }
-
-        // Check if the state values are different
-        if (memcmp(&transport_keymap_config, &last_keymap, sizeof(transport_keymap_config))) {
-            needs_sync = true;
-            memcpy(&last_keymap, &transport_keymap_config, sizeof(transport_keymap_config));
+static uint8_t user_sync_due_fields(void) {
+    uint8_t due = 0;
+    for (uint8_t i = 0; i < USER_SYNC_FIELD_COUNT; i++) {
+        if ((sync_dirty_fields & (1 << i)) && timer_elapsed(sync_last_sent[i]) >= sync_fields[i].min_interval) {
+            due |= (1 << i);
         }
+    }
+    return due;
+}
 
-        // Send to slave every FORCED_SYNC_THROTTLE_MS regardless of state change
-        if (timer_elapsed32(last_sync[1]) > FORCED_SYNC_THROTTLE_MS) {
-            needs_sync = true;
+/**
+ * @brief Most urgent priority out of a bitmask of fields
+ *
+ * @param mask
+ * @return sync_priority_t
+ */
+static sync_priority_t user_sync_mask_priority(uint8_t mask) {
+    sync_priority_t priority = SYNC_PRIORITY_NONE;
+    for (uint8_t i = 0; i < USER_SYNC_FIELD_COUNT; i++) {
+        if ((mask & (1 << i)) && sync_fields[i].priority < priority) {
+            priority = sync_fields[i].priority;
         }
+    }
+    return priority;
+}
 
-        // Perform the sync if requested
-        if (needs_sync) {
-            if (transaction_rpc_send(RPC_ID_USER_KEYMAP_SYNC, sizeof(transport_keymap_config),
-                                     &transport_keymap_config)) {
-                last_sync[1] = timer_read32();
-            }
-            needs_sync = false;
-        }
+/**
+ * @brief Send data over split to the other half of the keyboard
+ *
+ * All changed fields are coalesced into a single delta packet, so that there is only one round trip per pass. Unchanged
+ * fields are not resent; instead, an empty keepalive packet is sent every SYNC_KEEPALIVE_INTERVAL_MS, and the slave's
+ * checksum triggers a full resend if the halves have drifted apart (such as the slave being reset).
+ *
+ * The delta packet and the blob channel fragments are scheduled by priority, and at most
+ * SYNC_MAX_TRANSACTIONS_PER_PASS transactions are run per pass, so that the time spent here is bounded.
+ */
+void user_transport_sync(void) {
+    if (is_keyboard_master()) {
+        static uint32_t last_sync    = 0;
+        uint8_t         transactions = 0;
 
-        // Check if the state values are different
-        if (memcmp(&user_state, &last_config, sizeof(transport_userspace_config))) {
-            needs_sync = true;
-            memcpy(&last_config, &user_state, sizeof(transport_userspace_config));
-        }
+        user_sync_check_fields();
 
-        // Send to slave every FORCED_SYNC_THROTTLE_MS regardless of state change
-        if (timer_elapsed32(last_sync[2]) > FORCED_SYNC_THROTTLE_MS) {
-            needs_sync = true;
-        }
+        while (transactions < SYNC_MAX_TRANSACTIONS_PER_PASS) {
+            uint8_t         due            = user_sync_due_fields();
+            sync_priority_t delta_priority = user_sync_mask_priority(due);
+            sync_priority_t blob_priority  = transport_blob_pending_priority();
 
-        // Perform the sync if requested
-        if (needs_sync) {
-            if (transaction_rpc_send(RPC_ID_USER_CONFIG_SYNC, sizeof(transport_userspace_config),
-                                     &transport_userspace_config)) {
-                last_sync[2] = timer_read32();
+            if (!due && timer_elapsed32(last_sync) > SYNC_KEEPALIVE_INTERVAL_MS) {
+                delta_priority = SYNC_PRIORITY_KEEPALIVE;
             }
-            needs_sync = false;
-        }
-
-#if defined(DISPLAY_DRIVER_ENABLE) && defined(DISPLAY_KEYLOGGER_ENABLE)
-        // Check if the state values are different
-        if (memcmp(&display_keylogger_string, &keylog_temp, (DISPLAY_KEYLOGGER_LENGTH + 1))) {
-            needs_sync = true;
-            memcpy(&keylog_temp, &display_keylogger_string, (DISPLAY_KEYLOGGER_LENGTH + 1));
-        }
-        if (timer_elapsed32(last_sync[3]) > FORCED_SYNC_THROTTLE_MS) {
-            needs_sync = true;
-        }
-
-        // Perform the sync if requested
-        if (needs_sync) {
-            if (transaction_rpc_send(RPC_ID_USER_DISPLAY_KEYLOG_STR, (DISPLAY_KEYLOGGER_LENGTH + 1),
-                                     &display_keylogger_string)) {
-                last_sync[3] = timer_read32();
+            if (delta_priority == SYNC_PRIORITY_NONE && blob_priority == SYNC_PRIORITY_NONE) {
+                break;
             }
-            needs_sync = false;
-        }
-#endif
-#if defined(AUTOCORRECT_ENABLE)
-        if (memcmp(&autocorrected_str, &temp_autocorrected_str, sizeof(autocorrected_str))) {
-            needs_sync = true;
-            memcpy(&temp_autocorrected_str, &autocorrected_str, sizeof(autocorrected_str));
-        }
-        if (timer_elapsed32(last_sync[4]) > FORCED_SYNC_THROTTLE_MS) {
-            needs_sync = true;
-        }
 
-        // Perform the sync if requested
-        if (needs_sync) {
-            if (transaction_rpc_send(RPC_ID_USER_AUTOCORRECT_STR, sizeof(autocorrected_str), &autocorrected_str)) {
-                last_sync[4] = timer_read32();
+            if (delta_priority <= blob_priority) {
+                if (user_sync_send_packet(due)) {
+                    last_sync = timer_read32();
+                } else {
+                    // don't hammer a link that's down
+                    break;
+                }
+            } else if (!transport_blob_send_next()) {
+                break;
             }
-            needs_sync = false;
+            transactions++;
         }
-#endif
     }
 }
 
@@ -320,37 +575,83 @@ void housekeeping_task_transport_sync(void) {
     user_transport_update();
 
     // Data sync from master to slave
-    user_transport_sync();
+    if (is_keyboard_master()) {
+        uint32_t start = timer_read_precise();
+        user_transport_sync();
+        transport_stats_record_tick(timer_elapsed_precise_us(start));
+    } else {
+        user_sync_slave_watchdog();
+    }
 }
 
-#if 0
-// lets define a custom data type to make things easier to work with
-typedef struct {
-    uint8_t position; // position of the string on the array
-    uint8_t length;
-    char    str[RPC_S2M_BUFFER_SIZE - 2]; // this is as big as you can fit on the split comms message
-} split_msg_t;
-_Static_assert(sizeof(split_msg_t) == RPC_S2M_BUFFER_SIZE, "Wrong size");
-
-
-// instead of
-    transaction_rpc_send(RPC_ID_USER_STR, ARRAY_SIZE(stringToWrite), stringToWrite);
-// you now do:
-    split_msg_t msg = {0};
-    msg.position = <your_variable>;
-    msg.length = strlen(<your_string>) + 1;
-    if (msg.length > ARRAY_SIZE(split_msg_t.str)) {
-        // too big to fit
-        // do something here if you like, but do not send the message
-        return;
+/**
+ * @brief Record how long the housekeeping task took, for the telemetry
+ *
+ * @param elapsed_us duration of the housekeeping pass
+ */
+void transport_sync_record_housekeeping_time(uint32_t elapsed_us) {
+    housekeeping_us = MIN(elapsed_us, UINT16_MAX);
+    if (housekeeping_us > housekeeping_window_max) {
+        housekeeping_window_max = housekeeping_us;
     }
-    strcpy(msg.str, <your_string>);
-    transaction_rpc_send(RPC_ID_USER_STR, sizeof(msg), &msg);
-
-// instead of
-    memcpy(stringToWrite, initiator2target_buffer, initiator2target_buffer_size);
-// you now do:
-    split_msg_t *msg = (split_msg_t *)initiator2target_buffer;
-    memcpy(<your_array>[msg->position], msg->str, msg->length);
+    if (timer_elapsed(housekeeping_window_time) >= 1000) {
+        housekeeping_max_us      = housekeeping_window_max;
+        housekeeping_window_max  = 0;
+        housekeeping_window_time = timer_read();
+    }
+}
+
+/**
+ * @brief Get the telemetry for this half of the split keyboard
+ *
+ * @return split_telemetry_t
+ */
+split_telemetry_t transport_sync_get_local_telemetry(void) {
+    split_telemetry_t telemetry = {
+        .matrix_scan_rate    = get_matrix_scan_rate(),
+        .housekeeping_us     = housekeeping_us,
+        .housekeeping_max_us = MAX(housekeeping_max_us, housekeeping_window_max),
+        .delta_errors        = delta_sync_errors,
+        .blob_errors         = transport_blob_get_error_count(),
+#ifdef RTC_ENABLE
+        .rtc_connected = rtc_is_connected(),
+#endif // RTC_ENABLE
+    };
+    return telemetry;
 }
+
+/**
+ * @brief Get the last telemetry received from the other half
+ *
+ * @return const split_telemetry_t* NULL if nothing has been received recently
+ */
+const split_telemetry_t *transport_sync_get_remote_telemetry(void) {
+    if (!remote_telemetry_valid || timer_elapsed(remote_telemetry_timer) > SYNC_TELEMETRY_TIMEOUT_MS) {
+        return NULL;
+    }
+    return &remote_telemetry;
+}
+
+/**
+ * @brief Print the telemetry of both halves to the console
+ *
+ */
+void transport_sync_print_telemetry(void) {
+#ifndef NO_PRINT
+    split_telemetry_t        local  = transport_sync_get_local_telemetry();
+    const split_telemetry_t *remote = transport_sync_get_remote_telemetry();
+
+    for (uint8_t i = 0; i < 2; i++) {
+        const split_telemetry_t *telemetry = i ? remote : &local;
+        xprintf("%s half: ", i ? "Remote" : "Local");
+        if (!telemetry) {
+            xprintf("no data\n");
+            continue;
+        }
+        xprintf("scans %lu, housekeeping %uus (max %uus), rtc %s, delta errors %u, blob errors %u\n",
+                telemetry->matrix_scan_rate, telemetry->housekeeping_us, telemetry->housekeeping_max_us,
+                telemetry->rtc_connected ? "connected" : "disconnected", telemetry->delta_errors,
+                telemetry->blob_errors);
+    }
 #endif
+}
@@ -6,6 +6,36 @@
 #include <stdint.h>
 #include "drashna.h"
 
-void keyboard_post_init_transport_sync(void);
-void housekeeping_task_transport_sync(void);
-void send_device_suspend_state(bool status);
+/**
+ * @brief Priority of synced data, lower values are sent first
+ *
+ */
+typedef enum {
+    SYNC_PRIORITY_CRITICAL = 0, // state that changes typing behavior (caps word, swap hands, keyboard lock, suspend)
+    SYNC_PRIORITY_HIGH,
+    SYNC_PRIORITY_NORMAL,
+    SYNC_PRIORITY_COSMETIC,  // display only data (keylogger, autocorrect strings)
+    SYNC_PRIORITY_KEEPALIVE, // nothing has changed, just checking in
+    SYNC_PRIORITY_NONE = 0xFF,
+} sync_priority_t;
+
+/**
+ * @brief Health of one half of the split keyboard, sent back by the slave in the delta sync ack
+ *
+ */
+typedef struct PACKED {
+    uint32_t matrix_scan_rate;
+    uint16_t housekeeping_us;     // duration of the last housekeeping pass
+    uint16_t housekeeping_max_us; // longest housekeeping pass in the last second
+    uint16_t delta_errors;        // rejected delta sync packets
+    uint16_t blob_errors;         // rejected blob fragments
+    bool     rtc_connected;
+} split_telemetry_t;
+
+void                     keyboard_post_init_transport_sync(void);
+void                     housekeeping_task_transport_sync(void);
+void                     send_device_suspend_state(bool status);
+void                     transport_sync_record_housekeeping_time(uint32_t elapsed_us);
+split_telemetry_t        transport_sync_get_local_telemetry(void);
+const split_telemetry_t *transport_sync_get_remote_telemetry(void);
+void                     transport_sync_print_telemetry(void);